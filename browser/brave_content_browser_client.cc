@@ -222,6 +222,7 @@ using extensions::ChromeContentBrowserClientExtensionsPart;
 
 #if BUILDFLAG(ENABLE_PLAYLIST)
 #include "brave/browser/playlist/playlist_service_factory.h"
+#include "brave/components/playlist/browser/playlist_media_url_loader_factory.h"
 #include "brave/components/playlist/browser/playlist_render_frame_browser_client.h"
 #include "brave/components/playlist/browser/playlist_service.h"
 #include "brave/components/playlist/common/mojom/playlist.mojom.h"
@@ -903,6 +904,48 @@ bool BraveContentBrowserClient::WillCreateURLLoaderFactory(
   return use_proxy;
 }
 
+void BraveContentBrowserClient::RegisterNonNetworkSubresourceURLLoaderFactories(
+    int render_process_id,
+    int render_frame_id,
+    const absl::optional<url::Origin>& request_initiator_origin,
+    NonNetworkURLLoaderFactoryMap* factories) {
+  ChromeContentBrowserClient::RegisterNonNetworkSubresourceURLLoaderFactories(
+      render_process_id, render_frame_id, request_initiator_origin, factories);
+
+#if BUILDFLAG(ENABLE_PLAYLIST_WEBUI)
+  // Playlist media is streamed with support for Range requests rather than
+  // served by the WebUI data source, which other requests still go to.
+  if (!request_initiator_origin ||
+      request_initiator_origin->scheme() != content::kChromeUIUntrustedScheme ||
+      (request_initiator_origin->host() != kPlaylistHost &&
+       request_initiator_origin->host() != kPlaylistPlayerHost)) {
+    return;
+  }
+
+  auto* frame_host =
+      content::RenderFrameHost::FromID(render_process_id, render_frame_id);
+  if (!frame_host) {
+    return;
+  }
+
+  auto* playlist_service =
+      playlist::PlaylistServiceFactory::GetForBrowserContext(
+          frame_host->GetBrowserContext());
+  if (!playlist_service) {
+    return;
+  }
+
+  mojo::PendingRemote<network::mojom::URLLoaderFactory> fallback_factory;
+  if (auto it = factories->find(content::kChromeUIUntrustedScheme);
+      it != factories->end()) {
+    fallback_factory = std::move(it->second);
+  }
+  (*factories)[content::kChromeUIUntrustedScheme] =
+      playlist::PlaylistMediaURLLoaderFactory::Create(
+          playlist_service->GetWeakPtr(), std::move(fallback_factory));
+#endif  // BUILDFLAG(ENABLE_PLAYLIST_WEBUI)
+}
+
 bool BraveContentBrowserClient::WillInterceptWebSocket(
     content::RenderFrameHost* frame) {
   return (frame != nullptr);
@@ -651,7 +651,13 @@ class BraveWalletServiceUnitTest : public testing::Test {
     ASSERT_NE(valid_password, nullptr);
     ASSERT_NE(valid_mnemonic, nullptr);
 
-    *valid_password = keyring_service_->ValidatePasswordInternal(new_password);
+    base::RunLoop validate_run_loop;
+    keyring_service_->ValidatePassword(
+        new_password, base::BindLambdaForTesting([&](bool result) {
+          *valid_password = result;
+          validate_run_loop.Quit();
+        }));
+    validate_run_loop.Run();
 
     base::RunLoop run_loop;
     keyring_service_->GetMnemonicForDefaultKeyring(
@@ -9,6 +9,7 @@
 #include <utility>
 
 #include "base/containers/contains.h"
+#include "base/files/file_path.h"
 #include "base/functional/bind.h"
 #include "base/strings/strcat.h"
 #include "base/test/bind.h"
@@ -19,6 +20,7 @@
 #include "brave/components/brave_wallet/browser/eth_tx_state_manager.h"
 #include "brave/components/brave_wallet/browser/json_rpc_service.h"
 #include "brave/components/brave_wallet/browser/tx_meta.h"
+#include "brave/components/brave_wallet/browser/tx_storage.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
 #include "brave/components/brave_wallet/common/brave_wallet_types.h"
 #include "brave/components/brave_wallet/common/eth_address.h"
@@ -73,7 +75,8 @@ class EthPendingTxTrackerUnitTest : public testing::Test {
 
 TEST_F(EthPendingTxTrackerUnitTest, IsNonceTaken) {
   JsonRpcService service(shared_url_loader_factory(), GetPrefs());
-  EthTxStateManager tx_state_manager(GetPrefs());
+  TxStorage tx_storage(GetPrefs(), base::FilePath());
+  EthTxStateManager tx_state_manager(GetPrefs(), &tx_storage);
   EthNonceTracker nonce_tracker(&tx_state_manager, &service);
   EthPendingTxTracker pending_tx_tracker(&tx_state_manager, &service,
                                          &nonce_tracker);
@@ -107,7 +110,8 @@ TEST_F(EthPendingTxTrackerUnitTest, ShouldTxDropped) {
       EthAddress::FromHex("0x2f015c60e0be116b1f0cd534704db9c92118fb6a")
           .ToChecksumAddress();
   JsonRpcService service(shared_url_loader_factory(), GetPrefs());
-  EthTxStateManager tx_state_manager(GetPrefs());
+  TxStorage tx_storage(GetPrefs(), base::FilePath());
+  EthTxStateManager tx_state_manager(GetPrefs(), &tx_storage);
   EthNonceTracker nonce_tracker(&tx_state_manager, &service);
   EthPendingTxTracker pending_tx_tracker(&tx_state_manager, &service,
                                          &nonce_tracker);
@@ -137,7 +141,8 @@ TEST_F(EthPendingTxTrackerUnitTest, ShouldTxDropped) {
 
 TEST_F(EthPendingTxTrackerUnitTest, DropTransaction) {
   JsonRpcService service(shared_url_loader_factory(), GetPrefs());
-  EthTxStateManager tx_state_manager(GetPrefs());
+  TxStorage tx_storage(GetPrefs(), base::FilePath());
+  EthTxStateManager tx_state_manager(GetPrefs(), &tx_storage);
   EthNonceTracker nonce_tracker(&tx_state_manager, &service);
   EthPendingTxTracker pending_tx_tracker(&tx_state_manager, &service,
                                          &nonce_tracker);
@@ -159,7 +164,8 @@ TEST_F(EthPendingTxTrackerUnitTest, UpdatePendingTransactions) {
       EthAddress::FromHex("0x2f015c60e0be116b1f0cd534704db9c92118fb6b")
           .ToChecksumAddress();
   JsonRpcService service(shared_url_loader_factory(), GetPrefs());
-  EthTxStateManager tx_state_manager(GetPrefs());
+  TxStorage tx_storage(GetPrefs(), base::FilePath());
+  EthTxStateManager tx_state_manager(GetPrefs(), &tx_storage);
   EthNonceTracker nonce_tracker(&tx_state_manager, &service);
   EthPendingTxTracker pending_tx_tracker(&tx_state_manager, &service,
                                          &nonce_tracker);
@@ -7,6 +7,7 @@
 
 #include <utility>
 
+#include "base/barrier_closure.h"
 #include "base/base64.h"
 #include "base/functional/callback_helpers.h"
 #include "base/ranges/algorithm.h"
@@ -1245,6 +1246,64 @@ TEST_F(KeyringServiceUnitTest, LockAndUnlock) {
   }
 }
 
+TEST_F(KeyringServiceUnitTest, DeriveKeysOffTheCallingSequence) {
+  KeyringService service(json_rpc_service(), GetPrefs(), GetLocalState());
+  ASSERT_TRUE(CreateWallet(&service, "brave"));
+  service.Lock();
+
+  // Unlock and ValidatePassword return before any key is derived, leaving
+  // the calling sequence free until the result is posted back.
+  absl::optional<bool> unlocked;
+  absl::optional<bool> password_valid;
+  base::RunLoop run_loop;
+  auto barrier = base::BarrierClosure(2, run_loop.QuitClosure());
+  service.Unlock("brave", base::BindLambdaForTesting([&](bool success) {
+                   unlocked = success;
+                   barrier.Run();
+                 }));
+  service.ValidatePassword("brave", base::BindLambdaForTesting([&](bool v) {
+                             password_valid = v;
+                             barrier.Run();
+                           }));
+  EXPECT_FALSE(unlocked);
+  EXPECT_FALSE(password_valid);
+  EXPECT_TRUE(service.IsLockedSync());
+
+  run_loop.Run();
+  EXPECT_EQ(unlocked, true);
+  EXPECT_EQ(password_valid, true);
+  EXPECT_FALSE(service.IsLockedSync());
+
+  service.Lock();
+  EXPECT_FALSE(Unlock(&service, "brave1"));
+  EXPECT_TRUE(service.IsLockedSync());
+  EXPECT_FALSE(ValidatePassword(&service, "brave1"));
+}
+
+TEST_F(KeyringServiceUnitTest, LockDuringPendingUnlock) {
+  KeyringService service(json_rpc_service(), GetPrefs(), GetLocalState());
+  ASSERT_TRUE(CreateWallet(&service, "brave"));
+  service.Lock();
+
+  absl::optional<bool> unlocked;
+  base::RunLoop run_loop;
+  service.Unlock("brave", base::BindLambdaForTesting([&](bool success) {
+                   unlocked = success;
+                   run_loop.Quit();
+                 }));
+  EXPECT_FALSE(unlocked);
+
+  // Locking before the keys are derived wins over the pending unlock.
+  service.Lock();
+  run_loop.Run();
+  EXPECT_EQ(unlocked, false);
+  EXPECT_TRUE(service.IsLockedSync());
+
+  // A later unlock isn't affected.
+  EXPECT_TRUE(Unlock(&service, "brave"));
+  EXPECT_FALSE(service.IsLockedSync());
+}
+
 TEST_F(KeyringServiceUnitTest, Reset) {
   KeyringService service(json_rpc_service(), GetPrefs(), GetLocalState());
   ASSERT_TRUE(CreateWallet(&service, "brave"));
@@ -9,6 +9,7 @@
 #include <utility>
 #include <vector>
 
+#include "base/files/file_path.h"
 #include "brave/components/brave_wallet/browser/eth_transaction.h"
 #include "brave/components/brave_wallet/browser/eth_tx_meta.h"
 #include "brave/components/brave_wallet/browser/json_rpc_service.h"
@@ -41,7 +42,8 @@ class WalletNotificationServiceUnitTest : public testing::Test {
     keyring_service_ = std::make_unique<KeyringService>(json_rpc_service_.get(),
                                                         prefs(), local_state());
     tx_service_ = std::make_unique<TxService>(json_rpc_service_.get(), nullptr,
-                                              keyring_service_.get(), prefs());
+                                              keyring_service_.get(), prefs(),
+                                              base::FilePath());
     notification_service_ =
         std::make_unique<WalletNotificationService>(profile());
     tester_ = std::make_unique<NotificationDisplayServiceTester>(profile());
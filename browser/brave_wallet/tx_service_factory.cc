@@ -19,6 +19,7 @@
 #include "chrome/browser/profiles/incognito_helpers.h"
 #include "components/keyed_service/content/browser_context_dependency_manager.h"
 #include "components/user_prefs/user_prefs.h"
+#include "content/public/browser/browser_context.h"
 
 #if !BUILDFLAG(IS_ANDROID)
 #include "brave/browser/brave_wallet/wallet_notification_helper.h"
@@ -151,7 +152,7 @@ KeyedService* TxServiceFactory::BuildServiceInstanceFor(
       new TxService(JsonRpcServiceFactory::GetServiceForContext(context),
                     BitcoinWalletServiceFactory::GetServiceForContext(context),
                     KeyringServiceFactory::GetServiceForContext(context),
-                    user_prefs::UserPrefs::Get(context));
+                    user_prefs::UserPrefs::Get(context), context->GetPath());
 #if !BUILDFLAG(IS_ANDROID)
   RegisterWalletNotificationService(context, tx_service);
 #endif
@@ -165,6 +165,34 @@ class AdblockCnameResolveHostClient : public network::mojom::ResolveHostClient {
   }
 };
 
+// Requests made from YouTube are always checked in aggressive mode.
+bool ShouldForceAggressive(const BraveRequestInfo& ctx) {
+  return SameDomainOrHost(
+      ctx.initiator_url,
+      url::Origin::CreateFromNormalizedTuple("https", "youtube.com", 80),
+      net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
+}
+
+// Records a finished engine check on |ctx| and returns the flags to carry over
+// to the CNAME-uncloaked check, if any.
+EngineFlags ApplyShouldStartRequestResult(
+    std::shared_ptr<BraveRequestInfo> ctx,
+    const EngineFlags& result,
+    const std::string& rewritten_url) {
+  if (GURL(rewritten_url).is_valid() &&
+      (ctx->method == "GET" || ctx->method == "HEAD" ||
+       ctx->method == "OPTIONS")) {
+    ctx->new_url_spec = rewritten_url;
+  }
+
+  if (result.did_match_important ||
+      (result.did_match_rule && !result.did_match_exception)) {
+    ctx->blocked_by = kAdBlocked;
+  }
+
+  return result;
+}
+
 // If `canonical_url` is specified, this will only check if the CNAME-uncloaked
 // response should be blocked. Otherwise, it will run the check for the
 // original request URL.
@@ -184,34 +212,75 @@ EngineFlags ShouldBlockRequestOnTaskRunner(
     url_to_check = ctx->request_url;
   }
 
-  bool force_aggressive = SameDomainOrHost(
-      ctx->initiator_url,
-      url::Origin::CreateFromNormalizedTuple("https", "youtube.com", 80),
-      net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
-
   std::string rewritten_url;
 
   SCOPED_UMA_HISTOGRAM_TIMER("Brave.Adblock.ShouldBlockRequest");
   g_brave_browser_process->ad_block_service()->ShouldStartRequest(
       url_to_check, ctx->resource_type, source_host,
-      ctx->aggressive_blocking || force_aggressive,
+      ctx->aggressive_blocking || ShouldForceAggressive(*ctx),
       &previous_result.did_match_rule, &previous_result.did_match_exception,
       &previous_result.did_match_important, &ctx->mock_data_url,
       &rewritten_url);
 
-  if (GURL(rewritten_url).is_valid() &&
-      (ctx->method == "GET" || ctx->method == "HEAD" ||
-       ctx->method == "OPTIONS")) {
-    ctx->new_url_spec = rewritten_url;
+  return ApplyShouldStartRequestResult(ctx, previous_result, rewritten_url);
+}
+
+// Same as ShouldBlockRequestOnTaskRunner, but lets the ad block service spread
+// the engine checks over several sequences. Called and replies on the UI
+// thread.
+void ShouldBlockRequestInParallel(
+    std::shared_ptr<BraveRequestInfo> ctx,
+    EngineFlags previous_result,
+    absl::optional<GURL> canonical_url,
+    base::OnceCallback<void(EngineFlags)> callback) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  if (!ctx->initiator_url.is_valid()) {
+    std::move(callback).Run(previous_result);
+    return;
   }
 
-  if (previous_result.did_match_important ||
-      (previous_result.did_match_rule &&
-       !previous_result.did_match_exception)) {
-    ctx->blocked_by = kAdBlocked;
+  brave_shields::AdBlockService::ShouldStartRequestResult start;
+  start.did_match_rule = previous_result.did_match_rule;
+  start.did_match_exception = previous_result.did_match_exception;
+  start.did_match_important = previous_result.did_match_important;
+  start.mock_data_url = ctx->mock_data_url;
+
+  g_brave_browser_process->ad_block_service()->ShouldStartRequestAsync(
+      canonical_url.value_or(ctx->request_url), ctx->resource_type,
+      ctx->initiator_url.host(),
+      ctx->aggressive_blocking || ShouldForceAggressive(*ctx), std::move(start),
+      base::BindOnce(
+          [](std::shared_ptr<BraveRequestInfo> ctx,
+             base::OnceCallback<void(EngineFlags)> callback,
+             brave_shields::AdBlockService::ShouldStartRequestResult result) {
+            ctx->mock_data_url = std::move(result.mock_data_url);
+            std::move(callback).Run(ApplyShouldStartRequestResult(
+                ctx,
+                EngineFlags{result.did_match_rule, result.did_match_exception,
+                            result.did_match_important},
+                result.rewritten_url));
+          },
+          ctx, std::move(callback)));
+}
+
+// Runs the engine check for `ctx` and replies with `callback` on the UI thread.
+void ShouldBlockRequest(scoped_refptr<base::SequencedTaskRunner> task_runner,
+                        std::shared_ptr<BraveRequestInfo> ctx,
+                        EngineFlags previous_result,
+                        absl::optional<GURL> canonical_url,
+                        base::OnceCallback<void(EngineFlags)> callback) {
+  if (base::FeatureList::IsEnabled(
+          brave_shields::features::kAdblockParallelMatching)) {
+    ShouldBlockRequestInParallel(ctx, previous_result, std::move(canonical_url),
+                                 std::move(callback));
+    return;
   }
 
-  return previous_result;
+  task_runner->PostTaskAndReplyWithResult(
+      FROM_HERE,
+      base::BindOnce(&ShouldBlockRequestOnTaskRunner, ctx, previous_result,
+                     std::move(canonical_url)),
+      std::move(callback));
 }
 
 void OnShouldBlockRequestResult(
@@ -246,12 +315,10 @@ void UseCnameResult(scoped_refptr<base::SequencedTaskRunner> task_runner,
     replacements.SetHostStr(cname->c_str());
     const GURL canonical_url = ctx->request_url.ReplaceComponents(replacements);
 
-    task_runner->PostTaskAndReplyWithResult(
-        FROM_HERE,
-        base::BindOnce(&ShouldBlockRequestOnTaskRunner, ctx, previous_result,
-                       absl::make_optional<GURL>(canonical_url)),
-        base::BindOnce(&OnShouldBlockRequestResult, false, task_runner,
-                       next_callback, ctx));
+    ShouldBlockRequest(task_runner, ctx, previous_result,
+                       absl::make_optional<GURL>(canonical_url),
+                       base::BindOnce(&OnShouldBlockRequestResult, false,
+                                      task_runner, next_callback, ctx));
   } else {
     next_callback.Run();
   }
@@ -341,12 +408,10 @@ void OnBeforeURLRequestAdBlockTP(const ResponseCallback& next_callback,
     should_check_uncloaked = false;
   }
 
-  task_runner->PostTaskAndReplyWithResult(
-      FROM_HERE,
-      base::BindOnce(&ShouldBlockRequestOnTaskRunner, ctx, EngineFlags(),
-                     absl::nullopt),
-      base::BindOnce(&OnShouldBlockRequestResult, should_check_uncloaked,
-                     task_runner, next_callback, ctx));
+  ShouldBlockRequest(task_runner, ctx, EngineFlags(), absl::nullopt,
+                     base::BindOnce(&OnShouldBlockRequestResult,
+                                    should_check_uncloaked, task_runner,
+                                    next_callback, ctx));
 }
 
 int OnBeforeURLRequest_AdBlockTPPreWork(const ResponseCallback& next_callback,
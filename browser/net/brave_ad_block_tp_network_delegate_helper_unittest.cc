@@ -12,12 +12,14 @@
 #include "base/memory/raw_ptr.h"
 #include "base/path_service.h"
 #include "base/task/single_thread_task_runner.h"
+#include "base/test/scoped_feature_list.h"
 #include "brave/browser/brave_browser_process.h"
 #include "brave/browser/net/url_context.h"
 #include "brave/components/brave_component_updater/browser/brave_component.h"
 #include "brave/components/brave_shields/browser/ad_block_service.h"
 #include "brave/components/brave_shields/browser/ad_block_subscription_download_manager.h"
 #include "brave/components/brave_shields/browser/test_filters_provider.h"
+#include "brave/components/brave_shields/common/features.h"
 #include "brave/test/base/testing_brave_browser_process.h"
 #include "chrome/browser/net/system_network_context_manager.h"
 #include "chrome/common/chrome_paths.h"
@@ -254,3 +256,58 @@ TEST_F(BraveAdBlockTPNetworkDelegateHelperTest, AggressiveNo1pException) {
   // made (`browser_context` is `nullptr`).
   EXPECT_EQ(0ULL, host_resolver_->num_resolve());
 }
+
+class BraveAdBlockTPNetworkDelegateHelperParallelMatchingTest
+    : public BraveAdBlockTPNetworkDelegateHelperTest {
+ public:
+  BraveAdBlockTPNetworkDelegateHelperParallelMatchingTest() {
+    scoped_feature_list_.InitAndEnableFeature(
+        brave_shields::features::kAdblockParallelMatching);
+  }
+
+ private:
+  base::test::ScopedFeatureList scoped_feature_list_;
+};
+
+TEST_F(BraveAdBlockTPNetworkDelegateHelperParallelMatchingTest,
+       SimpleBlocking) {
+  ResetAdblockInstance("||brave.com/test.txt", "");
+
+  const GURL url("https://brave.com/test.txt");
+  auto request_info = std::make_shared<brave::BraveRequestInfo>(url);
+  request_info->request_identifier = 1;
+  request_info->resource_type = blink::mojom::ResourceType::kScript;
+  request_info->initiator_url = GURL("https://bravesoftware.com");
+
+  EXPECT_TRUE(CheckRequest(request_info));
+  EXPECT_EQ(request_info->blocked_by, brave::kAdBlocked);
+  EXPECT_TRUE(request_info->new_url_spec.empty());
+}
+
+TEST_F(BraveAdBlockTPNetworkDelegateHelperParallelMatchingTest,
+       ExceptionInSameList) {
+  ResetAdblockInstance("||brave.com/test.txt\n@@||brave.com/test.txt", "");
+
+  const GURL url("https://brave.com/test.txt");
+  auto request_info = std::make_shared<brave::BraveRequestInfo>(url);
+  request_info->request_identifier = 1;
+  request_info->resource_type = blink::mojom::ResourceType::kScript;
+  request_info->initiator_url = GURL("https://bravesoftware.com");
+
+  EXPECT_TRUE(CheckRequest(request_info));
+  EXPECT_EQ(request_info->blocked_by, brave::kNotBlocked);
+}
+
+TEST_F(BraveAdBlockTPNetworkDelegateHelperParallelMatchingTest,
+       Default1pException) {
+  ResetAdblockInstance("||brave.com/test.txt", "");
+
+  const GURL url("https://brave.com/test.txt");
+  auto request_info = std::make_shared<brave::BraveRequestInfo>(url);
+  request_info->request_identifier = 1;
+  request_info->resource_type = blink::mojom::ResourceType::kScript;
+  request_info->initiator_url = GURL("https://brave.com");
+
+  EXPECT_TRUE(CheckRequest(request_info));
+  EXPECT_EQ(request_info->blocked_by, brave::kNotBlocked);
+}
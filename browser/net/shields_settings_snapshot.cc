@@ -0,0 +1,125 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/shields_settings_snapshot.h"
+
+#include <memory>
+
+#include "base/containers/contains.h"
+#include "brave/components/brave_shields/browser/brave_shields_util.h"
+#include "chrome/browser/content_settings/host_content_settings_map_factory.h"
+#include "chrome/browser/profiles/profile.h"
+#include "content/public/browser/browser_context.h"
+#include "content/public/browser/browser_thread.h"
+
+namespace brave {
+
+namespace {
+
+// User data key for ShieldsSettingsSnapshotCache.
+const void* const kShieldsSettingsSnapshotCacheUserDataKey =
+    &kShieldsSettingsSnapshotCacheUserDataKey;
+
+// A page rarely talks to more than a handful of top-level origins at once, so
+// this only needs to cover the tabs that are actively loading.
+constexpr size_t kMaxCachedSnapshots = 64;
+
+constexpr ContentSettingsType kSnapshotContentSettingsTypes[] = {
+    ContentSettingsType::BRAVE_SHIELDS,
+    ContentSettingsType::BRAVE_ADS,
+    ContentSettingsType::BRAVE_COSMETIC_FILTERING,
+    ContentSettingsType::BRAVE_HTTP_UPGRADABLE_RESOURCES,
+    ContentSettingsType::BRAVE_REFERRERS,
+};
+
+}  // namespace
+
+ShieldsSettingsSnapshotCache::ShieldsSettingsSnapshotCache(
+    HostContentSettingsMap* map)
+    : map_(map), snapshots_(kMaxCachedSnapshots) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  DCHECK(map_);
+  content_settings_observation_.Observe(map_.get());
+}
+
+ShieldsSettingsSnapshotCache::~ShieldsSettingsSnapshotCache() = default;
+
+// static
+ShieldsSettingsSnapshotCache*
+ShieldsSettingsSnapshotCache::GetForBrowserContext(
+    content::BrowserContext* browser_context) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  DCHECK(browser_context);
+
+  auto* self = static_cast<ShieldsSettingsSnapshotCache*>(
+      browser_context->GetUserData(kShieldsSettingsSnapshotCacheUserDataKey));
+  if (self) {
+    return self;
+  }
+
+  auto* map = HostContentSettingsMapFactory::GetForProfile(
+      Profile::FromBrowserContext(browser_context));
+  if (!map) {
+    return nullptr;
+  }
+
+  self = new ShieldsSettingsSnapshotCache(map);
+  browser_context->SetUserData(kShieldsSettingsSnapshotCacheUserDataKey,
+                               base::WrapUnique(self));
+  return self;
+}
+
+const ShieldsSettingsSnapshot& ShieldsSettingsSnapshotCache::Get(
+    const GURL& tab_origin) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+
+  auto it = snapshots_.Get(tab_origin);
+  if (it == snapshots_.end()) {
+    it = snapshots_.Put(tab_origin, Compute(tab_origin));
+  }
+  return it->second;
+}
+
+void ShieldsSettingsSnapshotCache::OnContentSettingChanged(
+    const ContentSettingsPattern& primary_pattern,
+    const ContentSettingsPattern& secondary_pattern,
+    ContentSettingsTypeSet content_type_set) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+
+  if (!content_type_set.ContainsAllTypes() &&
+      !base::Contains(kSnapshotContentSettingsTypes,
+                      content_type_set.GetType())) {
+    return;
+  }
+
+  // Patterns may be arbitrarily broad (e.g. default settings), so don't try to
+  // be clever about which origins are affected.
+  snapshots_.Clear();
+  ++version_;
+}
+
+ShieldsSettingsSnapshot ShieldsSettingsSnapshotCache::Compute(
+    const GURL& tab_origin) const {
+  HostContentSettingsMap* map = map_.get();
+
+  ShieldsSettingsSnapshot snapshot;
+  snapshot.version = version_;
+  snapshot.shields_enabled =
+      brave_shields::GetBraveShieldsEnabled(map, tab_origin);
+  snapshot.allow_ads = brave_shields::GetAdControlType(map, tab_origin) ==
+                       brave_shields::ControlType::ALLOW;
+  // Currently, "aggressive" mode is registered as a cosmetic filtering control
+  // type, even though it can also affect network blocking.
+  snapshot.aggressive_blocking =
+      brave_shields::GetCosmeticFilteringControlType(map, tab_origin) ==
+      brave_shields::ControlType::BLOCK;
+  snapshot.allow_http_upgradable_resource =
+      !brave_shields::GetHTTPSEverywhereEnabled(map, tab_origin);
+  snapshot.allow_referrers =
+      brave_shields::AreReferrersAllowed(map, tab_origin);
+  return snapshot;
+}
+
+}  // namespace brave
@@ -0,0 +1,78 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_BROWSER_NET_SHIELDS_SETTINGS_SNAPSHOT_H_
+#define BRAVE_BROWSER_NET_SHIELDS_SETTINGS_SNAPSHOT_H_
+
+#include <cstdint>
+
+#include "base/containers/lru_cache.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/scoped_observation.h"
+#include "base/supports_user_data.h"
+#include "components/content_settings/core/browser/content_settings_observer.h"
+#include "components/content_settings/core/browser/host_content_settings_map.h"
+#include "url/gurl.h"
+
+namespace content {
+class BrowserContext;
+}
+
+namespace brave {
+
+// Shields settings which |BraveRequestInfo| needs for every request made from
+// a given tab origin. A snapshot is immutable; |version| identifies the
+// content settings generation it was computed from.
+struct ShieldsSettingsSnapshot {
+  uint64_t version = 0;
+  bool shields_enabled = true;
+  bool allow_ads = false;
+  bool aggressive_blocking = false;
+  bool allow_http_upgradable_resource = false;
+  bool allow_referrers = false;
+};
+
+// Memoizes |ShieldsSettingsSnapshot| per tab origin for a single profile, so
+// that subresource requests don't repeat the same |HostContentSettingsMap|
+// pattern matching. Any content settings change drops every cached snapshot
+// and bumps the version. Lives on the UI thread, attached to the
+// BrowserContext as user data.
+class ShieldsSettingsSnapshotCache : public base::SupportsUserData::Data,
+                                     public content_settings::Observer {
+ public:
+  explicit ShieldsSettingsSnapshotCache(HostContentSettingsMap* map);
+  ShieldsSettingsSnapshotCache(const ShieldsSettingsSnapshotCache&) = delete;
+  ShieldsSettingsSnapshotCache& operator=(const ShieldsSettingsSnapshotCache&) =
+      delete;
+  ~ShieldsSettingsSnapshotCache() override;
+
+  // Returns nullptr if |browser_context| has no HostContentSettingsMap.
+  static ShieldsSettingsSnapshotCache* GetForBrowserContext(
+      content::BrowserContext* browser_context);
+
+  const ShieldsSettingsSnapshot& Get(const GURL& tab_origin);
+
+  uint64_t version() const { return version_; }
+
+  // content_settings::Observer:
+  void OnContentSettingChanged(
+      const ContentSettingsPattern& primary_pattern,
+      const ContentSettingsPattern& secondary_pattern,
+      ContentSettingsTypeSet content_type_set) override;
+
+ private:
+  ShieldsSettingsSnapshot Compute(const GURL& tab_origin) const;
+
+  scoped_refptr<HostContentSettingsMap> map_;
+  uint64_t version_ = 1;
+  base::LRUCache<GURL, ShieldsSettingsSnapshot> snapshots_;
+
+  base::ScopedObservation<HostContentSettingsMap, content_settings::Observer>
+      content_settings_observation_{this};
+};
+
+}  // namespace brave
+
+#endif  // BRAVE_BROWSER_NET_SHIELDS_SETTINGS_SNAPSHOT_H_
@@ -0,0 +1,85 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/shields_settings_snapshot.h"
+
+#include "brave/components/brave_shields/browser/brave_shields_util.h"
+#include "chrome/browser/content_settings/host_content_settings_map_factory.h"
+#include "chrome/test/base/testing_profile.h"
+#include "content/public/test/browser_task_environment.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace brave {
+
+class ShieldsSettingsSnapshotCacheTest : public testing::Test {
+ public:
+  ShieldsSettingsSnapshotCacheTest() = default;
+
+  HostContentSettingsMap* map() {
+    return HostContentSettingsMapFactory::GetForProfile(&profile_);
+  }
+
+  ShieldsSettingsSnapshotCache* cache() {
+    return ShieldsSettingsSnapshotCache::GetForBrowserContext(&profile_);
+  }
+
+ private:
+  content::BrowserTaskEnvironment task_environment_;
+  TestingProfile profile_;
+};
+
+TEST_F(ShieldsSettingsSnapshotCacheTest, SameCacheForProfile) {
+  ASSERT_TRUE(cache());
+  EXPECT_EQ(cache(), cache());
+}
+
+TEST_F(ShieldsSettingsSnapshotCacheTest, MatchesContentSettings) {
+  const GURL origin("https://brave.com/");
+
+  brave_shields::SetAdControlType(map(), brave_shields::ControlType::ALLOW,
+                                  origin);
+  brave_shields::SetHTTPSEverywhereEnabled(map(), false, origin);
+
+  const ShieldsSettingsSnapshot& snapshot = cache()->Get(origin);
+  EXPECT_EQ(brave_shields::GetBraveShieldsEnabled(map(), origin),
+            snapshot.shields_enabled);
+  EXPECT_TRUE(snapshot.allow_ads);
+  EXPECT_TRUE(snapshot.allow_http_upgradable_resource);
+  EXPECT_EQ(brave_shields::AreReferrersAllowed(map(), origin),
+            snapshot.allow_referrers);
+  EXPECT_EQ(cache()->version(), snapshot.version);
+}
+
+TEST_F(ShieldsSettingsSnapshotCacheTest, InvalidatedOnShieldsChange) {
+  const GURL origin("https://brave.com/");
+  const GURL other_origin("https://example.com/");
+
+  EXPECT_TRUE(cache()->Get(origin).shields_enabled);
+  EXPECT_TRUE(cache()->Get(other_origin).shields_enabled);
+  const uint64_t version = cache()->version();
+
+  brave_shields::SetBraveShieldsEnabled(map(), false, origin);
+
+  EXPECT_LT(version, cache()->version());
+  EXPECT_FALSE(cache()->Get(origin).shields_enabled);
+  EXPECT_TRUE(cache()->Get(other_origin).shields_enabled);
+  EXPECT_EQ(cache()->version(), cache()->Get(other_origin).version);
+}
+
+TEST_F(ShieldsSettingsSnapshotCacheTest, NotInvalidatedOnUnrelatedChange) {
+  const GURL origin("https://brave.com/");
+
+  cache()->Get(origin);
+  const uint64_t version = cache()->version();
+
+  map()->SetContentSettingDefaultScope(origin, GURL(),
+                                       ContentSettingsType::GEOLOCATION,
+                                       CONTENT_SETTING_BLOCK);
+
+  EXPECT_EQ(version, cache()->version());
+}
+
+}  // namespace brave
@@ -9,12 +9,10 @@
 #include <string>
 
 #include "brave/browser/brave_shields/brave_shields_web_contents_observer.h"
-#include "brave/components/brave_shields/browser/brave_shields_util.h"
+#include "brave/browser/net/shields_settings_snapshot.h"
 #include "brave/components/brave_webtorrent/browser/buildflags/buildflags.h"
 #include "brave/components/brave_webtorrent/browser/webtorrent_util.h"
 #include "brave/components/ipfs/buildflags/buildflags.h"
-#include "chrome/browser/content_settings/host_content_settings_map_factory.h"
-#include "chrome/browser/profiles/profile.h"
 #include "content/public/browser/browser_thread.h"
 #include "content/public/browser/render_frame_host.h"
 #include "net/base/isolation_info.h"
@@ -136,33 +134,36 @@ std::shared_ptr<brave::BraveRequestInfo> BraveRequestInfo::MakeCTX(
   }
 #endif
 
-  Profile* profile = Profile::FromBrowserContext(browser_context);
-  auto* map = HostContentSettingsMapFactory::GetForProfile(profile);
-  ctx->allow_brave_shields =
-      map ? brave_shields::GetBraveShieldsEnabled(map, ctx->tab_origin) : true;
-  ctx->allow_ads =
-      map ? brave_shields::GetAdControlType(map, ctx->tab_origin) ==
-                brave_shields::ControlType::ALLOW
-          : false;
-  // Currently, "aggressive" mode is registered as a cosmetic filtering control
-  // type, even though it can also affect network blocking.
-  ctx->aggressive_blocking =
-      map ? brave_shields::GetCosmeticFilteringControlType(
-                map, ctx->tab_origin) == brave_shields::ControlType::BLOCK
-          : false;
-  ctx->allow_http_upgradable_resource =
-      map ? !brave_shields::GetHTTPSEverywhereEnabled(map, ctx->tab_origin)
-          : false;
-
-  // HACK: after we fix multiple creations of BraveRequestInfo we should
-  // use only tab_origin. Since we recreate BraveRequestInfo during consequent
-  // stages of navigation, |tab_origin| changes and so does |allow_referrers|
-  // flag, which is not what we want for determining referrers.
-  ctx->allow_referrers =
-      map ? brave_shields::AreReferrersAllowed(
-                map, ctx->redirect_source.is_empty() ? ctx->tab_origin
-                                                     : ctx->redirect_source)
-          : false;
+  // Shields settings only depend on the tab origin, so they are shared by all
+  // the subresource requests of a page rather than looked up for each one.
+  auto* snapshot_cache =
+      ShieldsSettingsSnapshotCache::GetForBrowserContext(browser_context);
+  if (snapshot_cache) {
+    const ShieldsSettingsSnapshot& snapshot =
+        snapshot_cache->Get(ctx->tab_origin);
+    ctx->allow_brave_shields = snapshot.shields_enabled;
+    ctx->allow_ads = snapshot.allow_ads;
+    ctx->aggressive_blocking = snapshot.aggressive_blocking;
+    ctx->allow_http_upgradable_resource =
+        snapshot.allow_http_upgradable_resource;
+
+    // HACK: after we fix multiple creations of BraveRequestInfo we should
+    // use only tab_origin. Since we recreate BraveRequestInfo during consequent
+    // stages of navigation, |tab_origin| changes and so does |allow_referrers|
+    // flag, which is not what we want for determining referrers.
+    ctx->allow_referrers =
+        ctx->redirect_source.is_empty()
+            ? snapshot.allow_referrers
+            : snapshot_cache->Get(url::Origin::Create(ctx->redirect_source)
+                                      .GetURL())
+                  .allow_referrers;
+  } else {
+    ctx->allow_brave_shields = true;
+    ctx->allow_ads = false;
+    ctx->aggressive_blocking = false;
+    ctx->allow_http_upgradable_resource = false;
+    ctx->allow_referrers = false;
+  }
   ctx->upload_data = GetUploadData(request);
 
   ctx->browser_context = browser_context;
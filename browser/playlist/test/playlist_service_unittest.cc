@@ -5,9 +5,13 @@
 
 #include "brave/components/playlist/browser/playlist_service.h"
 
+#include "base/containers/contains.h"
 #include "base/files/file_util.h"
 #include "base/files/scoped_temp_dir.h"
+#include "base/memory/ref_counted_memory.h"
 #include "base/run_loop.h"
+#include "base/strings/string_util.h"
+#include "base/strings/stringprintf.h"
 #include "base/test/bind.h"
 #include "base/test/scoped_feature_list.h"
 #include "base/time/time.h"
@@ -16,6 +20,8 @@
 #include "brave/browser/playlist/test/mock_playlist_service_observer.h"
 #include "brave/components/playlist/browser/media_detector_component_manager.h"
 #include "brave/components/playlist/browser/playlist_constants.h"
+#include "brave/components/playlist/browser/playlist_data_source.h"
+#include "brave/components/playlist/browser/playlist_media_url_loader_factory.h"
 #include "brave/components/playlist/browser/pref_names.h"
 #include "brave/components/playlist/browser/type_converter.h"
 #include "brave/components/playlist/common/features.h"
@@ -33,11 +39,20 @@
 #include "content/public/browser/browser_task_traits.h"
 #include "content/public/browser/browser_thread.h"
 #include "content/public/test/browser_task_environment.h"
+#include "content/public/test/test_download_http_response.h"
 #include "content/public/test/test_host_resolver.h"
+#include "mojo/public/cpp/bindings/remote.h"
+#include "mojo/public/cpp/system/data_pipe_utils.h"
+#include "net/base/net_errors.h"
 #include "net/dns/mock_host_resolver.h"
+#include "net/http/http_request_headers.h"
+#include "net/http/http_response_headers.h"
 #include "net/test/embedded_test_server/embedded_test_server.h"
 #include "net/test/embedded_test_server/http_request.h"
 #include "net/test/embedded_test_server/http_response.h"
+#include "net/traffic_annotation/network_traffic_annotation_test_helper.h"
+#include "services/network/public/cpp/resource_request.h"
+#include "services/network/test/test_url_loader_client.h"
 #include "testing/gmock/include/gmock/gmock-matchers.h"
 #include "testing/gmock/include/gmock/gmock.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -110,6 +125,10 @@ class PlaylistServiceUnitTest : public testing::Test {
 
   net::EmbeddedTestServer* https_server() { return https_server_.get(); }
 
+  content::TestDownloadResponseHandler* test_download_response_handler() {
+    return &test_download_response_handler_;
+  }
+
   PrefService* prefs() { return profile_->GetPrefs(); }
 
   void WaitUntil(base::RepeatingCallback<bool()> condition) {
@@ -216,6 +235,9 @@ class PlaylistServiceUnitTest : public testing::Test {
     // Set up embedded test server to handle fake responses.
     https_server_ = std::make_unique<net::EmbeddedTestServer>(
         net::test_server::EmbeddedTestServer::TYPE_HTTP);
+    // Serves the URLs registered with TestDownloadHttpResponse::StartServing(),
+    // so it has to come before HandleRequest(), which answers everything else.
+    test_download_response_handler_.RegisterToTestServer(https_server_.get());
     https_server_->RegisterRequestHandler(base::BindRepeating(&HandleRequest));
     ASSERT_TRUE(https_server_->Start());
   }
@@ -247,6 +269,7 @@ class PlaylistServiceUnitTest : public testing::Test {
   base::test::ScopedFeatureList scoped_feature_list_;
 
   std::unique_ptr<net::EmbeddedTestServer> https_server_;
+  content::TestDownloadResponseHandler test_download_response_handler_;
   std::unique_ptr<content::TestHostResolver> host_resolver_;
 };
 
@@ -711,6 +734,254 @@ TEST_F(PlaylistServiceUnitTest, MediaFileExtension) {
   EXPECT_EQ(media_path.Extension(), FILE_PATH_LITERAL(".m3u8"));
 }
 
+TEST_F(PlaylistServiceUnitTest, DataSourceMapsMediaFile) {
+  auto* service = playlist_service();
+  const std::string id = "data-source";
+  base::FilePath media_path;
+  ASSERT_TRUE(service->GetMediaPath(id, &media_path));
+  ASSERT_TRUE(base::CreateDirectory(media_path.DirName()));
+
+  std::string contents(1024 * 1024, '\0');
+  for (size_t i = 0; i < contents.size(); ++i) {
+    contents[i] = static_cast<char>(i % 251);
+  }
+  ASSERT_TRUE(base::WriteFile(media_path, contents));
+
+  PlaylistDataSource data_source(service);
+  auto request_data = [&data_source](const std::string& path) {
+    scoped_refptr<base::RefCountedMemory> data;
+    base::RunLoop run_loop;
+    data_source.StartDataRequest(
+        GURL("chrome-untrusted://playlist-data/" + path), {},
+        base::BindLambdaForTesting(
+            [&](scoped_refptr<base::RefCountedMemory> result) {
+              data = std::move(result);
+              run_loop.Quit();
+            }));
+    run_loop.Run();
+    return data;
+  };
+
+  auto data = request_data(id + "/media");
+  ASSERT_TRUE(data);
+  EXPECT_EQ(contents, std::string(data->front_as<char>(), data->size()));
+
+  // An empty file is served as empty data.
+  const std::string empty_id = "data-source-empty";
+  ASSERT_TRUE(service->GetMediaPath(empty_id, &media_path));
+  ASSERT_TRUE(base::CreateDirectory(media_path.DirName()));
+  ASSERT_TRUE(base::WriteFile(media_path, ""));
+  data = request_data(empty_id + "/media");
+  ASSERT_TRUE(data);
+  EXPECT_EQ(0u, data->size());
+
+  // A missing file is not served.
+  EXPECT_FALSE(request_data("data-source-missing/media"));
+}
+
+TEST_F(PlaylistServiceUnitTest, MediaURLLoaderFactoryServesRanges) {
+  auto* service = playlist_service();
+  const std::string id = "media-loader";
+  base::FilePath media_path;
+  ASSERT_TRUE(service->GetMediaPath(id, &media_path));
+  ASSERT_TRUE(base::CreateDirectory(media_path.DirName()));
+
+  // Larger than a chunk, so the body is written in more than one piece.
+  std::string contents(
+      PlaylistMediaURLLoaderFactory::kMediaChunkSize * 2 + 100, '\0');
+  for (size_t i = 0; i < contents.size(); ++i) {
+    contents[i] = static_cast<char>(i % 251);
+  }
+  ASSERT_TRUE(base::WriteFile(media_path, contents));
+
+  mojo::Remote<network::mojom::URLLoaderFactory> factory(
+      PlaylistMediaURLLoaderFactory::Create(service->GetWeakPtr(), {}));
+  auto start = [&factory](const std::string& url, const std::string& range) {
+    network::ResourceRequest request;
+    request.url = GURL(url);
+    if (!range.empty()) {
+      request.headers.SetHeader(net::HttpRequestHeaders::kRange, range);
+    }
+    mojo::PendingRemote<network::mojom::URLLoader> loader;
+    auto client = std::make_unique<network::TestURLLoaderClient>();
+    factory->CreateLoaderAndStart(
+        loader.InitWithNewPipeAndPassReceiver(), 0, 0, request,
+        client->CreateRemote(),
+        net::MutableNetworkTrafficAnnotationTag(TRAFFIC_ANNOTATION_FOR_TESTS));
+    return client;
+  };
+  auto load = [&start](const std::string& url, const std::string& range,
+                       std::string* body) {
+    auto client = start(url, range);
+    client->RunUntilResponseBodyArrived();
+    EXPECT_TRUE(
+        mojo::BlockingCopyToString(client->response_body_release(), body));
+    client->RunUntilComplete();
+    return client;
+  };
+
+  // The whole file.
+  std::string body;
+  auto client = load("chrome-untrusted://playlist-data/" + id + "/media", "",
+                     &body);
+  EXPECT_EQ(net::OK, client->completion_status().error_code);
+  EXPECT_EQ(200, client->response_head()->headers->response_code());
+  EXPECT_EQ(contents, body);
+
+  // A range across chunks.
+  const size_t first = PlaylistMediaURLLoaderFactory::kMediaChunkSize - 10;
+  const size_t last = PlaylistMediaURLLoaderFactory::kMediaChunkSize * 2 + 9;
+  body.clear();
+  client = load("chrome-untrusted://playlist-data/" + id + "/media/",
+                base::StringPrintf("bytes=%zu-%zu", first, last), &body);
+  EXPECT_EQ(net::OK, client->completion_status().error_code);
+  EXPECT_EQ(206, client->response_head()->headers->response_code());
+  EXPECT_EQ(base::StringPrintf("bytes %zu-%zu/%zu", first, last,
+                               contents.size()),
+            client->response_head()->headers->GetNormalizedHeader(
+                "Content-Range"));
+  EXPECT_EQ(contents.substr(first, last - first + 1), body);
+
+  // A suffix range.
+  body.clear();
+  client = load("chrome-untrusted://playlist-data/" + id + "/media",
+                "bytes=-100", &body);
+  EXPECT_EQ(206, client->response_head()->headers->response_code());
+  EXPECT_EQ(contents.substr(contents.size() - 100), body);
+
+  // A range past the end of the file.
+  client = start("chrome-untrusted://playlist-data/" + id + "/media",
+                 base::StringPrintf("bytes=%zu-", contents.size()));
+  client->RunUntilComplete();
+  EXPECT_EQ(net::ERR_REQUEST_RANGE_NOT_SATISFIABLE,
+            client->completion_status().error_code);
+
+  // A missing file.
+  client =
+      start("chrome-untrusted://playlist-data/media-loader-missing/media", "");
+  client->RunUntilComplete();
+  EXPECT_EQ(net::ERR_FILE_NOT_FOUND, client->completion_status().error_code);
+}
+
+TEST_F(PlaylistServiceUnitTest, DownloadMediaFilesConcurrently) {
+  auto* service = playlist_service();
+  auto* download_manager = service->media_file_download_manager_.get();
+  constexpr size_t kMaxConcurrentDownloads =
+      PlaylistMediaFileDownloadManager::kMaxConcurrentDownloads;
+
+  // Only a limited number of downloads are started at once and the others
+  // wait in the queue.
+  download_manager->pause_download_for_testing_ = true;
+  for (size_t i = 0; i < kMaxConcurrentDownloads + 2; i++) {
+    auto item = GetValidCreateParams();
+    item->id = base::Token::CreateRandom().ToString();
+    service->CreatePlaylistItem(std::move(item), /* cache = */ true);
+  }
+  WaitUntil(base::BindLambdaForTesting([&]() {
+    return download_manager->current_jobs_.size() == kMaxConcurrentDownloads;
+  }));
+  EXPECT_EQ(2u, download_manager->pending_media_file_creation_jobs_.size());
+
+  download_manager->CancelAllDownloadRequests();
+  EXPECT_FALSE(download_manager->has_download_requests());
+  download_manager->pause_download_for_testing_ = false;
+
+  // All of the items are cached once the queue is drained.
+  const size_t item_count = kMaxConcurrentDownloads * 2 + 1;
+  size_t cached_count = 0;
+  testing::NiceMock<MockPlaylistServiceObserver> observer;
+  EXPECT_CALL(observer, OnEvent(PlaylistEvent::kItemCached, _))
+      .Times(item_count)
+      .WillRepeatedly([&]() { cached_count++; });
+  service->AddObserver(observer.GetRemote());
+
+  for (size_t i = 0; i < item_count; i++) {
+    auto item = GetValidCreateParams();
+    item->id = base::Token::CreateRandom().ToString();
+    service->CreatePlaylistItem(std::move(item), /* cache = */ true);
+  }
+
+  WaitUntil(base::BindLambdaForTesting(
+      [&]() { return cached_count == item_count; }));
+  EXPECT_FALSE(download_manager->has_download_requests());
+}
+
+TEST_F(PlaylistServiceUnitTest, DownloadQueueSkipsItemsInFlight) {
+  auto* service = playlist_service();
+  auto* download_manager = service->media_file_download_manager_.get();
+  download_manager->pause_download_for_testing_ = true;
+
+  auto first_item = GetValidCreateParams();
+  first_item->id = base::Token::CreateRandom().ToString();
+  service->CreatePlaylistItem(first_item.Clone(), /* cache = */ true);
+  WaitUntil(base::BindLambdaForTesting([&]() {
+    return download_manager->current_jobs_.contains(first_item->id);
+  }));
+
+  // A second job for the item being downloaded has to wait, but doesn't hold
+  // back the jobs queued after it.
+  auto job = std::make_unique<PlaylistMediaFileDownloadManager::DownloadJob>();
+  job->item = first_item.Clone();
+  download_manager->DownloadMediaFile(std::move(job));
+
+  auto second_item = GetValidCreateParams();
+  second_item->id = base::Token::CreateRandom().ToString();
+  service->CreatePlaylistItem(second_item.Clone(), /* cache = */ true);
+  WaitUntil(base::BindLambdaForTesting([&]() {
+    return download_manager->current_jobs_.contains(second_item->id);
+  }));
+  ASSERT_EQ(1u, download_manager->pending_media_file_creation_jobs_.size());
+  EXPECT_EQ(first_item->id,
+            download_manager->pending_media_file_creation_jobs_.front()
+                ->item->id);
+
+  // The waiting job starts once the first download is done.
+  download_manager->CancelDownloadRequest(first_item->id);
+  EXPECT_TRUE(download_manager->current_jobs_.contains(first_item->id));
+  EXPECT_TRUE(download_manager->pending_media_file_creation_jobs_.empty());
+
+  download_manager->CancelAllDownloadRequests();
+}
+
+TEST_F(PlaylistServiceUnitTest, ResumeInterruptedMediaFileDownload) {
+  auto* service = playlist_service();
+
+  // The connection is dropped halfway through the body, and the download is
+  // expected to continue from there with a range request.
+  const GURL media_url = https_server()->GetURL("/interrupted_media_file");
+  content::TestDownloadHttpResponse::Parameters parameters;
+  parameters.size = 1024 * 1024;
+  parameters.support_byte_ranges = true;
+  parameters.InjectErrorAt(parameters.size / 2, net::ERR_CONNECTION_RESET);
+  content::TestDownloadHttpResponse::StartServing(parameters, media_url);
+
+  auto item = GetValidCreateParams();
+  item->id = base::Token::CreateRandom().ToString();
+  item->media_source = item->media_path = media_url;
+
+  bool cached = false;
+  testing::NiceMock<MockPlaylistServiceObserver> observer;
+  EXPECT_CALL(observer, OnEvent(PlaylistEvent::kItemCached, item->id))
+      .WillOnce([&]() { cached = true; });
+  service->AddObserver(observer.GetRemote());
+
+  service->CreatePlaylistItem(item.Clone(), /* cache = */ true);
+  WaitUntil(base::BindLambdaForTesting([&]() { return cached; }));
+
+  test_download_response_handler()->WaitUntilCompletion(2u);
+  const auto& requests = test_download_response_handler()->completed_requests();
+  ASSERT_EQ(2u, requests.size());
+  EXPECT_FALSE(base::Contains(requests[0]->http_request.headers, "Range"));
+  EXPECT_LT(requests[0]->transferred_byte_count, parameters.size);
+
+  ASSERT_TRUE(base::Contains(requests[1]->http_request.headers, "Range"));
+  const std::string& range = requests[1]->http_request.headers.at("Range");
+  EXPECT_TRUE(base::StartsWith(range, "bytes=")) << range;
+  EXPECT_NE("bytes=0-", range);
+  // Only the rest of the body is transferred again.
+  EXPECT_LT(requests[1]->transferred_byte_count, parameters.size);
+}
+
 TEST_F(PlaylistServiceUnitTest, AddItemsToList) {
   auto* service = playlist_service();
 
@@ -8,12 +8,18 @@
 #include "brave/components/brave_page_graph/common/buildflags.h"
 
 #if BUILDFLAG(ENABLE_BRAVE_PAGE_GRAPH)
+#include <string>
+
+#include "base/containers/span.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/page_graph.h"
+#include "third_party/blink/renderer/platform/wtf/text/base64.h"
 #endif  // BUILDFLAG(ENABLE_BRAVE_PAGE_GRAPH)
 
 namespace blink {
 
-protocol::Response InspectorPageAgent::generatePageGraph(String* data) {
+protocol::Response InspectorPageAgent::generatePageGraph(
+    protocol::Maybe<String> format,
+    String* data) {
 #if BUILDFLAG(ENABLE_BRAVE_PAGE_GRAPH)
   LocalFrame* main_frame = inspected_frames_->Root();
   if (!main_frame) {
@@ -25,7 +31,14 @@ protocol::Response InspectorPageAgent::generatePageGraph(String* data) {
     return protocol::Response::ServerError("No Page Graph for main frame");
   }
 
-  *data = page_graph->ToGraphML();
+  if (format.isJust() &&
+      format.fromJust() ==
+          protocol::Page::GeneratePageGraph::FormatEnum::Binary) {
+    const std::string binary_graph = page_graph->ToBinaryGraph();
+    *data = WTF::Base64Encode(base::as_bytes(base::make_span(binary_graph)));
+  } else {
+    *data = page_graph->ToGraphML();
+  }
   return protocol::Response::Success();
 #else
   return protocol::Response::ServerError("Page Graph buildflag is disabled");
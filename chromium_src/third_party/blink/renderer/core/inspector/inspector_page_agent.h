@@ -10,7 +10,8 @@
 
 #define clearCompilationCache                                                  \
   NotUsed();                                                                   \
-  protocol::Response generatePageGraph(String* data) override;                 \
+  protocol::Response generatePageGraph(protocol::Maybe<String> format,         \
+                                       String* data) override;                 \
   protocol::Response generatePageGraphNodeReport(                              \
       int node_id, std::unique_ptr<protocol::Array<String>>* report) override; \
   protocol::Response clearCompilationCache
@@ -147,6 +147,18 @@ bool engine_deserialize(struct C_Engine* engine,
                         const char* data,
                         size_t data_size);
 
+/**
+ * Serializes the engine into a buffer that can later be passed to
+ * `engine_deserialize`. Returns `false` if serialization failed. On success,
+ * the buffer must be freed with `engine_serialized_data_destroy`.
+ */
+bool engine_serialize(struct C_Engine* engine, char** data, size_t* data_size);
+
+/**
+ * Destroy a buffer returned by `engine_serialize`.
+ */
+void engine_serialized_data_destroy(char* data, size_t data_size);
+
 /**
  * Destroy a `Engine` once you are done with it.
  */
@@ -293,6 +293,39 @@ pub unsafe extern "C" fn engine_deserialize(
     ok
 }
 
+/// Serializes the engine into a buffer that can later be passed to
+/// `engine_deserialize`. Returns `false` if serialization failed. On success,
+/// the buffer must be freed with `engine_serialized_data_destroy`.
+#[no_mangle]
+pub unsafe extern "C" fn engine_serialize(
+    engine: *mut Engine,
+    data: *mut *mut c_char,
+    data_size: *mut size_t,
+) -> bool {
+    assert!(!engine.is_null());
+    let engine = Box::leak(Box::from_raw(engine));
+    match engine.serialize_raw() {
+        Ok(serialized) => {
+            let serialized = serialized.into_boxed_slice();
+            *data_size = serialized.len();
+            *data = Box::into_raw(serialized) as *mut c_char;
+            true
+        }
+        Err(_) => {
+            eprintln!("Error serializing adblock engine");
+            false
+        }
+    }
+}
+
+/// Destroy a buffer returned by `engine_serialize`.
+#[no_mangle]
+pub unsafe extern "C" fn engine_serialized_data_destroy(data: *mut c_char, data_size: size_t) {
+    if !data.is_null() {
+        drop(Box::from_raw(std::slice::from_raw_parts_mut(data as *mut u8, data_size)));
+    }
+}
+
 /// Destroy a `Engine` once you are done with it.
 #[no_mangle]
 pub unsafe extern "C" fn engine_destroy(engine: *mut Engine) {
@@ -137,6 +137,17 @@ bool Engine::deserialize(const char* data, size_t data_size) {
   return engine_deserialize(raw, data, data_size);
 }
 
+std::vector<unsigned char> Engine::serialize() {
+  char* data = nullptr;
+  size_t data_size = 0;
+  if (!engine_serialize(raw, &data, &data_size)) {
+    return {};
+  }
+  std::vector<unsigned char> result(data, data + data_size);
+  engine_serialized_data_destroy(data, data_size);
+  return result;
+}
+
 void Engine::addTag(const std::string& tag) {
   engine_add_tag(raw, tag.c_str());
 }
@@ -113,6 +113,8 @@ class ADBLOCK_EXPORT Engine {
                                bool is_third_party,
                                const std::string& resource_type);
   bool deserialize(const char* data, size_t data_size);
+  // Returns an empty buffer on failure.
+  std::vector<unsigned char> serialize();
   void addTag(const std::string& tag);
   void addResource(const std::string& key,
                    const std::string& content_type,
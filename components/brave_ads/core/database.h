@@ -7,7 +7,9 @@
 #define BRAVE_COMPONENTS_BRAVE_ADS_CORE_DATABASE_H_
 
 #include <memory>
+#include <string>
 
+#include "base/containers/lru_cache.h"
 #include "base/files/file_path.h"
 #include "base/memory/memory_pressure_listener.h"
 #include "base/memory/weak_ptr.h"
@@ -16,6 +18,7 @@
 #include "brave/components/brave_ads/core/export.h"
 #include "sql/database.h"
 #include "sql/meta_table.h"
+#include "sql/statement.h"
 
 namespace brave_ads {
 
@@ -52,6 +55,11 @@ class ADS_EXPORT Database final {
   mojom::DBCommandResponseInfo::StatusType Migrate(int version,
                                                    int compatible_version);
 
+  // Returns a prepared statement for |sql| with no bound values, reusing the
+  // statement from a previous command with the same |sql| if possible, or
+  // nullptr if |sql| is invalid.
+  sql::Statement* GetCachedStatement(const std::string& sql);
+
   void ErrorCallback(int error, sql::Statement* statement);
 
   void MemoryPressureListenerCallback(
@@ -60,6 +68,12 @@ class ADS_EXPORT Database final {
   base::FilePath db_path_;
   sql::Database db_;
   sql::MetaTable meta_table_;
+
+  // Keyed by SQL, as commands are built at runtime and cannot be identified by
+  // sql::StatementID. Declared after |db_| so that statements are released
+  // before the database is closed.
+  base::LRUCache<std::string, std::unique_ptr<sql::Statement>>
+      statement_cache_;
   bool is_initialized_ = false;
 
   std::unique_ptr<base::MemoryPressureListener> memory_pressure_listener_;
@@ -17,6 +17,7 @@ mojom::DBRecordInfoPtr CreateRecord(
   CHECK(statement);
 
   mojom::DBRecordInfoPtr record = mojom::DBRecordInfo::New();
+  record->fields.reserve(bindings.size());
 
   int column = 0;
 
@@ -19,7 +19,16 @@
 
 namespace brave_ads {
 
-Database::Database(base::FilePath path) : db_path_(std::move(path)) {
+namespace {
+
+// Commands are built from a fixed set of queries, but the number of
+// placeholders in some of them depends on their bindings.
+constexpr size_t kStatementCacheSize = 64;
+
+}  // namespace
+
+Database::Database(base::FilePath path)
+    : db_path_(std::move(path)), statement_cache_(kStatementCacheSize) {
   DETACH_FROM_SEQUENCE(sequence_checker_);
 
   db_.set_error_callback(base::BindRepeating(&Database::ErrorCallback,
@@ -157,18 +166,19 @@ mojom::DBCommandResponseInfo::StatusType Database::Run(
     return mojom::DBCommandResponseInfo::StatusType::INITIALIZATION_ERROR;
   }
 
-  sql::Statement statement;
-  statement.Assign(db_.GetUniqueStatement(command->sql.c_str()));
-  if (!statement.is_valid()) {
+  sql::Statement* const statement = GetCachedStatement(command->sql);
+  if (!statement) {
     VLOG(0) << "Database store error: Invalid statement";
     return mojom::DBCommandResponseInfo::StatusType::COMMAND_ERROR;
   }
 
   for (const auto& binding : command->bindings) {
-    database::Bind(&statement, *binding);
+    database::Bind(statement, *binding);
   }
 
-  if (!statement.Run()) {
+  const bool success = statement->Run();
+  statement->Reset(/*clear_bound_vars*/ true);
+  if (!success) {
     return mojom::DBCommandResponseInfo::StatusType::COMMAND_ERROR;
   }
 
@@ -185,25 +195,28 @@ mojom::DBCommandResponseInfo::StatusType Database::Read(
     return mojom::DBCommandResponseInfo::StatusType::INITIALIZATION_ERROR;
   }
 
-  sql::Statement statement;
-  statement.Assign(db_.GetUniqueStatement(command->sql.c_str()));
-  if (!statement.is_valid()) {
+  sql::Statement* const statement = GetCachedStatement(command->sql);
+  if (!statement) {
     VLOG(0) << "Database store error: Invalid statement";
     return mojom::DBCommandResponseInfo::StatusType::COMMAND_ERROR;
   }
 
   for (const auto& binding : command->bindings) {
-    database::Bind(&statement, *binding);
+    database::Bind(statement, *binding);
   }
 
   command_response->result =
       mojom::DBCommandResult::NewRecords(std::vector<mojom::DBRecordInfoPtr>());
 
-  while (statement.Step()) {
+  while (statement->Step()) {
     command_response->result->get_records().push_back(
-        database::CreateRecord(&statement, command->record_bindings));
+        database::CreateRecord(statement, command->record_bindings));
   }
 
+  // Release the bound values and finish the read before the statement is
+  // cached for later commands.
+  statement->Reset(/*clear_bound_vars*/ true);
+
   return mojom::DBCommandResponseInfo::StatusType::RESPONSE_OK;
 }
 
@@ -222,6 +235,28 @@ mojom::DBCommandResponseInfo::StatusType Database::Migrate(
   return mojom::DBCommandResponseInfo::StatusType::RESPONSE_OK;
 }
 
+sql::Statement* Database::GetCachedStatement(const std::string& sql) {
+  const auto iter = statement_cache_.Get(sql);
+  if (iter != statement_cache_.end()) {
+    sql::Statement* const statement = iter->second.get();
+    if (statement->is_valid()) {
+      statement->Reset(/*clear_bound_vars*/ true);
+      return statement;
+    }
+
+    // The database was closed or poisoned since the statement was prepared.
+    statement_cache_.Erase(iter);
+  }
+
+  auto statement =
+      std::make_unique<sql::Statement>(db_.GetUniqueStatement(sql.c_str()));
+  if (!statement->is_valid()) {
+    return nullptr;
+  }
+
+  return statement_cache_.Put(sql, std::move(statement))->second.get();
+}
+
 void Database::ErrorCallback(const int error, sql::Statement* statement) {
   VLOG(0) << "Database error: " << db_.GetDiagnosticInfo(error, statement);
 }
@@ -230,6 +265,7 @@ void Database::MemoryPressureListenerCallback(
     base::MemoryPressureListener::
         MemoryPressureLevel /*memory_pressure_level*/) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  statement_cache_.Clear();
   db_.TrimMemory();
 }
 
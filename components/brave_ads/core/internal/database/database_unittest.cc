@@ -0,0 +1,139 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/database.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/files/scoped_temp_dir.h"
+#include "brave/components/brave_ads/common/interfaces/brave_ads.mojom.h"
+#include "brave/components/brave_ads/core/internal/common/database/database_bind_util.h"
+#include "brave/components/brave_ads/core/internal/common/unittest/unittest_base.h"
+
+// npm run test -- brave_unit_tests --filter=BraveAds*
+
+namespace brave_ads {
+
+namespace {
+
+mojom::DBCommandInfoPtr BuildCommand(const mojom::DBCommandInfo::Type type,
+                                     const std::string& sql) {
+  mojom::DBCommandInfoPtr command = mojom::DBCommandInfo::New();
+  command->type = type;
+  command->sql = sql;
+  return command;
+}
+
+mojom::DBCommandInfoPtr BuildInsertCommand(const int value) {
+  mojom::DBCommandInfoPtr command =
+      BuildCommand(mojom::DBCommandInfo::Type::RUN,
+                   "INSERT INTO numbers (value) VALUES (?)");
+  database::BindInt(&*command, 0, value);
+  return command;
+}
+
+mojom::DBCommandInfoPtr BuildSelectCommand() {
+  mojom::DBCommandInfoPtr command =
+      BuildCommand(mojom::DBCommandInfo::Type::READ,
+                   "SELECT value FROM numbers WHERE value >= ? ORDER BY value");
+  command->record_bindings = {
+      mojom::DBCommandInfo::RecordBindingType::INT_TYPE};
+  return command;
+}
+
+}  // namespace
+
+class BraveAdsDatabaseTest : public UnitTestBase {
+ protected:
+  void SetUp() override {
+    UnitTestBase::SetUp();
+
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    database_ = std::make_unique<Database>(
+        temp_dir_.GetPath().AppendASCII("database.sqlite"));
+
+    mojom::DBTransactionInfoPtr transaction = mojom::DBTransactionInfo::New();
+    transaction->version = 1;
+    transaction->compatible_version = 1;
+    transaction->commands.push_back(
+        BuildCommand(mojom::DBCommandInfo::Type::INITIALIZE, ""));
+    transaction->commands.push_back(
+        BuildCommand(mojom::DBCommandInfo::Type::EXECUTE,
+                     "CREATE TABLE numbers (value INTEGER NOT NULL)"));
+    ASSERT_EQ(mojom::DBCommandResponseInfo::StatusType::RESPONSE_OK,
+              RunTransaction(std::move(transaction))->status);
+  }
+
+  mojom::DBCommandResponseInfoPtr RunTransaction(
+      mojom::DBTransactionInfoPtr transaction) {
+    mojom::DBCommandResponseInfoPtr command_response =
+        mojom::DBCommandResponseInfo::New();
+    command_response->status =
+        mojom::DBCommandResponseInfo::StatusType::RESPONSE_OK;
+    database_->RunTransaction(std::move(transaction), command_response.get());
+    return command_response;
+  }
+
+  base::ScopedTempDir temp_dir_;
+  std::unique_ptr<Database> database_;
+};
+
+TEST_F(BraveAdsDatabaseTest, ReuseStatements) {
+  // Arrange
+  mojom::DBTransactionInfoPtr transaction = mojom::DBTransactionInfo::New();
+  for (int i = 0; i < 10; ++i) {
+    transaction->commands.push_back(BuildInsertCommand(i));
+  }
+  ASSERT_EQ(mojom::DBCommandResponseInfo::StatusType::RESPONSE_OK,
+            RunTransaction(std::move(transaction))->status);
+
+  // Act
+  mojom::DBTransactionInfoPtr read_transaction =
+      mojom::DBTransactionInfo::New();
+  mojom::DBCommandInfoPtr command = BuildSelectCommand();
+  database::BindInt(&*command, 0, 7);
+  read_transaction->commands.push_back(std::move(command));
+  const mojom::DBCommandResponseInfoPtr command_response =
+      RunTransaction(std::move(read_transaction));
+
+  // Assert
+  ASSERT_EQ(mojom::DBCommandResponseInfo::StatusType::RESPONSE_OK,
+            command_response->status);
+  ASSERT_TRUE(command_response->result);
+  const std::vector<mojom::DBRecordInfoPtr>& records =
+      command_response->result->get_records();
+  ASSERT_EQ(3U, records.size());
+  EXPECT_EQ(7, records[0]->fields.at(0)->get_int_value());
+  EXPECT_EQ(9, records[2]->fields.at(0)->get_int_value());
+}
+
+TEST_F(BraveAdsDatabaseTest, DoNotReuseBoundValues) {
+  // Arrange
+  mojom::DBTransactionInfoPtr transaction = mojom::DBTransactionInfo::New();
+  transaction->commands.push_back(BuildInsertCommand(1));
+  mojom::DBCommandInfoPtr command = BuildSelectCommand();
+  database::BindInt(&*command, 0, 0);
+  transaction->commands.push_back(std::move(command));
+  ASSERT_EQ(mojom::DBCommandResponseInfo::StatusType::RESPONSE_OK,
+            RunTransaction(std::move(transaction))->status);
+
+  // Act
+  mojom::DBTransactionInfoPtr read_transaction =
+      mojom::DBTransactionInfo::New();
+  read_transaction->commands.push_back(BuildSelectCommand());
+  const mojom::DBCommandResponseInfoPtr command_response =
+      RunTransaction(std::move(read_transaction));
+
+  // Assert
+  ASSERT_EQ(mojom::DBCommandResponseInfo::StatusType::RESPONSE_OK,
+            command_response->status);
+  ASSERT_TRUE(command_response->result);
+  EXPECT_TRUE(command_response->result->get_records().empty());
+}
+
+}  // namespace brave_ads
@@ -5,6 +5,7 @@
 
 #include "brave/components/brave_ads/core/internal/ml/data/vector_data.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <limits>
 #include <numeric>
@@ -50,6 +51,9 @@ class VectorDataStorage {
     return points_[index];
   }
 
+  bool IsDense() const { return points_.empty(); }
+  const std::vector<uint32_t>& points() const { return points_; }
+
   std::vector<float>& values() { return values_; }
   const std::vector<float>& values() const { return values_; }
   size_t DimensionCount() const { return dimension_count_; }
@@ -94,6 +98,26 @@ VectorData::VectorData(const size_t dimension_count,
       dimension_count, std::move(points), std::move(values));
 }
 
+VectorData::VectorData(const size_t dimension_count,
+                       const std::vector<uint32_t>& counts)
+    : Data(DataType::kVector) {
+  CHECK_EQ(dimension_count, counts.size());
+  const size_t non_zero_count =
+      counts.size() - static_cast<size_t>(base::ranges::count(counts, 0u));
+  std::vector<uint32_t> points;
+  points.reserve(non_zero_count);
+  std::vector<float> values;
+  values.reserve(non_zero_count);
+  for (size_t i = 0; i < counts.size(); ++i) {
+    if (counts[i] != 0) {
+      points.push_back(static_cast<uint32_t>(i));
+      values.push_back(static_cast<float>(counts[i]));
+    }
+  }
+  storage_ = std::make_unique<VectorDataStorage>(
+      dimension_count, std::move(points), std::move(values));
+}
+
 VectorData::~VectorData() = default;
 
 VectorData& VectorData::operator=(const VectorData& vector_data) {
@@ -115,20 +139,47 @@ float operator*(const VectorData& lhs, const VectorData& rhs) {
     return std::numeric_limits<float>::quiet_NaN();
   }
 
+  const VectorDataStorage& lhs_storage = *lhs.storage_;
+  const VectorDataStorage& rhs_storage = *rhs.storage_;
+  const std::vector<float>& lhs_values = lhs_storage.values();
+  const std::vector<float>& rhs_values = rhs_storage.values();
+
   float dot_product = 0.0;
+
+  if (lhs_storage.IsDense() && rhs_storage.IsDense()) {
+    const size_t size = std::min(lhs_values.size(), rhs_values.size());
+    for (size_t i = 0; i < size; ++i) {
+      dot_product += lhs_values[i] * rhs_values[i];
+    }
+    return dot_product;
+  }
+
+  if (lhs_storage.IsDense() || rhs_storage.IsDense()) {
+    const bool is_lhs_dense = lhs_storage.IsDense();
+    const VectorDataStorage& sparse = is_lhs_dense ? rhs_storage : lhs_storage;
+    const std::vector<float>& dense_values =
+        is_lhs_dense ? lhs_values : rhs_values;
+    const std::vector<uint32_t>& points = sparse.points();
+    for (size_t i = 0; i < points.size(); ++i) {
+      if (points[i] < dense_values.size()) {
+        dot_product += dense_values[points[i]] * sparse.values()[i];
+      }
+    }
+    return dot_product;
+  }
+
   size_t lhs_index = 0;
   size_t rhs_index = 0;
-  while (lhs_index < lhs.storage_->GetSize() &&
-         rhs_index < rhs.storage_->GetSize()) {
-    if (lhs.storage_->GetPointAt(lhs_index) ==
-        rhs.storage_->GetPointAt(rhs_index)) {
-      dot_product +=
-          lhs.storage_->values()[lhs_index] * rhs.storage_->values()[rhs_index];
+  while (lhs_index < lhs_storage.GetSize() &&
+         rhs_index < rhs_storage.GetSize()) {
+    if (lhs_storage.GetPointAt(lhs_index) ==
+        rhs_storage.GetPointAt(rhs_index)) {
+      dot_product += lhs_values[lhs_index] * rhs_values[rhs_index];
       ++lhs_index;
       ++rhs_index;
     } else {
-      if (lhs.storage_->GetPointAt(lhs_index) <
-          rhs.storage_->GetPointAt(rhs_index)) {
+      if (lhs_storage.GetPointAt(lhs_index) <
+          rhs_storage.GetPointAt(rhs_index)) {
         ++lhs_index;
       } else {
         ++rhs_index;
@@ -148,6 +199,17 @@ void VectorData::AddElementWise(const VectorData& other) {
     return;
   }
 
+  std::vector<float>& values = storage_->values();
+  const std::vector<float>& other_values = other.storage_->values();
+
+  if (storage_->IsDense() && other.storage_->IsDense()) {
+    const size_t size = std::min(values.size(), other_values.size());
+    for (size_t i = 0; i < size; ++i) {
+      values[i] += other_values[i];
+    }
+    return;
+  }
+
   size_t index = 0;
   size_t other_index = 0;
   while (index < storage_->GetSize() &&
@@ -221,4 +283,20 @@ const std::vector<float>& VectorData::GetData() const {
   return storage_->values();
 }
 
+void VectorData::ForEachElement(
+    base::FunctionRef<void(uint32_t point, float value)> callback) const {
+  const std::vector<float>& values = storage_->values();
+  if (storage_->IsDense()) {
+    for (size_t i = 0; i < values.size(); ++i) {
+      callback(static_cast<uint32_t>(i), values[i]);
+    }
+    return;
+  }
+
+  const std::vector<uint32_t>& points = storage_->points();
+  for (size_t i = 0; i < points.size(); ++i) {
+    callback(points[i], values[i]);
+  }
+}
+
 }  // namespace brave_ads::ml
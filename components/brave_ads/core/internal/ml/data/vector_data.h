@@ -12,6 +12,7 @@
 #include <string>
 #include <vector>
 
+#include "base/functional/function_ref.h"
 #include "brave/components/brave_ads/core/internal/ml/data/data.h"
 
 namespace brave_ads::ml {
@@ -28,6 +29,10 @@ class VectorData final : public Data {
   // double is used for backward compatibility with the current code.
   VectorData(size_t dimension_count, const std::map<uint32_t, double>& data);
 
+  // Make a "sparse" DataVector from the non-zero entries of |counts|, which
+  // has |dimension_count| elements.
+  VectorData(size_t dimension_count, const std::vector<uint32_t>& counts);
+
   // Explicit copy assignment && move operators is required because the class
   // inherits const member type_ that cannot be copied by default
   VectorData(const VectorData& vector_data);
@@ -55,6 +60,10 @@ class VectorData final : public Data {
 
   const std::vector<float>& GetData() const;
 
+  // Runs |callback| for every stored element, in increasing point order.
+  void ForEachElement(
+      base::FunctionRef<void(uint32_t point, float value)> callback) const;
+
  private:
   std::unique_ptr<class VectorDataStorage> storage_;
 };
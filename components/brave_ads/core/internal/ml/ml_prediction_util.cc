@@ -12,21 +12,35 @@
 namespace brave_ads::ml {
 
 PredictionMap Softmax(const PredictionMap& predictions) {
-  double maximum = -std::numeric_limits<double>::infinity();
+  std::vector<double> values;
+  values.reserve(predictions.size());
   for (const auto& prediction : predictions) {
-    maximum = std::max(maximum, prediction.second);
+    values.push_back(prediction.second);
   }
+  Softmax(values);
+
   PredictionMap softmax_predictions;
-  double sum_exp = 0.0;
+  size_t i = 0;
   for (const auto& prediction : predictions) {
-    const double val = std::exp(prediction.second - maximum);
-    softmax_predictions[prediction.first] = val;
-    sum_exp += val;
-  }
-  for (auto& prediction : softmax_predictions) {
-    prediction.second /= sum_exp;
+    softmax_predictions.emplace_hint(softmax_predictions.cend(),
+                                     prediction.first, values[i++]);
   }
   return softmax_predictions;
 }
 
+void Softmax(std::vector<double>& predictions) {
+  double maximum = -std::numeric_limits<double>::infinity();
+  for (const double prediction : predictions) {
+    maximum = std::max(maximum, prediction);
+  }
+  double sum_exp = 0.0;
+  for (double& prediction : predictions) {
+    prediction = std::exp(prediction - maximum);
+    sum_exp += prediction;
+  }
+  for (double& prediction : predictions) {
+    prediction /= sum_exp;
+  }
+}
+
 }  // namespace brave_ads::ml
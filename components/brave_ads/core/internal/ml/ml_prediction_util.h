@@ -6,11 +6,14 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_ML_ML_PREDICTION_UTIL_H_
 #define BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_ML_ML_PREDICTION_UTIL_H_
 
+#include <vector>
+
 #include "brave/components/brave_ads/core/internal/ml/ml_alias.h"
 
 namespace brave_ads::ml {
 
 PredictionMap Softmax(const PredictionMap& predictions);
+void Softmax(std::vector<double>& predictions);
 
 }  // namespace brave_ads::ml
 
@@ -5,9 +5,12 @@
 
 #include "brave/components/brave_ads/core/internal/ml/model/linear/linear.h"
 
+#include <functional>
+#include <limits>
 #include <utility>
 #include <vector>
 
+#include "base/check_op.h"
 #include "base/containers/adapters.h"
 #include "base/ranges/algorithm.h"
 #include "brave/components/brave_ads/core/internal/ml/ml_prediction_util.h"
@@ -16,10 +19,43 @@ namespace brave_ads::ml {
 
 LinearModel::LinearModel() = default;
 
-LinearModel::LinearModel(std::map<std::string, VectorData> weights,
-                         std::map<std::string, double> biases) {
-  weights_ = std::move(weights);
-  biases_ = std::move(biases);
+LinearModel::LinearModel(const std::map<std::string, VectorData>& weights,
+                         const std::map<std::string, double>& biases) {
+  if (weights.empty()) {
+    return;
+  }
+
+  dimension_count_ = weights.cbegin()->second.GetDimensionCount();
+  const size_t segment_count = weights.size();
+  segments_.reserve(segment_count);
+  biases_.reserve(segment_count);
+  weights_.resize(dimension_count_ * segment_count);
+
+  for (const auto& [segment, segment_weights] : weights) {
+    CHECK_EQ(dimension_count_, segment_weights.GetDimensionCount());
+    const size_t column = segments_.size();
+    segment_weights.ForEachElement([&](uint32_t point, float value) {
+      weights_[point * segment_count + column] = value;
+    });
+    segments_.push_back(segment);
+    const auto iter = biases.find(segment);
+    biases_.push_back(iter != biases.cend() ? iter->second : 0.0);
+  }
+}
+
+LinearModel::LinearModel(std::vector<std::string> segments,
+                         std::vector<float> weights,
+                         std::vector<double> biases)
+    : segments_(std::move(segments)),
+      weights_(std::move(weights)),
+      biases_(std::move(biases)) {
+  CHECK_EQ(segments_.size(), biases_.size());
+  CHECK(base::ranges::adjacent_find(segments_, std::greater_equal<>()) ==
+        segments_.cend());
+  if (!segments_.empty()) {
+    CHECK_EQ(0U, weights_.size() % segments_.size());
+    dimension_count_ = weights_.size() / segments_.size();
+  }
 }
 
 LinearModel::LinearModel(const LinearModel& other) = default;
@@ -32,27 +68,50 @@ LinearModel& LinearModel::operator=(LinearModel&& other) noexcept = default;
 
 LinearModel::~LinearModel() = default;
 
+std::vector<double> LinearModel::ComputeScores(const VectorData& x) const {
+  const size_t segment_count = segments_.size();
+  if (x.IsEmpty() || x.GetDimensionCount() != dimension_count_) {
+    return std::vector<double>(segment_count,
+                               std::numeric_limits<double>::quiet_NaN());
+  }
+
+  std::vector<float> dot_products(segment_count);
+  x.ForEachElement([&](uint32_t point, float value) {
+    if (point >= dimension_count_) {
+      return;
+    }
+    const float* const point_weights = &weights_[point * segment_count];
+    for (size_t i = 0; i < segment_count; ++i) {
+      dot_products[i] += point_weights[i] * value;
+    }
+  });
+
+  std::vector<double> scores(segment_count);
+  for (size_t i = 0; i < segment_count; ++i) {
+    scores[i] = dot_products[i] + biases_[i];
+  }
+  return scores;
+}
+
 PredictionMap LinearModel::Predict(const VectorData& x) const {
+  const std::vector<double> scores = ComputeScores(x);
   PredictionMap predictions;
-  for (const auto& kv : weights_) {
-    double prediction = kv.second * x;
-    const auto iter = biases_.find(kv.first);
-    if (iter != biases_.cend()) {
-      prediction += iter->second;
-    }
-    predictions[kv.first] = prediction;
+  for (size_t i = 0; i < segments_.size(); ++i) {
+    predictions.emplace_hint(predictions.cend(), segments_[i], scores[i]);
   }
   return predictions;
 }
 
 PredictionMap LinearModel::GetTopPredictions(const VectorData& x,
                                              const int top_count) const {
-  const PredictionMap prediction_map = Predict(x);
-  const PredictionMap prediction_map_softmax = Softmax(prediction_map);
+  std::vector<double> scores = ComputeScores(x);
+
+  Softmax(scores);
+
   std::vector<std::pair<double, std::string>> prediction_order;
-  prediction_order.reserve(prediction_map_softmax.size());
-  for (const auto& prediction : prediction_map_softmax) {
-    prediction_order.emplace_back(prediction.second, prediction.first);
+  prediction_order.reserve(scores.size());
+  for (size_t i = 0; i < scores.size(); ++i) {
+    prediction_order.emplace_back(scores[i], segments_[i]);
   }
   base::ranges::sort(base::Reversed(prediction_order));
   PredictionMap top_predictions;
@@ -8,6 +8,7 @@
 
 #include <map>
 #include <string>
+#include <vector>
 
 #include "brave/components/brave_ads/core/internal/ml/data/vector_data.h"
 #include "brave/components/brave_ads/core/internal/ml/ml_alias.h"
@@ -19,8 +20,13 @@ class LinearModel final {
   LinearModel();
 
   explicit LinearModel(const std::string& model);
-  LinearModel(std::map<std::string, VectorData> weights,
-              std::map<std::string, double> biases);
+  LinearModel(const std::map<std::string, VectorData>& weights,
+              const std::map<std::string, double>& biases);
+  // |segments| must be sorted and unique, and |weights| packed as described
+  // for |weights_|.
+  LinearModel(std::vector<std::string> segments,
+              std::vector<float> weights,
+              std::vector<double> biases);
 
   LinearModel(const LinearModel&);
   LinearModel& operator=(const LinearModel&);
@@ -30,14 +36,25 @@ class LinearModel final {
 
   ~LinearModel();
 
+  // Every weight vector must have the same dimension count.
   PredictionMap Predict(const VectorData& x) const;
 
   PredictionMap GetTopPredictions(const VectorData& x,
                                   int top_count = -1) const;
 
  private:
-  std::map<std::string, VectorData> weights_;
-  std::map<std::string, double> biases_;
+  // Scores |x| against every segment in a single pass over its elements, in
+  // the order of |segments_|.
+  std::vector<double> ComputeScores(const VectorData& x) const;
+
+  // Sorted segment names.
+  std::vector<std::string> segments_;
+  // Packed |dimension_count_| x |segments_.size()| weight matrix: the weights
+  // of every segment for a given dimension are contiguous, so each non-zero
+  // element of the input updates all scores with a single vectorizable loop.
+  std::vector<float> weights_;
+  std::vector<double> biases_;
+  size_t dimension_count_ = 0;
 };
 
 }  // namespace brave_ads::ml
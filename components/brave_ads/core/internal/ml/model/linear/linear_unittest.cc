@@ -5,6 +5,7 @@
 
 #include "brave/components/brave_ads/core/internal/ml/model/linear/linear.h"
 
+#include <cmath>
 #include <vector>
 
 #include "brave/components/brave_ads/core/internal/common/unittest/unittest_base.h"
@@ -129,4 +130,54 @@ TEST_F(BraveAdsLinearTest, TopPredictionsTest) {
   EXPECT_EQ(kPredictionLimits[1], predictions_3.size());
 }
 
+TEST_F(BraveAdsLinearTest, SparseInputPredictionTest) {
+  // Arrange
+  const std::map<std::string, VectorData> weights = {
+      {"class_1", VectorData({0.5, 0.0, 1.5, 2.0, 0.0})},
+      {"class_2", VectorData({0.0, 3.0, 0.25, 0.0, 1.0})},
+      {"class_3",
+       VectorData(5, std::map<uint32_t, double>{{1, 0.5}, {4, 2.0}})}};
+
+  const std::map<std::string, double> biases = {{"class_1", 0.1},
+                                                {"class_2", -0.2}};
+
+  const LinearModel linear(weights, biases);
+  const VectorData sparse_vector_data(
+      5, std::map<uint32_t, double>{{0, 2.0}, {2, 4.0}, {4, 1.0}});
+
+  // Act
+  const PredictionMap predictions = linear.Predict(sparse_vector_data);
+
+  // Assert
+  ASSERT_EQ(weights.size(), predictions.size());
+  for (const auto& [segment, segment_weights] : weights) {
+    const auto iter = biases.find(segment);
+    const double bias = iter != biases.cend() ? iter->second : 0.0;
+    EXPECT_DOUBLE_EQ(segment_weights * sparse_vector_data + bias,
+                     predictions.at(segment));
+  }
+}
+
+TEST_F(BraveAdsLinearTest, MismatchedDimensionsPredictionTest) {
+  // Arrange
+  const std::map<std::string, VectorData> weights = {
+      {"class_1", VectorData({1.0, 0.0, 0.0})},
+      {"class_2", VectorData({0.0, 1.0, 0.0})}};
+
+  const std::map<std::string, double> biases = {{"class_1", 0.0},
+                                                {"class_2", 0.0}};
+
+  const LinearModel linear(weights, biases);
+  const VectorData vector_data({1.0, 1.0});
+
+  // Act
+  const PredictionMap predictions = linear.Predict(vector_data);
+
+  // Assert
+  ASSERT_EQ(weights.size(), predictions.size());
+  for (const auto& [segment, prediction] : predictions) {
+    EXPECT_TRUE(std::isnan(prediction));
+  }
+}
+
 }  // namespace brave_ads::ml
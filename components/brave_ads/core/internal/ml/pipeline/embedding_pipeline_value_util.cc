@@ -5,11 +5,15 @@
 
 #include "brave/components/brave_ads/core/internal/ml/pipeline/embedding_pipeline_value_util.h"
 
+#include <cstdint>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include "base/check.h"
+#include "base/numerics/safe_conversions.h"
 #include "brave/components/brave_ads/core/internal/ml/pipeline/embedding_pipeline_info.h"
+#include "brave/components/brave_ads/core/internal/resources/binary_resource_reader.h"
 
 namespace {
 
@@ -78,4 +82,52 @@ absl::optional<EmbeddingPipelineInfo> EmbeddingPipelineFromValue(
   return embedding_pipeline;
 }
 
+absl::optional<EmbeddingPipelineInfo> EmbeddingPipelineFromBinary(
+    BinaryResourceReader& reader) {
+  EmbeddingPipelineInfo embedding_pipeline;
+
+  std::string timestamp;
+  uint32_t dimension = 0;
+  if (!reader.ReadInt(&embedding_pipeline.version) ||
+      !reader.ReadString(&timestamp) ||
+      !reader.ReadString(&embedding_pipeline.locale) ||
+      !reader.ReadUint32(&dimension)) {
+    return absl::nullopt;
+  }
+
+  if (!timestamp.empty() &&
+      !base::Time::FromUTCString(timestamp.c_str(), &embedding_pipeline.time)) {
+    return absl::nullopt;
+  }
+
+  if (dimension <= 1 || !base::IsValueInRangeForNumericType<int>(dimension)) {
+    return absl::nullopt;
+  }
+  embedding_pipeline.dimension = static_cast<int>(dimension);
+
+  size_t token_count = 0;
+  if (!reader.ReadCount(/*min_item_size*/ sizeof(uint32_t), &token_count) ||
+      token_count == 0) {
+    return absl::nullopt;
+  }
+
+  for (size_t i = 0; i < token_count; ++i) {
+    std::string token;
+    std::vector<float> embedding;
+    if (!reader.ReadString(&token) ||
+        !reader.ReadFloats(dimension, &embedding)) {
+      return absl::nullopt;
+    }
+
+    embedding_pipeline.embeddings.insert_or_assign(
+        std::move(token), VectorData(std::move(embedding)));
+  }
+
+  if (!reader.IsAtEnd()) {
+    return absl::nullopt;
+  }
+
+  return embedding_pipeline;
+}
+
 }  // namespace brave_ads::ml::pipeline
@@ -9,6 +9,10 @@
 #include "base/values.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
 
+namespace brave_ads {
+class BinaryResourceReader;
+}  // namespace brave_ads
+
 namespace brave_ads::ml::pipeline {
 
 struct EmbeddingPipelineInfo;
@@ -16,6 +20,12 @@ struct EmbeddingPipelineInfo;
 absl::optional<EmbeddingPipelineInfo> EmbeddingPipelineFromValue(
     const base::Value::Dict& dict);
 
+// Parses an embedding pipeline encoded as:
+//   int version, string timestamp, string locale, uint32 dimension,
+//   list of {string token, float embedding[dimension]}.
+absl::optional<EmbeddingPipelineInfo> EmbeddingPipelineFromBinary(
+    BinaryResourceReader& reader);
+
 }  // namespace brave_ads::ml::pipeline
 
 #endif  // BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_ML_PIPELINE_EMBEDDING_PIPELINE_VALUE_UTIL_H_
@@ -5,12 +5,15 @@
 
 #include "brave/components/brave_ads/core/internal/ml/pipeline/pipeline_util.h"
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "base/numerics/checked_math.h"
+#include "base/ranges/algorithm.h"
 #include "base/values.h"
 #include "brave/components/brave_ads/core/internal/ml/data/vector_data.h"
 #include "brave/components/brave_ads/core/internal/ml/ml_alias.h"
@@ -18,6 +21,7 @@
 #include "brave/components/brave_ads/core/internal/ml/transformation/hashed_ngrams_transformation.h"
 #include "brave/components/brave_ads/core/internal/ml/transformation/lowercase_transformation.h"
 #include "brave/components/brave_ads/core/internal/ml/transformation/normalization_transformation.h"
+#include "brave/components/brave_ads/core/internal/resources/binary_resource_reader.h"
 
 namespace brave_ads::ml::pipeline {
 
@@ -59,7 +63,7 @@ absl::optional<TransformationVector> ParsePipelineTransformations(
 
       const absl::optional<int> num_buckets =
           params_dict->FindInt("num_buckets");
-      if (!num_buckets) {
+      if (!num_buckets || *num_buckets <= 0) {
         return absl::nullopt;
       }
 
@@ -137,6 +141,12 @@ absl::optional<LinearModel> ParsePipelineClassifier(
       class_coef_weights.push_back(static_cast<float>(item.GetDouble()));
     }
 
+    if (!class_weights.empty() &&
+        class_weights.cbegin()->second.GetDimensionCount() !=
+            class_coef_weights.size()) {
+      return absl::nullopt;
+    }
+
     class_weights[class_name] = VectorData(std::move(class_coef_weights));
   }
 
@@ -158,6 +168,99 @@ absl::optional<LinearModel> ParsePipelineClassifier(
   return LinearModel(std::move(class_weights), std::move(biases));
 }
 
+absl::optional<TransformationVector> ParsePipelineTransformationsBinary(
+    BinaryResourceReader& reader) {
+  size_t transformation_count = 0;
+  if (!reader.ReadCount(/*min_item_size*/ sizeof(uint32_t),
+                        &transformation_count)) {
+    return absl::nullopt;
+  }
+
+  TransformationVector transformation_vector;
+  for (size_t i = 0; i < transformation_count; ++i) {
+    std::string transformation_type;
+    if (!reader.ReadString(&transformation_type)) {
+      return absl::nullopt;
+    }
+
+    if (transformation_type == "TO_LOWER") {
+      transformation_vector.push_back(
+          std::make_unique<LowercaseTransformation>());
+    } else if (transformation_type == "NORMALIZE") {
+      transformation_vector.push_back(
+          std::make_unique<NormalizationTransformation>());
+    } else if (transformation_type == "HASHED_NGRAMS") {
+      int num_buckets = 0;
+      size_t subgram_count = 0;
+      if (!reader.ReadInt(&num_buckets) || num_buckets <= 0 ||
+          !reader.ReadCount(/*min_item_size*/ sizeof(uint32_t),
+                            &subgram_count)) {
+        return absl::nullopt;
+      }
+
+      std::vector<int> subgrams(subgram_count);
+      for (int& subgram : subgrams) {
+        if (!reader.ReadInt(&subgram)) {
+          return absl::nullopt;
+        }
+      }
+
+      transformation_vector.push_back(
+          std::make_unique<HashedNGramsTransformation>(num_buckets, subgrams));
+    } else {
+      return absl::nullopt;
+    }
+  }
+
+  return transformation_vector;
+}
+
+absl::optional<LinearModel> ParsePipelineClassifierBinary(
+    BinaryResourceReader& reader) {
+  std::string classifier_type;
+  if (!reader.ReadString(&classifier_type) || classifier_type != "LINEAR") {
+    return absl::nullopt;
+  }
+
+  size_t class_count = 0;
+  if (!reader.ReadCount(/*min_item_size*/ sizeof(uint32_t), &class_count)) {
+    return absl::nullopt;
+  }
+
+  std::vector<std::string> classes(class_count);
+  for (std::string& class_name : classes) {
+    if (!reader.ReadString(&class_name) || class_name.empty()) {
+      return absl::nullopt;
+    }
+  }
+  if (base::ranges::adjacent_find(classes, std::greater_equal<>()) !=
+      classes.cend()) {
+    return absl::nullopt;
+  }
+
+  uint32_t dimension_count = 0;
+  if (!reader.ReadUint32(&dimension_count)) {
+    return absl::nullopt;
+  }
+
+  std::vector<double> biases(class_count);
+  for (double& bias : biases) {
+    if (!reader.ReadDouble(&bias)) {
+      return absl::nullopt;
+    }
+  }
+
+  base::CheckedNumeric<size_t> weight_count = dimension_count;
+  weight_count *= class_count;
+  std::vector<float> weights;
+  if (!weight_count.IsValid() ||
+      !reader.ReadFloats(weight_count.ValueOrDie(), &weights)) {
+    return absl::nullopt;
+  }
+
+  return LinearModel(std::move(classes), std::move(weights), std::move(biases));
+}
+
 }  // namespace
 
 absl::optional<PipelineInfo> ParsePipelineValue(base::Value::Dict dict) {
@@ -200,4 +303,29 @@ absl::optional<PipelineInfo> ParsePipelineValue(base::Value::Dict dict) {
                       std::move(*transformations), std::move(*linear_model));
 }
 
+absl::optional<PipelineInfo> ParsePipelineBinary(BinaryResourceReader& reader) {
+  int version = 0;
+  std::string timestamp;
+  std::string locale;
+  if (!reader.ReadInt(&version) || !reader.ReadString(&timestamp) ||
+      !reader.ReadString(&locale)) {
+    return absl::nullopt;
+  }
+
+  absl::optional<TransformationVector> transformations =
+      ParsePipelineTransformationsBinary(reader);
+  if (!transformations) {
+    return absl::nullopt;
+  }
+
+  absl::optional<LinearModel> linear_model =
+      ParsePipelineClassifierBinary(reader);
+  if (!linear_model || !reader.IsAtEnd()) {
+    return absl::nullopt;
+  }
+
+  return PipelineInfo(version, std::move(timestamp), std::move(locale),
+                      std::move(*transformations), std::move(*linear_model));
+}
+
 }  // namespace brave_ads::ml::pipeline
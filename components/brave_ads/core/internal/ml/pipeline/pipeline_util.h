@@ -9,12 +9,26 @@
 #include "base/values.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
 
+namespace brave_ads {
+class BinaryResourceReader;
+}  // namespace brave_ads
+
 namespace brave_ads::ml::pipeline {
 
 struct PipelineInfo;
 
 absl::optional<PipelineInfo> ParsePipelineValue(base::Value::Dict dict);
 
+// Parses a pipeline encoded as:
+//   int version, string timestamp, string locale,
+//   list of {string transformation_type ("TO_LOWER", "NORMALIZE" or
+//            "HASHED_NGRAMS"), and for "HASHED_NGRAMS":
+//            int num_buckets, list of int ngrams_range},
+//   string classifier_type, list of string classes (sorted, unique),
+//   uint32 dimension_count, double bias for each class,
+//   float weights[dimension_count][classes.size()].
+absl::optional<PipelineInfo> ParsePipelineBinary(BinaryResourceReader& reader);
+
 }  // namespace brave_ads::ml::pipeline
 
 #endif  // BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_ML_PIPELINE_PIPELINE_UTIL_H_
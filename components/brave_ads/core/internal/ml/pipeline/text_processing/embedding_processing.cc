@@ -32,6 +32,22 @@ EmbeddingProcessing::CreateFromValue(base::Value::Dict dict) {
   return embedding_processing;
 }
 
+// static
+base::expected<EmbeddingProcessing, std::string>
+EmbeddingProcessing::CreateFromBinary(BinaryResourceReader& reader) {
+  absl::optional<EmbeddingPipelineInfo> embedding_pipeline =
+      EmbeddingPipelineFromBinary(reader);
+  if (!embedding_pipeline) {
+    return base::unexpected("Failed to parse embedding pipeline binary");
+  }
+
+  EmbeddingProcessing embedding_processing;
+  embedding_processing.embedding_pipeline_ =
+      std::move(embedding_pipeline).value();
+  embedding_processing.is_initialized_ = true;
+  return embedding_processing;
+}
+
 EmbeddingProcessing::EmbeddingProcessing() = default;
 
 EmbeddingProcessing::EmbeddingProcessing(EmbeddingProcessing&& other) noexcept =
@@ -13,12 +13,18 @@
 #include "brave/components/brave_ads/core/internal/ml/pipeline/embedding_pipeline_info.h"
 #include "brave/components/brave_ads/core/internal/ml/pipeline/text_processing/embedding_info.h"
 
+namespace brave_ads {
+class BinaryResourceReader;
+}  // namespace brave_ads
+
 namespace brave_ads::ml::pipeline {
 
 class EmbeddingProcessing final {
  public:
   static base::expected<EmbeddingProcessing, std::string> CreateFromValue(
       base::Value::Dict dict);
+  static base::expected<EmbeddingProcessing, std::string> CreateFromBinary(
+      BinaryResourceReader& reader);
 
   EmbeddingProcessing();
 
@@ -30,6 +30,21 @@ base::expected<TextProcessing, std::string> TextProcessing::CreateFromValue(
   return text_processing;
 }
 
+// static
+base::expected<TextProcessing, std::string> TextProcessing::CreateFromBinary(
+    BinaryResourceReader& reader) {
+  absl::optional<PipelineInfo> pipeline = ParsePipelineBinary(reader);
+  if (!pipeline) {
+    return base::unexpected(
+        "Failed to parse text classification pipeline binary");
+  }
+
+  TextProcessing text_processing;
+  text_processing.SetPipeline(std::move(pipeline).value());
+  text_processing.is_initialized_ = true;
+  return text_processing;
+}
+
 TextProcessing::TextProcessing() = default;
 
 TextProcessing::TextProcessing(TextProcessing&& other) noexcept = default;
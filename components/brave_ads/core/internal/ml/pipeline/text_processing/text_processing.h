@@ -14,6 +14,10 @@
 #include "brave/components/brave_ads/core/internal/ml/ml_alias.h"
 #include "brave/components/brave_ads/core/internal/ml/model/linear/linear.h"
 
+namespace brave_ads {
+class BinaryResourceReader;
+}  // namespace brave_ads
+
 namespace brave_ads::ml::pipeline {
 
 struct PipelineInfo;
@@ -22,6 +26,8 @@ class TextProcessing final {
  public:
   static base::expected<TextProcessing, std::string> CreateFromValue(
       base::Value::Dict dict);
+  static base::expected<TextProcessing, std::string> CreateFromBinary(
+      BinaryResourceReader& reader);
 
   TextProcessing();
   TextProcessing(TransformationVector transformations,
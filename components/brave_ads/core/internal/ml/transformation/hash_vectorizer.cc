@@ -5,22 +5,20 @@
 
 #include "brave/components/brave_ads/core/internal/ml/transformation/hash_vectorizer.h"
 
+#include <algorithm>
+
+#include "base/check_op.h"
+#include "base/strings/string_piece.h"
 #include "third_party/zlib/zlib.h"
 
 namespace brave_ads::ml {
 
 namespace {
 
-constexpr int kMaximumHtmlLengthToClassify = 1 << 20;
+constexpr size_t kMaximumHtmlLengthToClassify = 1 << 20;
 constexpr int kMaximumSubLen = 6;
 constexpr int kDefaultBucketCount = 10'000;
 
-uint32_t GetHash(const std::string& text) {
-  const char* const u8str = text.c_str();
-  return crc32(crc32(0L, Z_NULL, 0), reinterpret_cast<const uint8_t*>(u8str),
-               strlen(u8str));
-}
-
 }  // namespace
 
 HashVectorizer::HashVectorizer() {
@@ -48,22 +46,67 @@ int HashVectorizer::GetBucketCount() const {
   return bucket_count_;
 }
 
-std::map<uint32_t, double> HashVectorizer::GetFrequencies(
+std::vector<uint32_t> HashVectorizer::GetBucketCounts(
     const std::string& html) const {
-  std::string data = html;
-  std::map<uint32_t, double> frequencies;
-  if (data.length() > kMaximumHtmlLengthToClassify) {
-    data = data.substr(0, kMaximumHtmlLengthToClassify);
-  }
-  // get hashes of substrings for each of the substring lengths defined:
-  for (const uint32_t& substring_size : substring_sizes_) {
+  CHECK_GT(bucket_count_, 0);
+  std::vector<uint32_t> bucket_counts(static_cast<size_t>(bucket_count_));
+
+  const base::StringPiece data =
+      base::StringPiece(html).substr(0, kMaximumHtmlLengthToClassify);
+
+  // Substring sizes are used in order until the first one longer than the
+  // text. Count how many times each remaining size is requested so the
+  // n-grams starting at a position can be hashed in a single pass.
+  std::vector<uint32_t> size_counts;
+  for (const uint32_t substring_size : substring_sizes_) {
     if (substring_size > data.length()) {
       break;
     }
-    for (size_t i = 0; i < data.length() - substring_size + 1; ++i) {
-      const std::string ss = data.substr(i, substring_size);
-      const uint32_t idx = GetHash(ss);
-      ++frequencies[idx % static_cast<uint32_t>(bucket_count_)];
+    if (substring_size >= size_counts.size()) {
+      size_counts.resize(substring_size + 1);
+    }
+    ++size_counts[substring_size];
+  }
+  if (size_counts.empty()) {
+    return bucket_counts;
+  }
+  // Every position, including the end of the text, starts an empty
+  // substring, whose hash is 0.
+  bucket_counts[0] += size_counts[0] * (data.length() + 1);
+  const size_t max_substring_size = size_counts.size() - 1;
+
+  const uint32_t initial_crc = crc32(0L, Z_NULL, 0);
+  const auto* const bytes = reinterpret_cast<const uint8_t*>(data.data());
+  for (size_t i = 0; i < data.length(); ++i) {
+    const size_t max_size =
+        std::min(max_substring_size, data.length() - i);
+    uint32_t crc = initial_crc;
+    bool reached_nul = false;
+    for (size_t size = 1; size <= max_size; ++size) {
+      // Models were trained on hashes of NUL-terminated substrings, so an
+      // embedded NUL ends the hashed prefix.
+      reached_nul = reached_nul || bytes[i + size - 1] == '\0';
+      if (!reached_nul) {
+        crc = crc32(crc, bytes + i + size - 1, 1);
+      }
+      if (size_counts[size] != 0) {
+        bucket_counts[crc % static_cast<uint32_t>(bucket_count_)] +=
+            size_counts[size];
+      }
+    }
+  }
+
+  return bucket_counts;
+}
+
+std::map<uint32_t, double> HashVectorizer::GetFrequencies(
+    const std::string& html) const {
+  const std::vector<uint32_t> bucket_counts = GetBucketCounts(html);
+
+  std::map<uint32_t, double> frequencies;
+  for (size_t i = 0; i < bucket_counts.size(); ++i) {
+    if (bucket_counts[i] != 0) {
+      frequencies.emplace_hint(frequencies.cend(), i, bucket_counts[i]);
     }
   }
   return frequencies;
@@ -26,6 +26,10 @@ class HashVectorizer final {
 
   ~HashVectorizer();
 
+  // Returns the number of n-grams of |html| hashed into each of the
+  // GetBucketCount() buckets.
+  std::vector<uint32_t> GetBucketCounts(const std::string& html) const;
+
   std::map<uint32_t, double> GetFrequencies(const std::string& html) const;
 
   std::vector<uint32_t> GetSubstringSizes() const;
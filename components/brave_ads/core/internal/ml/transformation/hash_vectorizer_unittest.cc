@@ -5,10 +5,14 @@
 
 #include "brave/components/brave_ads/core/internal/ml/transformation/hash_vectorizer.h"
 
+#include <cstring>
+
+#include "base/strings/string_util.h"
 #include "base/test/values_test_util.h"
 #include "base/values.h"
 #include "brave/components/brave_ads/core/internal/common/unittest/unittest_base.h"
 #include "brave/components/brave_ads/core/internal/common/unittest/unittest_file_util.h"
+#include "third_party/zlib/zlib.h"
 
 // npm run test -- brave_unit_tests --filter=BraveAds*
 
@@ -58,6 +62,28 @@ void RunHashingExtractorTestCase(const std::string& test_case_name) {
   }
 }
 
+// Hashes every substring separately, as the models were trained.
+std::map<uint32_t, double> GetReferenceFrequencies(
+    const std::string& text,
+    const std::vector<uint32_t>& substring_sizes,
+    const uint32_t bucket_count) {
+  std::map<uint32_t, double> frequencies;
+  for (const uint32_t substring_size : substring_sizes) {
+    if (substring_size > text.length()) {
+      break;
+    }
+    for (size_t i = 0; i < text.length() - substring_size + 1; ++i) {
+      const std::string substring = text.substr(i, substring_size);
+      const uint32_t hash =
+          crc32(crc32(0L, Z_NULL, 0),
+                reinterpret_cast<const uint8_t*>(substring.c_str()),
+                strlen(substring.c_str()));
+      ++frequencies[hash % bucket_count];
+    }
+  }
+  return frequencies;
+}
+
 }  // namespace
 
 class BraveAdsHashVectorizerTest : public UnitTestBase {};
@@ -94,4 +120,40 @@ TEST_F(BraveAdsHashVectorizerTest, JapaneseText) {
   RunHashingExtractorTestCase("japanese");
 }
 
+TEST_F(BraveAdsHashVectorizerTest, MatchesReferenceHashing) {
+  // Arrange
+  std::string text = base::JoinString(
+      std::vector<std::string>(
+          500, "The quick brown fox jumps over the lazy dog. Ελληνικά, 日本語"),
+      " ");
+  text[text.length() / 2] = '\0';
+
+  const std::vector<int> subgrams = {3, 1, 5, 5, 12, 2};
+  const HashVectorizer vectorizer(/*bucket_count*/ 997, subgrams);
+
+  // Act
+  const std::map<uint32_t, double> frequencies =
+      vectorizer.GetFrequencies(text);
+
+  // Assert
+  EXPECT_EQ(GetReferenceFrequencies(text, vectorizer.GetSubstringSizes(),
+                                    /*bucket_count*/ 997),
+            frequencies);
+}
+
+TEST_F(BraveAdsHashVectorizerTest, StopsAtFirstSubstringSizeLongerThanText) {
+  // Arrange
+  const std::vector<int> subgrams = {1, 8, 2};
+  const HashVectorizer vectorizer(/*bucket_count*/ 100, subgrams);
+
+  // Act
+  const std::map<uint32_t, double> frequencies =
+      vectorizer.GetFrequencies("brave");
+
+  // Assert
+  EXPECT_EQ(GetReferenceFrequencies("brave", vectorizer.GetSubstringSizes(),
+                                    /*bucket_count*/ 100),
+            frequencies);
+}
+
 }  // namespace brave_ads::ml
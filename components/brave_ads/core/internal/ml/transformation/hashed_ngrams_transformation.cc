@@ -5,7 +5,7 @@
 
 #include "brave/components/brave_ads/core/internal/ml/transformation/hashed_ngrams_transformation.h"
 
-#include <map>
+#include <vector>
 
 #include "base/check.h"
 #include "brave/components/brave_ads/core/internal/ml/data/text_data.h"
@@ -37,11 +37,11 @@ std::unique_ptr<Data> HashedNGramsTransformation::Apply(
 
   auto* text_data = static_cast<TextData*>(input_data.get());
 
-  const std::map<unsigned, double> frequences =
-      hash_vectorizer_->GetFrequencies(text_data->GetText());
+  const std::vector<uint32_t> bucket_counts =
+      hash_vectorizer_->GetBucketCounts(text_data->GetText());
   const int dimension_count = hash_vectorizer_->GetBucketCount();
 
-  return std::make_unique<VectorData>(dimension_count, frequences);
+  return std::make_unique<VectorData>(dimension_count, bucket_counts);
 }
 
 }  // namespace brave_ads::ml
@@ -5,15 +5,14 @@
 
 #include "brave/components/brave_ads/core/internal/processors/behavioral/purchase_intent/purchase_intent_processor.h"
 
-#include "base/ranges/algorithm.h"
-#include "base/strings/string_split.h"
-#include "base/strings/string_util.h"
+#include <algorithm>
+
 #include "brave/components/brave_ads/core/internal/common/logging_util.h"
 #include "brave/components/brave_ads/core/internal/common/search_engine/search_engine_results_page_util.h"
-#include "brave/components/brave_ads/core/internal/common/strings/string_strip_util.h"
 #include "brave/components/brave_ads/core/internal/common/url/url_util.h"
 #include "brave/components/brave_ads/core/internal/deprecated/client/client_state_manager.h"
 #include "brave/components/brave_ads/core/internal/processors/behavioral/purchase_intent/purchase_intent_signal_info.h"
+#include "brave/components/brave_ads/core/internal/resources/behavioral/purchase_intent/purchase_intent_index.h"
 #include "brave/components/brave_ads/core/internal/resources/behavioral/purchase_intent/purchase_intent_info.h"
 #include "brave/components/brave_ads/core/internal/resources/behavioral/purchase_intent/purchase_intent_resource.h"
 #include "brave/components/brave_ads/core/internal/resources/behavioral/purchase_intent/purchase_intent_signal_history_info.h"
@@ -24,8 +23,6 @@
 
 namespace brave_ads {
 
-using KeywordList = std::vector<std::string>;
-
 namespace {
 
 constexpr uint16_t kPurchaseIntentDefaultSignalWeight = 1;
@@ -41,18 +38,6 @@ void AppendSignalToHistory(
   }
 }
 
-KeywordList ToKeywords(const std::string& value) {
-  return base::SplitString(
-      StripNonAlphaNumericCharacters(base::ToLowerASCII(value)), " ",
-      base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY);
-}
-
-bool IsSubset(KeywordList keywords_lhs, KeywordList keywords_rhs) {
-  base::ranges::sort(keywords_lhs);
-  base::ranges::sort(keywords_rhs);
-  return base::ranges::includes(keywords_lhs, keywords_rhs);
-}
-
 }  // namespace
 
 PurchaseIntentProcessor::PurchaseIntentProcessor(
@@ -93,8 +78,10 @@ absl::optional<PurchaseIntentSignalInfo> PurchaseIntentProcessor::ExtractSignal(
   const absl::optional<std::string> search_query =
       ExtractSearchTermQueryValue(url);
   if (search_query) {
+    const KeywordList search_query_keywords = ToSortedKeywords(*search_query);
+
     const absl::optional<SegmentList> segments =
-        GetSegmentsForSearchQuery(*search_query);
+        GetSegmentsForSearchQuery(search_query_keywords);
     if (!segments || segments->empty()) {
       return absl::nullopt;
     }
@@ -103,7 +90,7 @@ absl::optional<PurchaseIntentSignalInfo> PurchaseIntentProcessor::ExtractSignal(
     purchase_intent_signal.created_at = base::Time::Now();
     purchase_intent_signal.segments = *segments;
     purchase_intent_signal.weight =
-        GetFunnelWeightForSearchQuery(*search_query);
+        GetFunnelWeightForSearchQuery(search_query_keywords);
     return purchase_intent_signal;
   }
 
@@ -126,55 +113,48 @@ absl::optional<PurchaseIntentSiteInfo> PurchaseIntentProcessor::GetSite(
     return absl::nullopt;
   }
 
-  for (const auto& site : purchase_intent->sites) {
-    if (SameDomainOrHost(url, site.url_netloc)) {
-      return site;
-    }
+  const absl::optional<size_t> index = purchase_intent->index.FindSite(url);
+  if (!index) {
+    return absl::nullopt;
   }
 
-  return absl::nullopt;
+  return purchase_intent->sites[*index];
 }
 
 absl::optional<SegmentList> PurchaseIntentProcessor::GetSegmentsForSearchQuery(
-    const std::string& search_query) const {
+    const KeywordList& search_query_keywords) const {
   const absl::optional<PurchaseIntentInfo>& purchase_intent = resource_->get();
   if (!purchase_intent) {
     return absl::nullopt;
   }
 
-  const KeywordList search_query_keywords = ToKeywords(search_query);
-
-  for (const auto& keyword : purchase_intent->segment_keywords) {
-    // Intended behavior relies on early return from list traversal and
-    // implicitely on the ordering of |segment_keywords_| to ensure specific
-    // segments are matched over general segments, e.g. "audi a6" segments
-    // should be returned over "audi" segments if possible.
-    if (IsSubset(search_query_keywords, ToKeywords(keyword.keywords))) {
-      return keyword.segments;
-    }
+  const std::vector<size_t> indexes =
+      purchase_intent->index.segment_keywords().FindMatches(
+          search_query_keywords);
+  if (indexes.empty()) {
+    return absl::nullopt;
   }
 
-  return absl::nullopt;
+  // Intended behavior relies on the ordering of |segment_keywords| to ensure
+  // specific segments are matched over general segments, e.g. "audi a6"
+  // segments should be returned over "audi" segments if possible.
+  return purchase_intent->segment_keywords[indexes.front()].segments;
 }
 
 uint16_t PurchaseIntentProcessor::GetFunnelWeightForSearchQuery(
-    const std::string& search_query) const {
+    const KeywordList& search_query_keywords) const {
   const absl::optional<PurchaseIntentInfo>& purchase_intent = resource_->get();
   if (!purchase_intent) {
     return kPurchaseIntentDefaultSignalWeight;
   }
 
-  const KeywordList search_query_keywords = ToKeywords(search_query);
-
   uint16_t max_weight = kPurchaseIntentDefaultSignalWeight;
 
-  for (const auto& keyword : purchase_intent->funnel_keywords) {
-    const KeywordList keywords = ToKeywords(keyword.keywords);
-
-    if (keyword.weight > max_weight &&
-        IsSubset(search_query_keywords, keywords)) {
-      max_weight = keyword.weight;
-    }
+  for (const size_t index :
+       purchase_intent->index.funnel_keywords().FindMatches(
+           search_query_keywords)) {
+    max_weight =
+        std::max(max_weight, purchase_intent->funnel_keywords[index].weight);
   }
 
   return max_weight;
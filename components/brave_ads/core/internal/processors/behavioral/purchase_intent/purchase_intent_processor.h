@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "base/memory/raw_ref.h"
+#include "brave/components/brave_ads/core/internal/resources/behavioral/purchase_intent/purchase_intent_index.h"
 #include "brave/components/brave_ads/core/internal/segments/segment_alias.h"
 #include "brave/components/brave_ads/core/internal/tabs/tab_manager_observer.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
@@ -43,9 +44,10 @@ class PurchaseIntentProcessor final : public TabManagerObserver {
   absl::optional<PurchaseIntentSiteInfo> GetSite(const GURL& url) const;
 
   absl::optional<SegmentList> GetSegmentsForSearchQuery(
-      const std::string& search_query) const;
+      const KeywordList& search_query_keywords) const;
 
-  uint16_t GetFunnelWeightForSearchQuery(const std::string& search_query) const;
+  uint16_t GetFunnelWeightForSearchQuery(
+      const KeywordList& search_query_keywords) const;
 
   // TabManagerObserver:
   void OnTextContentDidChange(int32_t tab_id,
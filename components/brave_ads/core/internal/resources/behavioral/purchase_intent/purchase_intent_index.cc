@@ -0,0 +1,166 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/resources/behavioral/purchase_intent/purchase_intent_index.h"
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <utility>
+
+#include "base/ranges/algorithm.h"
+#include "base/strings/string_split.h"
+#include "base/strings/string_util.h"
+#include "brave/components/brave_ads/core/internal/ads/serving/targeting/behavioral/purchase_intent/purchase_intent_funnel_keyword_info.h"
+#include "brave/components/brave_ads/core/internal/common/strings/string_strip_util.h"
+#include "brave/components/brave_ads/core/internal/resources/behavioral/purchase_intent/purchase_intent_segment_keyword_info.h"
+#include "brave/components/brave_ads/core/internal/resources/behavioral/purchase_intent/purchase_intent_site_info.h"
+#include "net/base/registry_controlled_domains/registry_controlled_domain.h"
+#include "url/gurl.h"
+
+namespace brave_ads {
+
+namespace {
+
+// Two non-empty hosts are the same domain or host if they are equal or share
+// a registrable domain, so they are the same domain or host if and only if
+// their keys are equal.
+std::string GetSiteKey(const GURL& url) {
+  std::string domain = net::registry_controlled_domains::GetDomainAndRegistry(
+      url, net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
+  return domain.empty() ? url.host() : domain;
+}
+
+template <typename T>
+std::vector<std::string> GetKeywords(const std::vector<T>& items) {
+  std::vector<std::string> keywords;
+  keywords.reserve(items.size());
+  for (const auto& item : items) {
+    keywords.push_back(item.keywords);
+  }
+  return keywords;
+}
+
+}  // namespace
+
+KeywordList ToSortedKeywords(const std::string& value) {
+  KeywordList keywords = base::SplitString(
+      StripNonAlphaNumericCharacters(base::ToLowerASCII(value)), " ",
+      base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY);
+  base::ranges::sort(keywords);
+  return keywords;
+}
+
+PurchaseIntentKeywordIndex::PurchaseIntentKeywordIndex() = default;
+
+PurchaseIntentKeywordIndex::PurchaseIntentKeywordIndex(
+    const std::vector<std::string>& keywords) {
+  std::map<std::string, size_t> keyword_counts;
+
+  keywords_.reserve(keywords.size());
+  for (const auto& value : keywords) {
+    keywords_.push_back(ToSortedKeywords(value));
+    for (const auto& keyword : keywords_.back()) {
+      ++keyword_counts[keyword];
+    }
+  }
+
+  std::map<std::string, std::vector<size_t>> postings;
+  for (size_t i = 0; i < keywords_.size(); ++i) {
+    if (keywords_[i].empty()) {
+      keywordless_.push_back(i);
+      continue;
+    }
+
+    const auto iter = base::ranges::min_element(
+        keywords_[i], /*comp*/ {},
+        [&keyword_counts](const std::string& keyword) {
+          return keyword_counts.at(keyword);
+        });
+    postings[*iter].push_back(i);
+  }
+
+  postings_ = base::flat_map<std::string, std::vector<size_t>>(
+      base::sorted_unique, std::make_move_iterator(postings.begin()),
+      std::make_move_iterator(postings.end()));
+}
+
+PurchaseIntentKeywordIndex::PurchaseIntentKeywordIndex(
+    PurchaseIntentKeywordIndex&& other) noexcept = default;
+
+PurchaseIntentKeywordIndex& PurchaseIntentKeywordIndex::operator=(
+    PurchaseIntentKeywordIndex&& other) noexcept = default;
+
+PurchaseIntentKeywordIndex::~PurchaseIntentKeywordIndex() = default;
+
+std::vector<size_t> PurchaseIntentKeywordIndex::FindMatches(
+    const KeywordList& search_query_keywords) const {
+  std::vector<size_t> matches = keywordless_;
+
+  // Each entry is listed under a single keyword, so visiting every distinct
+  // search query keyword once yields each match once.
+  for (auto iter = search_query_keywords.cbegin();
+       iter != search_query_keywords.cend();
+       iter = std::upper_bound(iter, search_query_keywords.cend(), *iter)) {
+    const auto postings_iter = postings_.find(*iter);
+    if (postings_iter == postings_.cend()) {
+      continue;
+    }
+
+    for (const size_t index : postings_iter->second) {
+      if (base::ranges::includes(search_query_keywords, keywords_[index])) {
+        matches.push_back(index);
+      }
+    }
+  }
+
+  base::ranges::sort(matches);
+  return matches;
+}
+
+PurchaseIntentIndex::PurchaseIntentIndex() = default;
+
+PurchaseIntentIndex::PurchaseIntentIndex(
+    const std::vector<PurchaseIntentSiteInfo>& sites,
+    const std::vector<PurchaseIntentSegmentKeywordInfo>& segment_keywords,
+    const std::vector<PurchaseIntentFunnelKeywordInfo>& funnel_keywords)
+    : segment_keywords_(GetKeywords(segment_keywords)),
+      funnel_keywords_(GetKeywords(funnel_keywords)) {
+  std::vector<std::pair<std::string, size_t>> site_keys;
+  site_keys.reserve(sites.size());
+  for (size_t i = 0; i < sites.size(); ++i) {
+    if (sites[i].url_netloc.host_piece().empty()) {
+      continue;
+    }
+
+    site_keys.emplace_back(GetSiteKey(sites[i].url_netloc), i);
+  }
+
+  // Keeps the first of any sites sharing a key.
+  sites_ = base::flat_map<std::string, size_t>(std::move(site_keys));
+}
+
+PurchaseIntentIndex::PurchaseIntentIndex(PurchaseIntentIndex&& other) noexcept =
+    default;
+
+PurchaseIntentIndex& PurchaseIntentIndex::operator=(
+    PurchaseIntentIndex&& other) noexcept = default;
+
+PurchaseIntentIndex::~PurchaseIntentIndex() = default;
+
+absl::optional<size_t> PurchaseIntentIndex::FindSite(const GURL& url) const {
+  if (url.host_piece().empty()) {
+    return absl::nullopt;
+  }
+
+  const auto iter = sites_.find(GetSiteKey(url));
+  if (iter == sites_.cend()) {
+    return absl::nullopt;
+  }
+
+  return iter->second;
+}
+
+}  // namespace brave_ads
@@ -0,0 +1,104 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_RESOURCES_BEHAVIORAL_PURCHASE_INTENT_PURCHASE_INTENT_INDEX_H_
+#define BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_RESOURCES_BEHAVIORAL_PURCHASE_INTENT_PURCHASE_INTENT_INDEX_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "base/containers/flat_map.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+class GURL;
+
+namespace brave_ads {
+
+struct PurchaseIntentFunnelKeywordInfo;
+struct PurchaseIntentSegmentKeywordInfo;
+struct PurchaseIntentSiteInfo;
+
+using KeywordList = std::vector<std::string>;
+
+// Splits |value| into sorted lowercase alphanumeric keywords.
+KeywordList ToSortedKeywords(const std::string& value);
+
+// Inverted index over the keywords of a list of entries, answering which
+// entries have all of their keywords contained in a search query.
+class PurchaseIntentKeywordIndex final {
+ public:
+  PurchaseIntentKeywordIndex();
+  explicit PurchaseIntentKeywordIndex(const std::vector<std::string>& keywords);
+
+  PurchaseIntentKeywordIndex(const PurchaseIntentKeywordIndex&) = delete;
+  PurchaseIntentKeywordIndex& operator=(const PurchaseIntentKeywordIndex&) =
+      delete;
+
+  PurchaseIntentKeywordIndex(PurchaseIntentKeywordIndex&&) noexcept;
+  PurchaseIntentKeywordIndex& operator=(PurchaseIntentKeywordIndex&&) noexcept;
+
+  ~PurchaseIntentKeywordIndex();
+
+  // Returns the indexes, in ascending order, of the entries whose keywords are
+  // a subset of |search_query_keywords| as returned by ToSortedKeywords.
+  // Repeated keywords must be repeated in the search query as often.
+  std::vector<size_t> FindMatches(
+      const KeywordList& search_query_keywords) const;
+
+ private:
+  // Sorted keywords of each entry.
+  std::vector<KeywordList> keywords_;
+
+  // Every entry is only listed under its least common keyword, so a search
+  // query only visits the entries sharing its rarest keywords.
+  base::flat_map<std::string, std::vector<size_t>> postings_;
+
+  // Entries without keywords match every search query.
+  std::vector<size_t> keywordless_;
+};
+
+// Compiled form of a PurchaseIntentInfo, built once when the resource is
+// loaded so that matching a visited URL or search query does not depend on
+// the size of the resource.
+class PurchaseIntentIndex final {
+ public:
+  PurchaseIntentIndex();
+  PurchaseIntentIndex(
+      const std::vector<PurchaseIntentSiteInfo>& sites,
+      const std::vector<PurchaseIntentSegmentKeywordInfo>& segment_keywords,
+      const std::vector<PurchaseIntentFunnelKeywordInfo>& funnel_keywords);
+
+  PurchaseIntentIndex(const PurchaseIntentIndex&) = delete;
+  PurchaseIntentIndex& operator=(const PurchaseIntentIndex&) = delete;
+
+  PurchaseIntentIndex(PurchaseIntentIndex&&) noexcept;
+  PurchaseIntentIndex& operator=(PurchaseIntentIndex&&) noexcept;
+
+  ~PurchaseIntentIndex();
+
+  // Returns the index of the first site which is the same domain or host as
+  // |url|.
+  absl::optional<size_t> FindSite(const GURL& url) const;
+
+  const PurchaseIntentKeywordIndex& segment_keywords() const {
+    return segment_keywords_;
+  }
+
+  const PurchaseIntentKeywordIndex& funnel_keywords() const {
+    return funnel_keywords_;
+  }
+
+ private:
+  // Keyed by the registrable domain of each site, or its host if it has none.
+  base::flat_map<std::string, size_t> sites_;
+
+  PurchaseIntentKeywordIndex segment_keywords_;
+  PurchaseIntentKeywordIndex funnel_keywords_;
+};
+
+}  // namespace brave_ads
+
+#endif  // BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_RESOURCES_BEHAVIORAL_PURCHASE_INTENT_PURCHASE_INTENT_INDEX_H_
@@ -0,0 +1,90 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/resources/behavioral/purchase_intent/purchase_intent_index.h"
+
+#include <vector>
+
+#include "brave/components/brave_ads/core/internal/ads/serving/targeting/behavioral/purchase_intent/purchase_intent_funnel_keyword_info.h"
+#include "brave/components/brave_ads/core/internal/resources/behavioral/purchase_intent/purchase_intent_segment_keyword_info.h"
+#include "brave/components/brave_ads/core/internal/resources/behavioral/purchase_intent/purchase_intent_site_info.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+// npm run test -- brave_unit_tests --filter=BraveAds*
+
+namespace brave_ads {
+
+TEST(BraveAdsPurchaseIntentIndexTest, ToSortedKeywords) {
+  // Arrange
+
+  // Act
+
+  // Assert
+  EXPECT_EQ(KeywordList({"a6", "audi", "review"}),
+            ToSortedKeywords("  Review: AUDI  a6!"));
+  EXPECT_TRUE(ToSortedKeywords(" !? ").empty());
+}
+
+TEST(BraveAdsPurchaseIntentIndexTest, FindKeywordMatches) {
+  // Arrange
+  const PurchaseIntentKeywordIndex index(
+      {"audi a6", "audi", "bmw", "audi a4", "", "new new car", "a6 audi"});
+
+  // Act
+
+  // Assert
+  EXPECT_EQ(std::vector<size_t>({0, 1, 4, 6}),
+            index.FindMatches(ToSortedKeywords("audi a6 review")));
+  EXPECT_EQ(std::vector<size_t>({1, 4}),
+            index.FindMatches(ToSortedKeywords("Audi")));
+  EXPECT_EQ(std::vector<size_t>({4}),
+            index.FindMatches(ToSortedKeywords("new car")));
+  EXPECT_EQ(std::vector<size_t>({4, 5}),
+            index.FindMatches(ToSortedKeywords("new new car")));
+  EXPECT_EQ(std::vector<size_t>({4}), index.FindMatches({}));
+}
+
+TEST(BraveAdsPurchaseIntentIndexTest, FindSite) {
+  // Arrange
+  const std::vector<PurchaseIntentSiteInfo> sites = {
+      {{"segment 1"}, GURL("https://www.brave.com"), 1},
+      {{"segment 2"}, GURL("https://search.brave.com"), 1},
+      {{"segment 3"}, GURL("https://basicattentiontoken.org"), 1},
+      {{"segment 4"}, GURL("http://localhost:8080"), 1},
+      {{"segment 5"}, GURL("INVALID"), 1}};
+
+  // Act
+  const PurchaseIntentIndex index(sites, /*segment_keywords*/ {},
+                                  /*funnel_keywords*/ {});
+
+  // Assert
+  EXPECT_EQ(0U, index.FindSite(GURL("https://brave.com/foo")));
+  EXPECT_EQ(0U, index.FindSite(GURL("https://search.brave.com")));
+  EXPECT_EQ(2U, index.FindSite(GURL("https://basicattentiontoken.org/bar")));
+  EXPECT_EQ(3U, index.FindSite(GURL("https://localhost")));
+  EXPECT_FALSE(index.FindSite(GURL("https://brave.org")));
+  EXPECT_FALSE(index.FindSite(GURL("INVALID")));
+}
+
+TEST(BraveAdsPurchaseIntentIndexTest, IndexKeywords) {
+  // Arrange
+  const std::vector<PurchaseIntentSegmentKeywordInfo> segment_keywords = {
+      {{"segment 1"}, "audi a6"}, {{"segment 2"}, "audi"}};
+  const std::vector<PurchaseIntentFunnelKeywordInfo> funnel_keywords = {
+      {"buy", 3}, {"price", 2}};
+
+  // Act
+  const PurchaseIntentIndex index(/*sites*/ {}, segment_keywords,
+                                  funnel_keywords);
+
+  // Assert
+  EXPECT_EQ(std::vector<size_t>({1}),
+            index.segment_keywords().FindMatches(ToSortedKeywords("audi a4")));
+  EXPECT_EQ(std::vector<size_t>({0, 1}),
+            index.funnel_keywords().FindMatches(ToSortedKeywords("price buy")));
+}
+
+}  // namespace brave_ads
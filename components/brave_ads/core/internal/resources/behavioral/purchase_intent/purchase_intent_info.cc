@@ -5,15 +5,42 @@
 
 #include "brave/components/brave_ads/core/internal/resources/behavioral/purchase_intent/purchase_intent_info.h"
 
+#include <cstdint>
 #include <utility>
 
+#include "base/numerics/safe_conversions.h"
 #include "base/values.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/targeting/behavioral/purchase_intent/purchase_intent_feature.h"
+#include "brave/components/brave_ads/core/internal/resources/binary_resource_reader.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
 #include "url/gurl.h"
 
 namespace brave_ads {
 
+namespace {
+
+bool ReadSegments(BinaryResourceReader& reader,
+                  const std::vector<std::string>& segments,
+                  SegmentList* const segment_list) {
+  size_t count = 0;
+  if (!reader.ReadCount(/*min_item_size*/ sizeof(uint32_t), &count)) {
+    return false;
+  }
+
+  segment_list->reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    uint32_t index = 0;
+    if (!reader.ReadUint32(&index) || index >= segments.size()) {
+      return false;
+    }
+    segment_list->push_back(segments[index]);
+  }
+
+  return true;
+}
+
+}  // namespace
+
 PurchaseIntentInfo::PurchaseIntentInfo() = default;
 
 PurchaseIntentInfo::PurchaseIntentInfo(PurchaseIntentInfo&& other) noexcept =
@@ -145,6 +172,110 @@ PurchaseIntentInfo::CreateFromValue(const base::Value::Dict dict) {
     }
   }
 
+  purchase_intent.index = PurchaseIntentIndex(purchase_intent.sites,
+                                              purchase_intent.segment_keywords,
+                                              purchase_intent.funnel_keywords);
+
+  return purchase_intent;
+}
+
+// static
+base::expected<PurchaseIntentInfo, std::string>
+PurchaseIntentInfo::CreateFromBinary(BinaryResourceReader& reader) {
+  PurchaseIntentInfo purchase_intent;
+
+  if (!reader.ReadInt(&purchase_intent.version)) {
+    return base::unexpected("Failed to load from binary, version missing");
+  }
+  if (kPurchaseIntentResourceVersion.Get() != purchase_intent.version) {
+    return base::unexpected("Failed to load from binary, version mismatch");
+  }
+
+  size_t segment_count = 0;
+  if (!reader.ReadCount(/*min_item_size*/ sizeof(uint32_t), &segment_count)) {
+    return base::unexpected("Failed to load from binary, segments missing");
+  }
+
+  std::vector<std::string> segments(segment_count);
+  for (std::string& segment : segments) {
+    if (!reader.ReadString(&segment) || segment.empty()) {
+      return base::unexpected(
+          "Failed to load from binary, segments are ill-formed");
+    }
+  }
+
+  size_t segment_keyword_count = 0;
+  if (!reader.ReadCount(/*min_item_size*/ 2 * sizeof(uint32_t),
+                        &segment_keyword_count)) {
+    return base::unexpected(
+        "Failed to load from binary, segment keywords missing");
+  }
+
+  purchase_intent.segment_keywords.resize(segment_keyword_count);
+  for (PurchaseIntentSegmentKeywordInfo& segment_keyword :
+       purchase_intent.segment_keywords) {
+    if (!reader.ReadString(&segment_keyword.keywords) ||
+        !ReadSegments(reader, segments, &segment_keyword.segments)) {
+      return base::unexpected(
+          "Failed to load from binary, segment keywords are ill-formed");
+    }
+  }
+
+  size_t funnel_keyword_count = 0;
+  if (!reader.ReadCount(/*min_item_size*/ 2 * sizeof(uint32_t),
+                        &funnel_keyword_count)) {
+    return base::unexpected(
+        "Failed to load from binary, funnel keywords missing");
+  }
+
+  purchase_intent.funnel_keywords.resize(funnel_keyword_count);
+  for (PurchaseIntentFunnelKeywordInfo& funnel_keyword :
+       purchase_intent.funnel_keywords) {
+    int weight = 0;
+    if (!reader.ReadString(&funnel_keyword.keywords) ||
+        !reader.ReadInt(&weight) ||
+        !base::IsValueInRangeForNumericType<uint16_t>(weight)) {
+      return base::unexpected(
+          "Failed to load from binary, funnel keywords are ill-formed");
+    }
+    funnel_keyword.weight = static_cast<uint16_t>(weight);
+  }
+
+  size_t funnel_site_count = 0;
+  if (!reader.ReadCount(/*min_item_size*/ 2 * sizeof(uint32_t),
+                        &funnel_site_count)) {
+    return base::unexpected("Failed to load from binary, funnel sites missing");
+  }
+
+  for (size_t i = 0; i < funnel_site_count; ++i) {
+    SegmentList funnel_site_segments;
+    size_t site_count = 0;
+    if (!ReadSegments(reader, segments, &funnel_site_segments) ||
+        !reader.ReadCount(/*min_item_size*/ sizeof(uint32_t), &site_count)) {
+      return base::unexpected(
+          "Failed to load from binary, funnel sites are ill-formed");
+    }
+
+    for (size_t j = 0; j < site_count; ++j) {
+      std::string site;
+      if (!reader.ReadString(&site)) {
+        return base::unexpected(
+            "Failed to load from binary, funnel sites are ill-formed");
+      }
+
+      purchase_intent.sites.emplace_back(funnel_site_segments, GURL(site),
+                                         /*weight*/ 1);
+    }
+  }
+
+  if (!reader.IsAtEnd()) {
+    return base::unexpected("Failed to load from binary, trailing data");
+  }
+
+  purchase_intent.index = PurchaseIntentIndex(purchase_intent.sites,
+                                              purchase_intent.segment_keywords,
+                                              purchase_intent.funnel_keywords);
+
   return purchase_intent;
 }
 
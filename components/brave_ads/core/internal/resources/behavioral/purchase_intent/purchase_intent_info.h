@@ -12,11 +12,14 @@
 #include "base/types/expected.h"
 #include "base/values.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/targeting/behavioral/purchase_intent/purchase_intent_funnel_keyword_info.h"
+#include "brave/components/brave_ads/core/internal/resources/behavioral/purchase_intent/purchase_intent_index.h"
 #include "brave/components/brave_ads/core/internal/resources/behavioral/purchase_intent/purchase_intent_segment_keyword_info.h"
 #include "brave/components/brave_ads/core/internal/resources/behavioral/purchase_intent/purchase_intent_site_info.h"
 
 namespace brave_ads {
 
+class BinaryResourceReader;
+
 struct PurchaseIntentInfo final {
   PurchaseIntentInfo();
 
@@ -31,10 +34,21 @@ struct PurchaseIntentInfo final {
   static base::expected<PurchaseIntentInfo, std::string> CreateFromValue(
       base::Value::Dict dict);
 
+  // Parses a resource encoded as:
+  //   int version, list of string segments,
+  //   list of {string keywords, list of uint32 segment indexes},
+  //   list of {string keywords, int weight},
+  //   list of {list of uint32 segment indexes, list of string sites}.
+  static base::expected<PurchaseIntentInfo, std::string> CreateFromBinary(
+      BinaryResourceReader& reader);
+
   int version = 0;
   std::vector<PurchaseIntentSiteInfo> sites;
   std::vector<PurchaseIntentSegmentKeywordInfo> segment_keywords;
   std::vector<PurchaseIntentFunnelKeywordInfo> funnel_keywords;
+
+  // Built from the fields above once they are parsed.
+  PurchaseIntentIndex index;
 };
 
 }  // namespace brave_ads
@@ -0,0 +1,361 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/resources/binary_resource_converter.h"
+
+#include <map>
+
+#include "base/numerics/safe_conversions.h"
+#include "base/time/time.h"
+#include "brave/components/brave_ads/core/internal/resources/behavioral/purchase_intent/purchase_intent_resource_constants.h"
+#include "brave/components/brave_ads/core/internal/resources/binary_resource_writer.h"
+#include "brave/components/brave_ads/core/internal/resources/contextual/text_classification/text_classification_resource_constants.h"
+#include "brave/components/brave_ads/core/internal/resources/contextual/text_embedding/text_embedding_resource_constants.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+namespace brave_ads {
+
+namespace {
+
+using BinaryResourceOrError = base::expected<std::vector<uint8_t>, std::string>;
+
+void WriteCount(const size_t count, BinaryResourceWriter& writer) {
+  writer.WriteUint32(base::checked_cast<uint32_t>(count));
+}
+
+bool WriteSegmentIndexes(const base::Value& value,
+                         const size_t segment_count,
+                         BinaryResourceWriter& writer) {
+  const auto* const list = value.GetIfList();
+  if (!list) {
+    return false;
+  }
+
+  WriteCount(list->size(), writer);
+  for (const base::Value& item : *list) {
+    const absl::optional<int> index = item.GetIfInt();
+    if (!index || *index < 0 || static_cast<size_t>(*index) >= segment_count) {
+      return false;
+    }
+    writer.WriteUint32(static_cast<uint32_t>(*index));
+  }
+
+  return true;
+}
+
+// Mirrors PurchaseIntentInfo::CreateFromBinary.
+BinaryResourceOrError ConvertPurchaseIntentResource(
+    const base::Value::Dict& dict) {
+  BinaryResourceWriter writer;
+
+  const absl::optional<int> version = dict.FindInt("version");
+  if (!version) {
+    return base::unexpected("Failed to convert to binary, version missing");
+  }
+  writer.WriteInt(*version);
+
+  const auto* const segments_list = dict.FindList("segments");
+  if (!segments_list) {
+    return base::unexpected("Failed to convert to binary, segments missing");
+  }
+
+  WriteCount(segments_list->size(), writer);
+  for (const base::Value& item : *segments_list) {
+    const std::string* const segment = item.GetIfString();
+    if (!segment || segment->empty()) {
+      return base::unexpected(
+          "Failed to convert to binary, segments are ill-formed");
+    }
+    writer.WriteString(*segment);
+  }
+
+  const auto* const segment_keywords_dict = dict.FindDict("segment_keywords");
+  if (!segment_keywords_dict) {
+    return base::unexpected(
+        "Failed to convert to binary, segment keywords missing");
+  }
+
+  WriteCount(segment_keywords_dict->size(), writer);
+  for (const auto [keywords, indexes] : *segment_keywords_dict) {
+    writer.WriteString(keywords);
+    if (!WriteSegmentIndexes(indexes, segments_list->size(), writer)) {
+      return base::unexpected(
+          "Failed to convert to binary, segment keywords are ill-formed");
+    }
+  }
+
+  const auto* const funnel_keywords_dict = dict.FindDict("funnel_keywords");
+  if (!funnel_keywords_dict) {
+    return base::unexpected(
+        "Failed to convert to binary, funnel keywords missing");
+  }
+
+  WriteCount(funnel_keywords_dict->size(), writer);
+  for (const auto [keywords, weight] : *funnel_keywords_dict) {
+    if (!weight.is_int() ||
+        !base::IsValueInRangeForNumericType<uint16_t>(weight.GetInt())) {
+      return base::unexpected(
+          "Failed to convert to binary, funnel keywords are ill-formed");
+    }
+    writer.WriteString(keywords).WriteInt(weight.GetInt());
+  }
+
+  const auto* const funnel_sites_list = dict.FindList("funnel_sites");
+  if (!funnel_sites_list) {
+    return base::unexpected(
+        "Failed to convert to binary, funnel sites missing");
+  }
+
+  WriteCount(funnel_sites_list->size(), writer);
+  for (const base::Value& item : *funnel_sites_list) {
+    const auto* const item_dict = item.GetIfDict();
+    if (!item_dict) {
+      return base::unexpected(
+          "Failed to convert to binary, funnel sites are ill-formed");
+    }
+
+    const base::Value* const segments = item_dict->Find("segments");
+    const auto* const sites_list = item_dict->FindList("sites");
+    if (!segments || !sites_list ||
+        !WriteSegmentIndexes(*segments, segments_list->size(), writer)) {
+      return base::unexpected(
+          "Failed to convert to binary, funnel sites are ill-formed");
+    }
+
+    WriteCount(sites_list->size(), writer);
+    for (const base::Value& site : *sites_list) {
+      if (!site.is_string()) {
+        return base::unexpected(
+            "Failed to convert to binary, funnel sites are ill-formed");
+      }
+      writer.WriteString(site.GetString());
+    }
+  }
+
+  return writer.data();
+}
+
+bool WritePipelineTransformations(const base::Value::List& list,
+                                  BinaryResourceWriter& writer) {
+  WriteCount(list.size(), writer);
+  for (const base::Value& item : list) {
+    const auto* const item_dict = item.GetIfDict();
+    if (!item_dict) {
+      return false;
+    }
+
+    const std::string* const transformation_type =
+        item_dict->FindString("transformation_type");
+    if (!transformation_type) {
+      return false;
+    }
+    writer.WriteString(*transformation_type);
+
+    if (*transformation_type == "TO_LOWER" ||
+        *transformation_type == "NORMALIZE") {
+      continue;
+    }
+
+    if (*transformation_type != "HASHED_NGRAMS") {
+      return false;
+    }
+
+    const auto* const params_dict = item_dict->FindDict("params");
+    if (!params_dict) {
+      return false;
+    }
+
+    const absl::optional<int> num_buckets = params_dict->FindInt("num_buckets");
+    const auto* const ngrams_range_list = params_dict->FindList("ngrams_range");
+    if (!num_buckets || *num_buckets <= 0 || !ngrams_range_list) {
+      return false;
+    }
+
+    writer.WriteInt(*num_buckets);
+    WriteCount(ngrams_range_list->size(), writer);
+    for (const base::Value& subgram : *ngrams_range_list) {
+      if (!subgram.is_int()) {
+        return false;
+      }
+      writer.WriteInt(subgram.GetInt());
+    }
+  }
+
+  return true;
+}
+
+bool WritePipelineClassifier(const base::Value::Dict& dict,
+                             BinaryResourceWriter& writer) {
+  const std::string* const classifier_type = dict.FindString("classifier_type");
+  if (!classifier_type || *classifier_type != "LINEAR") {
+    return false;
+  }
+  writer.WriteString(*classifier_type);
+
+  const auto* const classes_list = dict.FindList("classes");
+  const auto* const biases_list = dict.FindList("biases");
+  const auto* const class_weights_dict = dict.FindDict("class_weights");
+  if (!classes_list || !biases_list || !class_weights_dict ||
+      biases_list->size() != classes_list->size()) {
+    return false;
+  }
+
+  // The binary format stores the classes sorted.
+  std::map</*class_name*/ std::string, /*bias*/ double> biases;
+  for (size_t i = 0; i < classes_list->size(); ++i) {
+    const std::string* const class_name = (*classes_list)[i].GetIfString();
+    const base::Value& bias = (*biases_list)[i];
+    if (!class_name || class_name->empty() ||
+        (!bias.is_double() && !bias.is_int()) ||
+        !biases.emplace(*class_name, bias.GetDouble()).second) {
+      return false;
+    }
+  }
+
+  std::vector<const base::Value::List*> class_weights;
+  class_weights.reserve(biases.size());
+  for (const auto& [class_name, bias] : biases) {
+    const auto* const list = class_weights_dict->FindList(class_name);
+    if (!list || (!class_weights.empty() &&
+                  list->size() != class_weights.front()->size())) {
+      return false;
+    }
+    class_weights.push_back(list);
+  }
+  const size_t dimension_count =
+      class_weights.empty() ? 0 : class_weights.front()->size();
+
+  WriteCount(biases.size(), writer);
+  for (const auto& [class_name, bias] : biases) {
+    writer.WriteString(class_name);
+  }
+  WriteCount(dimension_count, writer);
+  for (const auto& [class_name, bias] : biases) {
+    writer.WriteDouble(bias);
+  }
+
+  // Dimension-major, as LinearModel packs them.
+  for (size_t i = 0; i < dimension_count; ++i) {
+    for (const base::Value::List* const list : class_weights) {
+      const base::Value& weight = (*list)[i];
+      if (!weight.is_double() && !weight.is_int()) {
+        return false;
+      }
+      writer.WriteFloat(static_cast<float>(weight.GetDouble()));
+    }
+  }
+
+  return true;
+}
+
+// Mirrors ml::pipeline::ParsePipelineBinary.
+BinaryResourceOrError ConvertTextClassificationResource(
+    const base::Value::Dict& dict) {
+  BinaryResourceWriter writer;
+
+  const absl::optional<int> version = dict.FindInt("version");
+  const std::string* const timestamp = dict.FindString("timestamp");
+  const std::string* const locale = dict.FindString("locale");
+  if (!version || !timestamp || !locale) {
+    return base::unexpected(
+        "Failed to convert to binary, version, timestamp or locale missing");
+  }
+  writer.WriteInt(*version).WriteString(*timestamp).WriteString(*locale);
+
+  const auto* const transformations_list = dict.FindList("transformations");
+  if (!transformations_list ||
+      !WritePipelineTransformations(*transformations_list, writer)) {
+    return base::unexpected(
+        "Failed to convert to binary, transformations are ill-formed");
+  }
+
+  const auto* const classifier_dict = dict.FindDict("classifier");
+  if (!classifier_dict || !WritePipelineClassifier(*classifier_dict, writer)) {
+    return base::unexpected(
+        "Failed to convert to binary, classifier is ill-formed");
+  }
+
+  return writer.data();
+}
+
+// Mirrors ml::pipeline::EmbeddingPipelineFromBinary.
+BinaryResourceOrError ConvertTextEmbeddingResource(
+    const base::Value::Dict& dict) {
+  BinaryResourceWriter writer;
+
+  const absl::optional<int> version = dict.FindInt("version");
+  const std::string* const locale = dict.FindString("locale");
+  if (!version || !locale) {
+    return base::unexpected(
+        "Failed to convert to binary, version or locale missing");
+  }
+
+  std::string timestamp;
+  if (const std::string* const value = dict.FindString("timestamp")) {
+    base::Time time;
+    if (!base::Time::FromUTCString(value->c_str(), &time)) {
+      return base::unexpected(
+          "Failed to convert to binary, timestamp is ill-formed");
+    }
+    timestamp = *value;
+  }
+
+  const auto* const embeddings_dict = dict.FindDict("embeddings");
+  if (!embeddings_dict || embeddings_dict->empty()) {
+    return base::unexpected("Failed to convert to binary, embeddings missing");
+  }
+
+  const auto* const first_embedding =
+      embeddings_dict->begin()->second.GetIfList();
+  const size_t dimension = first_embedding ? first_embedding->size() : 0;
+  if (dimension <= 1) {
+    return base::unexpected(
+        "Failed to convert to binary, embeddings are ill-formed");
+  }
+
+  writer.WriteInt(*version).WriteString(timestamp).WriteString(*locale);
+  WriteCount(dimension, writer);
+  WriteCount(embeddings_dict->size(), writer);
+  for (const auto [token, embedding] : *embeddings_dict) {
+    const auto* const list = embedding.GetIfList();
+    if (!list || list->size() != dimension) {
+      return base::unexpected(
+          "Failed to convert to binary, embeddings are ill-formed");
+    }
+
+    writer.WriteString(token);
+    for (const base::Value& item : *list) {
+      if (!item.is_double() && !item.is_int()) {
+        return base::unexpected(
+            "Failed to convert to binary, embeddings are ill-formed");
+      }
+      writer.WriteFloat(static_cast<float>(item.GetDouble()));
+    }
+  }
+
+  return writer.data();
+}
+
+}  // namespace
+
+base::expected<std::vector<uint8_t>, std::string> ConvertResourceToBinary(
+    const std::string& id,
+    const base::Value::Dict& dict) {
+  if (id == kPurchaseIntentResourceId) {
+    return ConvertPurchaseIntentResource(dict);
+  }
+
+  if (id == kTextClassificationResourceId) {
+    return ConvertTextClassificationResource(dict);
+  }
+
+  if (id == kTextEmbeddingResourceId) {
+    return ConvertTextEmbeddingResource(dict);
+  }
+
+  return base::unexpected("Resource has no binary format");
+}
+
+}  // namespace brave_ads
@@ -0,0 +1,28 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_RESOURCES_BINARY_RESOURCE_CONVERTER_H_
+#define BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_RESOURCES_BINARY_RESOURCE_CONVERTER_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "base/types/expected.h"
+#include "base/values.h"
+
+namespace brave_ads {
+
+// Converts the JSON resource |dict| with |id| to the binary format read by
+// its CreateFromBinary, see binary_resource_reader.h. Only the purchase
+// intent, text classification and text embedding resources have a binary
+// format. Used by the convert_resource_to_binary tool.
+base::expected<std::vector<uint8_t>, std::string> ConvertResourceToBinary(
+    const std::string& id,
+    const base::Value::Dict& dict);
+
+}  // namespace brave_ads
+
+#endif  // BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_RESOURCES_BINARY_RESOURCE_CONVERTER_H_
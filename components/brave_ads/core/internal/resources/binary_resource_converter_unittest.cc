@@ -0,0 +1,183 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/resources/binary_resource_converter.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "base/check.h"
+#include "base/strings/strcat.h"
+#include "base/test/values_test_util.h"
+#include "brave/components/brave_ads/core/internal/common/unittest/unittest_base.h"
+#include "brave/components/brave_ads/core/internal/common/unittest/unittest_file_util.h"
+#include "brave/components/brave_ads/core/internal/ml/pipeline/text_processing/embedding_processing.h"
+#include "brave/components/brave_ads/core/internal/ml/pipeline/text_processing/text_processing.h"
+#include "brave/components/brave_ads/core/internal/resources/behavioral/conversions/conversions_resource_constants.h"
+#include "brave/components/brave_ads/core/internal/resources/behavioral/purchase_intent/purchase_intent_info.h"
+#include "brave/components/brave_ads/core/internal/resources/behavioral/purchase_intent/purchase_intent_resource_constants.h"
+#include "brave/components/brave_ads/core/internal/resources/binary_resource_reader.h"
+#include "brave/components/brave_ads/core/internal/resources/contextual/text_classification/text_classification_resource_constants.h"
+#include "brave/components/brave_ads/core/internal/resources/contextual/text_embedding/text_embedding_resource_constants.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+// npm run test -- brave_unit_tests --filter=BraveAds*
+
+namespace brave_ads {
+
+namespace {
+
+base::Value::Dict ReadJsonResource(const std::string& name) {
+  const absl::optional<std::string> json = ReadFileFromTestPathToString(name);
+  CHECK(json);
+  return base::test::ParseJsonDict(*json);
+}
+
+}  // namespace
+
+class BraveAdsBinaryResourceConverterTest : public UnitTestBase {};
+
+TEST_F(BraveAdsBinaryResourceConverterTest, ConvertPurchaseIntentResource) {
+  // Arrange
+  const base::Value::Dict dict = ReadJsonResource(
+      base::StrCat({"resources/", kPurchaseIntentResourceId}));
+
+  // Act
+  const base::expected<std::vector<uint8_t>, std::string> data =
+      ConvertResourceToBinary(kPurchaseIntentResourceId, dict);
+
+  // Assert
+  ASSERT_TRUE(data.has_value());
+  ASSERT_TRUE(IsBinaryResource(data.value()));
+  BinaryResourceReader reader(data.value());
+  const base::expected<PurchaseIntentInfo, std::string> purchase_intent =
+      PurchaseIntentInfo::CreateFromBinary(reader);
+  ASSERT_TRUE(purchase_intent.has_value());
+
+  const base::expected<PurchaseIntentInfo, std::string>
+      expected_purchase_intent =
+          PurchaseIntentInfo::CreateFromValue(dict.Clone());
+  ASSERT_TRUE(expected_purchase_intent.has_value());
+  EXPECT_EQ(expected_purchase_intent->version, purchase_intent->version);
+  EXPECT_EQ(expected_purchase_intent->sites, purchase_intent->sites);
+  ASSERT_EQ(expected_purchase_intent->segment_keywords.size(),
+            purchase_intent->segment_keywords.size());
+  for (size_t i = 0; i < purchase_intent->segment_keywords.size(); ++i) {
+    EXPECT_EQ(expected_purchase_intent->segment_keywords[i].keywords,
+              purchase_intent->segment_keywords[i].keywords);
+    EXPECT_EQ(expected_purchase_intent->segment_keywords[i].segments,
+              purchase_intent->segment_keywords[i].segments);
+  }
+  ASSERT_EQ(expected_purchase_intent->funnel_keywords.size(),
+            purchase_intent->funnel_keywords.size());
+  for (size_t i = 0; i < purchase_intent->funnel_keywords.size(); ++i) {
+    EXPECT_EQ(expected_purchase_intent->funnel_keywords[i].keywords,
+              purchase_intent->funnel_keywords[i].keywords);
+    EXPECT_EQ(expected_purchase_intent->funnel_keywords[i].weight,
+              purchase_intent->funnel_keywords[i].weight);
+  }
+}
+
+TEST_F(BraveAdsBinaryResourceConverterTest,
+       ConvertTextClassificationResource) {
+  // Arrange
+  const base::Value::Dict dict = ReadJsonResource(
+      "ml/pipeline/text_processing/valid_spam_classification.json");
+
+  // Act
+  const base::expected<std::vector<uint8_t>, std::string> data =
+      ConvertResourceToBinary(kTextClassificationResourceId, dict);
+
+  // Assert
+  ASSERT_TRUE(data.has_value());
+  BinaryResourceReader reader(data.value());
+  const base::expected<ml::pipeline::TextProcessing, std::string>
+      text_processing = ml::pipeline::TextProcessing::CreateFromBinary(reader);
+  ASSERT_TRUE(text_processing.has_value());
+
+  const base::expected<ml::pipeline::TextProcessing, std::string>
+      expected_text_processing =
+          ml::pipeline::TextProcessing::CreateFromValue(dict.Clone());
+  ASSERT_TRUE(expected_text_processing.has_value());
+  for (const char* const text :
+       {"This is a spam email.", "Message from mom with no real subject"}) {
+    EXPECT_EQ(expected_text_processing->ClassifyPage(text),
+              text_processing->ClassifyPage(text));
+  }
+}
+
+TEST_F(BraveAdsBinaryResourceConverterTest, ConvertTextEmbeddingResource) {
+  // Arrange
+  const base::Value::Dict dict =
+      ReadJsonResource(base::StrCat({"resources/", kTextEmbeddingResourceId}));
+
+  // Act
+  const base::expected<std::vector<uint8_t>, std::string> data =
+      ConvertResourceToBinary(kTextEmbeddingResourceId, dict);
+
+  // Assert
+  ASSERT_TRUE(data.has_value());
+  BinaryResourceReader reader(data.value());
+  const base::expected<ml::pipeline::EmbeddingProcessing, std::string>
+      embedding_processing =
+          ml::pipeline::EmbeddingProcessing::CreateFromBinary(reader);
+  ASSERT_TRUE(embedding_processing.has_value());
+
+  const base::expected<ml::pipeline::EmbeddingProcessing, std::string>
+      expected_embedding_processing =
+          ml::pipeline::EmbeddingProcessing::CreateFromValue(dict.Clone());
+  ASSERT_TRUE(expected_embedding_processing.has_value());
+  for (const char* const text : {"this", "unittest", "simple"}) {
+    EXPECT_EQ(expected_embedding_processing->EmbedText(text).embedding,
+              embedding_processing->EmbedText(text).embedding);
+  }
+}
+
+TEST_F(BraveAdsBinaryResourceConverterTest,
+       DoNotConvertUnknownTransformation) {
+  // Arrange
+  base::Value::Dict dict = ReadJsonResource(
+      "ml/pipeline/text_processing/valid_spam_classification.json");
+  base::Value::List* const transformations = dict.FindList("transformations");
+  ASSERT_TRUE(transformations);
+  transformations->Append(base::test::ParseJsonDict(
+      R"({"transformation_type": "TO_UPPER"})"));
+
+  // Act
+
+  // Assert
+  EXPECT_FALSE(
+      ConvertResourceToBinary(kTextClassificationResourceId, dict).has_value());
+}
+
+TEST_F(BraveAdsBinaryResourceConverterTest,
+       DoNotConvertPurchaseIntentResourceWithInvalidSegmentIndex) {
+  // Arrange
+  base::Value::Dict dict = ReadJsonResource(
+      base::StrCat({"resources/", kPurchaseIntentResourceId}));
+  dict.SetByDottedPath("segment_keywords.segment keyword 1",
+                       base::Value::List().Append(3));
+
+  // Act
+
+  // Assert
+  EXPECT_FALSE(
+      ConvertResourceToBinary(kPurchaseIntentResourceId, dict).has_value());
+}
+
+TEST_F(BraveAdsBinaryResourceConverterTest,
+       DoNotConvertResourceWithoutBinaryFormat) {
+  // Arrange
+
+  // Act
+
+  // Assert
+  EXPECT_FALSE(
+      ConvertResourceToBinary(kConversionsResourceId, base::Value::Dict())
+          .has_value());
+}
+
+}  // namespace brave_ads
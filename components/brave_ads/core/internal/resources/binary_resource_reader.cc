@@ -0,0 +1,116 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/resources/binary_resource_reader.h"
+
+#include "base/bit_cast.h"
+#include "base/check.h"
+#include "base/numerics/safe_conversions.h"
+#include "base/ranges/algorithm.h"
+#include "base/strings/string_piece.h"
+
+namespace brave_ads {
+
+namespace {
+
+constexpr size_t kHeaderSize = sizeof(kBinaryResourceMagic) + sizeof(uint16_t);
+
+}  // namespace
+
+bool IsBinaryResource(const base::span<const uint8_t> data) {
+  if (data.size() < kHeaderSize ||
+      !base::ranges::equal(data.first(sizeof(kBinaryResourceMagic)),
+                           kBinaryResourceMagic)) {
+    return false;
+  }
+
+  base::BigEndianReader reader(data.data() + sizeof(kBinaryResourceMagic),
+                               sizeof(uint16_t));
+  uint16_t format_version = 0;
+  return reader.ReadU16(&format_version) &&
+         format_version == kBinaryResourceFormatVersion;
+}
+
+BinaryResourceReader::BinaryResourceReader(const base::span<const uint8_t> data)
+    : reader_(data.data(), data.size()) {
+  CHECK(IsBinaryResource(data));
+  reader_.Skip(kHeaderSize);
+}
+
+BinaryResourceReader::~BinaryResourceReader() = default;
+
+bool BinaryResourceReader::ReadUint32(uint32_t* const value) {
+  return reader_.ReadU32(value);
+}
+
+bool BinaryResourceReader::ReadInt(int* const value) {
+  uint32_t bits = 0;
+  if (!reader_.ReadU32(&bits)) {
+    return false;
+  }
+  *value = static_cast<int>(static_cast<int32_t>(bits));
+  return true;
+}
+
+bool BinaryResourceReader::ReadFloat(float* const value) {
+  uint32_t bits = 0;
+  if (!reader_.ReadU32(&bits)) {
+    return false;
+  }
+  *value = base::bit_cast<float>(bits);
+  return true;
+}
+
+bool BinaryResourceReader::ReadDouble(double* const value) {
+  uint64_t bits = 0;
+  if (!reader_.ReadU64(&bits)) {
+    return false;
+  }
+  *value = base::bit_cast<double>(bits);
+  return true;
+}
+
+bool BinaryResourceReader::ReadString(std::string* const value) {
+  uint32_t length = 0;
+  base::StringPiece piece;
+  if (!reader_.ReadU32(&length) || !reader_.ReadPiece(&piece, length)) {
+    return false;
+  }
+  value->assign(piece.data(), piece.size());
+  return true;
+}
+
+bool BinaryResourceReader::ReadCount(const size_t min_item_size,
+                                     size_t* const count) {
+  uint32_t value = 0;
+  if (!reader_.ReadU32(&value)) {
+    return false;
+  }
+  if (min_item_size > 0 && value > reader_.remaining() / min_item_size) {
+    return false;
+  }
+  *count = base::checked_cast<size_t>(value);
+  return true;
+}
+
+bool BinaryResourceReader::ReadFloats(const size_t count,
+                                      std::vector<float>* const values) {
+  if (count > reader_.remaining() / sizeof(uint32_t)) {
+    return false;
+  }
+  values->reserve(values->size() + count);
+  for (size_t i = 0; i < count; ++i) {
+    uint32_t bits = 0;
+    reader_.ReadU32(&bits);
+    values->push_back(base::bit_cast<float>(bits));
+  }
+  return true;
+}
+
+bool BinaryResourceReader::IsAtEnd() const {
+  return reader_.remaining() == 0;
+}
+
+}  // namespace brave_ads
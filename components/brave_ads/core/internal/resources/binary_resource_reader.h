@@ -0,0 +1,65 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_RESOURCES_BINARY_RESOURCE_READER_H_
+#define BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_RESOURCES_BINARY_RESOURCE_READER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "base/big_endian.h"
+#include "base/containers/span.h"
+
+namespace brave_ads {
+
+// Binary resources start with |kBinaryResourceMagic| followed by a big-endian
+// uint16 format version. The leading NUL byte can never start a JSON resource,
+// so both encodings can be served under the same resource id. All numbers are
+// big-endian, floats and doubles are stored as their IEEE 754 bits, and
+// strings and lists are prefixed with their uint32 length.
+inline constexpr uint8_t kBinaryResourceMagic[] = {0x00, 'B', 'A', 'R'};
+inline constexpr uint16_t kBinaryResourceFormatVersion = 1;
+
+bool IsBinaryResource(base::span<const uint8_t> data);
+
+// Reads the payload following the header of a binary resource, see
+// IsBinaryResource. Every method returns false once the data is exhausted or
+// malformed.
+class BinaryResourceReader final {
+ public:
+  explicit BinaryResourceReader(base::span<const uint8_t> data);
+
+  BinaryResourceReader(const BinaryResourceReader&) = delete;
+  BinaryResourceReader& operator=(const BinaryResourceReader&) = delete;
+
+  BinaryResourceReader(BinaryResourceReader&&) noexcept = delete;
+  BinaryResourceReader& operator=(BinaryResourceReader&&) noexcept = delete;
+
+  ~BinaryResourceReader();
+
+  bool ReadUint32(uint32_t* value);
+  bool ReadInt(int* value);
+  bool ReadFloat(float* value);
+  bool ReadDouble(double* value);
+  bool ReadString(std::string* value);
+
+  // Reads a list length, rejecting lengths that could not possibly fit in the
+  // remaining data given at least |min_item_size| bytes per item.
+  bool ReadCount(size_t min_item_size, size_t* count);
+
+  // Appends |count| floats to |values|.
+  bool ReadFloats(size_t count, std::vector<float>* values);
+
+  bool IsAtEnd() const;
+
+ private:
+  base::BigEndianReader reader_;
+};
+
+}  // namespace brave_ads
+
+#endif  // BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_RESOURCES_BINARY_RESOURCE_READER_H_
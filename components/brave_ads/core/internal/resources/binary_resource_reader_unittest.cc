@@ -0,0 +1,318 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/resources/binary_resource_reader.h"
+
+#include <string>
+#include <vector>
+
+#include "base/check.h"
+#include "base/files/file.h"
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "brave/components/brave_ads/core/internal/common/unittest/unittest_base.h"
+#include "brave/components/brave_ads/core/internal/ml/pipeline/text_processing/embedding_processing.h"
+#include "brave/components/brave_ads/core/internal/ml/pipeline/text_processing/text_processing.h"
+#include "brave/components/brave_ads/core/internal/resources/behavioral/purchase_intent/purchase_intent_info.h"
+#include "brave/components/brave_ads/core/internal/resources/binary_resource_writer.h"
+#include "brave/components/brave_ads/core/internal/resources/resources_util_impl.h"
+
+// npm run test -- brave_unit_tests --filter=BraveAds*
+
+namespace brave_ads {
+
+class BraveAdsBinaryResourceReaderTest : public UnitTestBase {
+ protected:
+  void SetUp() override {
+    UnitTestBase::SetUp();
+
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+  }
+
+  base::File WriteResource(const std::vector<uint8_t>& data) {
+    const base::FilePath path = temp_dir_.GetPath().AppendASCII("resource");
+    CHECK(base::WriteFile(path, data));
+    return base::File(path, base::File::FLAG_OPEN | base::File::FLAG_READ);
+  }
+
+  base::ScopedTempDir temp_dir_;
+};
+
+TEST_F(BraveAdsBinaryResourceReaderTest, IsBinaryResource) {
+  // Arrange
+  const std::string json = R"({"version": 1})";
+  std::vector<uint8_t> unsupported_format_version =
+      BinaryResourceWriter().data();
+  unsupported_format_version.back() = 0xFF;
+
+  // Act
+
+  // Assert
+  EXPECT_TRUE(IsBinaryResource(BinaryResourceWriter().data()));
+  EXPECT_FALSE(IsBinaryResource(base::as_bytes(base::make_span(json))));
+  EXPECT_FALSE(IsBinaryResource(unsupported_format_version));
+  EXPECT_FALSE(IsBinaryResource({}));
+}
+
+TEST_F(BraveAdsBinaryResourceReaderTest, Read) {
+  // Arrange
+  BinaryResourceWriter writer;
+  writer.WriteUint32(4'000'000'000U)
+      .WriteInt(-7)
+      .WriteFloat(0.25F)
+      .WriteDouble(-1.5)
+      .WriteString("brave")
+      .WriteUint32(3)
+      .WriteFloat(1.0F)
+      .WriteFloat(2.0F)
+      .WriteFloat(3.0F);
+
+  // Act
+  BinaryResourceReader reader(writer.data());
+
+  // Assert
+  uint32_t uint32_value = 0;
+  EXPECT_TRUE(reader.ReadUint32(&uint32_value));
+  EXPECT_EQ(4'000'000'000U, uint32_value);
+  int int_value = 0;
+  EXPECT_TRUE(reader.ReadInt(&int_value));
+  EXPECT_EQ(-7, int_value);
+  float float_value = 0.0F;
+  EXPECT_TRUE(reader.ReadFloat(&float_value));
+  EXPECT_EQ(0.25F, float_value);
+  double double_value = 0.0;
+  EXPECT_TRUE(reader.ReadDouble(&double_value));
+  EXPECT_EQ(-1.5, double_value);
+  std::string string_value;
+  EXPECT_TRUE(reader.ReadString(&string_value));
+  EXPECT_EQ("brave", string_value);
+  size_t count = 0;
+  EXPECT_TRUE(reader.ReadCount(/*min_item_size*/ sizeof(float), &count));
+  std::vector<float> floats;
+  EXPECT_TRUE(reader.ReadFloats(count, &floats));
+  EXPECT_EQ(std::vector<float>({1.0F, 2.0F, 3.0F}), floats);
+  EXPECT_TRUE(reader.IsAtEnd());
+  EXPECT_FALSE(reader.ReadUint32(&uint32_value));
+}
+
+TEST_F(BraveAdsBinaryResourceReaderTest, DoNotReadPastTheEnd) {
+  // Arrange
+  BinaryResourceWriter writer;
+  writer.WriteUint32(1'000'000).WriteUint32(10);
+
+  // Act
+  BinaryResourceReader reader(writer.data());
+
+  // Assert
+  size_t count = 0;
+  EXPECT_FALSE(reader.ReadCount(/*min_item_size*/ sizeof(uint32_t), &count));
+  std::string string_value;
+  EXPECT_FALSE(reader.ReadString(&string_value));
+}
+
+TEST_F(BraveAdsBinaryResourceReaderTest, ParseTextClassificationResource) {
+  // Arrange
+  BinaryResourceWriter writer;
+  writer.WriteInt(/*version*/ 1)
+      .WriteString("2023-06-01 00:00:00")
+      .WriteString("en")
+      .WriteUint32(/*transformation_count*/ 2)
+      .WriteString("TO_LOWER")
+      .WriteString("HASHED_NGRAMS")
+      .WriteInt(/*num_buckets*/ 3)
+      .WriteUint32(1)
+      .WriteInt(1)
+      .WriteString("LINEAR")
+      .WriteUint32(/*class_count*/ 2)
+      .WriteString("class_1")
+      .WriteString("class_2")
+      .WriteUint32(/*dimension_count*/ 3)
+      .WriteDouble(0.1)
+      .WriteDouble(0.2);
+  for (const float weight : {1.0F, 0.0F, 0.0F, 1.0F, 0.5F, 0.5F}) {
+    writer.WriteFloat(weight);
+  }
+
+  // Act
+  const ResourceParsingErrorOr<ml::pipeline::TextProcessing> result =
+      ReadFileAndParseResourceOnBackgroundThread<ml::pipeline::TextProcessing>(
+          WriteResource(writer.data()));
+
+  // Assert
+  ASSERT_TRUE(result.has_value());
+  EXPECT_TRUE(result.value().IsInitialized());
+  EXPECT_FALSE(result.value().ClassifyPage("Some content").empty());
+}
+
+TEST_F(BraveAdsBinaryResourceReaderTest,
+       DoNotParseTextClassificationResourceWithUnsortedClasses) {
+  // Arrange
+  BinaryResourceWriter writer;
+  writer.WriteInt(/*version*/ 1)
+      .WriteString("")
+      .WriteString("en")
+      .WriteUint32(/*transformation_count*/ 0)
+      .WriteString("LINEAR")
+      .WriteUint32(/*class_count*/ 2)
+      .WriteString("class_2")
+      .WriteString("class_1")
+      .WriteUint32(/*dimension_count*/ 1)
+      .WriteDouble(0.1)
+      .WriteDouble(0.2)
+      .WriteFloat(1.0F)
+      .WriteFloat(1.0F);
+
+  // Act
+  BinaryResourceReader reader(writer.data());
+
+  // Assert
+  EXPECT_FALSE(ml::pipeline::TextProcessing::CreateFromBinary(reader)
+                   .has_value());
+}
+
+TEST_F(BraveAdsBinaryResourceReaderTest,
+       DoNotParseTextClassificationResourceWithUnknownTransformation) {
+  // Arrange
+  BinaryResourceWriter writer;
+  writer.WriteInt(/*version*/ 1)
+      .WriteString("")
+      .WriteString("en")
+      .WriteUint32(/*transformation_count*/ 1)
+      .WriteString("TO_UPPER")
+      .WriteString("LINEAR")
+      .WriteUint32(/*class_count*/ 1)
+      .WriteString("class_1")
+      .WriteUint32(/*dimension_count*/ 1)
+      .WriteDouble(0.1)
+      .WriteFloat(1.0F);
+
+  // Act
+  BinaryResourceReader reader(writer.data());
+
+  // Assert
+  EXPECT_FALSE(ml::pipeline::TextProcessing::CreateFromBinary(reader)
+                   .has_value());
+}
+
+TEST_F(BraveAdsBinaryResourceReaderTest,
+       DoNotParseTextClassificationResourceWithoutBuckets) {
+  // Arrange
+  BinaryResourceWriter writer;
+  writer.WriteInt(/*version*/ 1)
+      .WriteString("")
+      .WriteString("en")
+      .WriteUint32(/*transformation_count*/ 1)
+      .WriteString("HASHED_NGRAMS")
+      .WriteInt(/*num_buckets*/ 0)
+      .WriteUint32(1)
+      .WriteInt(1)
+      .WriteString("LINEAR")
+      .WriteUint32(/*class_count*/ 1)
+      .WriteString("class_1")
+      .WriteUint32(/*dimension_count*/ 1)
+      .WriteDouble(0.1)
+      .WriteFloat(1.0F);
+
+  // Act
+  BinaryResourceReader reader(writer.data());
+
+  // Assert
+  EXPECT_FALSE(ml::pipeline::TextProcessing::CreateFromBinary(reader)
+                   .has_value());
+}
+
+TEST_F(BraveAdsBinaryResourceReaderTest, ParseTextEmbeddingResource) {
+  // Arrange
+  BinaryResourceWriter writer;
+  writer.WriteInt(/*version*/ 1)
+      .WriteString("2022-06-09 08:00:00.704847")
+      .WriteString("EN")
+      .WriteUint32(/*dimension*/ 3)
+      .WriteUint32(/*token_count*/ 2)
+      .WriteString("this")
+      .WriteFloat(1.0F)
+      .WriteFloat(0.5F)
+      .WriteFloat(0.7F)
+      .WriteString("unittest")
+      .WriteFloat(-0.2F)
+      .WriteFloat(0.8F)
+      .WriteFloat(1.0F);
+
+  // Act
+  const ResourceParsingErrorOr<ml::pipeline::EmbeddingProcessing> result =
+      ReadFileAndParseResourceOnBackgroundThread<
+          ml::pipeline::EmbeddingProcessing>(WriteResource(writer.data()));
+
+  // Assert
+  ASSERT_TRUE(result.has_value());
+  EXPECT_TRUE(result.value().IsInitialized());
+  EXPECT_EQ(std::vector<float>({1.0F, 0.5F, 0.7F}),
+            result.value().EmbedText("this").embedding);
+}
+
+TEST_F(BraveAdsBinaryResourceReaderTest, ParsePurchaseIntentResource) {
+  // Arrange
+  BinaryResourceWriter writer;
+  writer.WriteInt(/*version*/ 1)
+      .WriteUint32(/*segment_count*/ 2)
+      .WriteString("segment 1")
+      .WriteString("segment 2")
+      .WriteUint32(/*segment_keyword_count*/ 1)
+      .WriteString("segment keyword 1")
+      .WriteUint32(2)
+      .WriteUint32(0)
+      .WriteUint32(1)
+      .WriteUint32(/*funnel_keyword_count*/ 1)
+      .WriteString("funnel keyword 1")
+      .WriteInt(/*weight*/ 2)
+      .WriteUint32(/*funnel_site_count*/ 1)
+      .WriteUint32(1)
+      .WriteUint32(1)
+      .WriteUint32(2)
+      .WriteString("https://brave.com")
+      .WriteString("https://basicattentiontoken.org");
+
+  // Act
+  const ResourceParsingErrorOr<PurchaseIntentInfo> result =
+      ReadFileAndParseResourceOnBackgroundThread<PurchaseIntentInfo>(
+          WriteResource(writer.data()));
+
+  // Assert
+  ASSERT_TRUE(result.has_value());
+  const PurchaseIntentInfo& purchase_intent = result.value();
+  ASSERT_EQ(1U, purchase_intent.segment_keywords.size());
+  EXPECT_EQ(SegmentList({"segment 1", "segment 2"}),
+            purchase_intent.segment_keywords[0].segments);
+  ASSERT_EQ(1U, purchase_intent.funnel_keywords.size());
+  EXPECT_EQ(2U, purchase_intent.funnel_keywords[0].weight);
+  ASSERT_EQ(2U, purchase_intent.sites.size());
+  EXPECT_EQ(GURL("https://basicattentiontoken.org"),
+            purchase_intent.sites[1].url_netloc);
+  EXPECT_EQ(SegmentList({"segment 2"}), purchase_intent.sites[1].segments);
+}
+
+TEST_F(BraveAdsBinaryResourceReaderTest, FallBackToJson) {
+  // Arrange
+  const std::string json = R"(
+      {
+        "locale": "EN",
+        "version": 1,
+        "embeddings": {
+          "this": [1.0, 0.5, 0.7]
+        }
+      })";
+
+  // Act
+  const ResourceParsingErrorOr<ml::pipeline::EmbeddingProcessing> result =
+      ReadFileAndParseResourceOnBackgroundThread<
+          ml::pipeline::EmbeddingProcessing>(WriteResource(
+          std::vector<uint8_t>(json.cbegin(), json.cend())));
+
+  // Assert
+  ASSERT_TRUE(result.has_value());
+  EXPECT_TRUE(result.value().IsInitialized());
+}
+
+}  // namespace brave_ads
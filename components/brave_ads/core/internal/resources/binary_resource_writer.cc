@@ -0,0 +1,60 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/resources/binary_resource_writer.h"
+
+#include <iterator>
+
+#include "base/bit_cast.h"
+#include "brave/components/brave_ads/core/internal/resources/binary_resource_reader.h"
+
+namespace brave_ads {
+
+namespace {
+
+void AppendBigEndian(const uint64_t value,
+                     const size_t size,
+                     std::vector<uint8_t>* const data) {
+  for (size_t i = size; i > 0; --i) {
+    data->push_back(static_cast<uint8_t>(value >> ((i - 1) * 8)));
+  }
+}
+
+}  // namespace
+
+BinaryResourceWriter::BinaryResourceWriter() {
+  data_.assign(std::cbegin(kBinaryResourceMagic),
+               std::cend(kBinaryResourceMagic));
+  AppendBigEndian(kBinaryResourceFormatVersion, sizeof(uint16_t), &data_);
+}
+
+BinaryResourceWriter::~BinaryResourceWriter() = default;
+
+BinaryResourceWriter& BinaryResourceWriter::WriteUint32(const uint32_t value) {
+  AppendBigEndian(value, sizeof(uint32_t), &data_);
+  return *this;
+}
+
+BinaryResourceWriter& BinaryResourceWriter::WriteInt(const int value) {
+  return WriteUint32(static_cast<uint32_t>(value));
+}
+
+BinaryResourceWriter& BinaryResourceWriter::WriteFloat(const float value) {
+  return WriteUint32(base::bit_cast<uint32_t>(value));
+}
+
+BinaryResourceWriter& BinaryResourceWriter::WriteDouble(const double value) {
+  AppendBigEndian(base::bit_cast<uint64_t>(value), sizeof(uint64_t), &data_);
+  return *this;
+}
+
+BinaryResourceWriter& BinaryResourceWriter::WriteString(
+    const std::string& value) {
+  WriteUint32(static_cast<uint32_t>(value.size()));
+  data_.insert(data_.cend(), value.cbegin(), value.cend());
+  return *this;
+}
+
+}  // namespace brave_ads
@@ -0,0 +1,43 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_RESOURCES_BINARY_RESOURCE_WRITER_H_
+#define BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_RESOURCES_BINARY_RESOURCE_WRITER_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace brave_ads {
+
+// Builds binary resources in the format read by BinaryResourceReader, see
+// ConvertResourceToBinary.
+class BinaryResourceWriter final {
+ public:
+  BinaryResourceWriter();
+
+  BinaryResourceWriter(const BinaryResourceWriter&) = delete;
+  BinaryResourceWriter& operator=(const BinaryResourceWriter&) = delete;
+
+  BinaryResourceWriter(BinaryResourceWriter&&) noexcept = delete;
+  BinaryResourceWriter& operator=(BinaryResourceWriter&&) noexcept = delete;
+
+  ~BinaryResourceWriter();
+
+  BinaryResourceWriter& WriteUint32(uint32_t value);
+  BinaryResourceWriter& WriteInt(int value);
+  BinaryResourceWriter& WriteFloat(float value);
+  BinaryResourceWriter& WriteDouble(double value);
+  BinaryResourceWriter& WriteString(const std::string& value);
+
+  const std::vector<uint8_t>& data() const { return data_; }
+
+ private:
+  std::vector<uint8_t> data_;
+};
+
+}  // namespace brave_ads
+
+#endif  // BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_RESOURCES_BINARY_RESOURCE_WRITER_H_
@@ -0,0 +1,70 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "base/command_line.h"
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/json/json_reader.h"
+#include "base/logging.h"
+#include "base/types/expected.h"
+#include "base/values.h"
+#include "brave/components/brave_ads/core/internal/resources/binary_resource_converter.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+namespace {
+
+constexpr char kResourceIdSwitch[] = "resource-id";
+constexpr char kInputSwitch[] = "input";
+constexpr char kOutputSwitch[] = "output";
+
+}  // namespace
+
+// Converts a JSON resource to the binary format before it is published with
+// the resource component, see binary_resource_reader.h.
+int main(int argc, char* argv[]) {
+  base::CommandLine::Init(argc, argv);
+
+  const auto* const command_line = base::CommandLine::ForCurrentProcess();
+  const std::string id = command_line->GetSwitchValueASCII(kResourceIdSwitch);
+  const base::FilePath input_path =
+      command_line->GetSwitchValuePath(kInputSwitch);
+  const base::FilePath output_path =
+      command_line->GetSwitchValuePath(kOutputSwitch);
+  if (id.empty() || input_path.empty() || output_path.empty()) {
+    LOG(ERROR) << "usage: convert_resource_to_binary --resource-id=xxx "
+                  "--input=resource.json --output=resource";
+    return 1;
+  }
+
+  std::string json;
+  if (!base::ReadFileToString(input_path, &json)) {
+    LOG(ERROR) << "Failed to read " << input_path;
+    return 1;
+  }
+
+  absl::optional<base::Value> root = base::JSONReader::Read(json);
+  if (!root || !root->is_dict()) {
+    LOG(ERROR) << "Invalid JSON in " << input_path;
+    return 1;
+  }
+
+  const base::expected<std::vector<uint8_t>, std::string> data =
+      brave_ads::ConvertResourceToBinary(id, root->GetDict());
+  if (!data.has_value()) {
+    LOG(ERROR) << data.error();
+    return 1;
+  }
+
+  if (!base::WriteFile(output_path, data.value())) {
+    LOG(ERROR) << "Failed to write " << output_path;
+    return 1;
+  }
+
+  return 0;
+}
@@ -9,23 +9,34 @@
 #include "brave/components/brave_ads/core/internal/resources/resources_util.h"
 
 #include <string>
+#include <type_traits>
 #include <utility>
 
-#include "base/files/file_util.h"
+#include "base/files/file.h"
+#include "base/files/memory_mapped_file.h"
 #include "base/functional/bind.h"
 #include "base/json/json_reader.h"
+#include "base/strings/string_piece.h"
 #include "base/task/thread_pool.h"
 #include "base/types/expected.h"
 #include "base/values.h"
 #include "brave/components/brave_ads/core/internal/ads_client_helper.h"
+#include "brave/components/brave_ads/core/internal/resources/binary_resource_reader.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
 
-namespace base {
-class File;
-}  // namespace base
-
 namespace brave_ads {
 
+// Whether |T| can be created from a binary resource, see
+// binary_resource_reader.h.
+template <typename T, typename = void>
+struct SupportsBinaryResource : std::false_type {};
+
+template <typename T>
+struct SupportsBinaryResource<
+    T,
+    std::void_t<decltype(T::CreateFromBinary(
+        std::declval<BinaryResourceReader&>()))>> : std::true_type {};
+
 template <typename T>
 base::expected<T, std::string> ReadFileAndParseResourceOnBackgroundThread(
     base::File file) {
@@ -33,21 +44,25 @@ base::expected<T, std::string> ReadFileAndParseResourceOnBackgroundThread(
     return base::ok(T{});
   }
 
-  absl::optional<base::Value> root;
-  {
-    // |content| can be up to 10 MB, so we keep the scope of this object to this
-    // block to release its memory as soon as possible.
+  // Resources can be up to 10 MB, so they are mapped rather than read into
+  // memory, and the mapping is released as soon as |T| has been created.
+  base::MemoryMappedFile mapped_file;
+  if (!mapped_file.Initialize(std::move(file))) {
+    return base::unexpected("Failed to read file");
+  }
 
-    std::string content;
-    const base::ScopedFILE scoped_file(base::FileToFILE(std::move(file), "rb"));
-    if (!base::ReadStreamToString(scoped_file.get(), &content)) {
-      return base::unexpected("Failed to read file");
+  if constexpr (SupportsBinaryResource<T>::value) {
+    if (IsBinaryResource(mapped_file.bytes())) {
+      BinaryResourceReader reader(mapped_file.bytes());
+      return T::CreateFromBinary(reader);
     }
+  }
 
-    root = base::JSONReader::Read(content);
-    if (!root || !root->is_dict()) {
-      return base::unexpected("Invalid JSON");
-    }
+  absl::optional<base::Value> root = base::JSONReader::Read(
+      base::StringPiece(reinterpret_cast<const char*>(mapped_file.data()),
+                        mapped_file.length()));
+  if (!root || !root->is_dict()) {
+    return base::unexpected("Invalid JSON");
   }
 
   return T::CreateFromValue(std::move(root).value().TakeDict());
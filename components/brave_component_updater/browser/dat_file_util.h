@@ -8,10 +8,10 @@
 
 #include <memory>
 #include <string>
-#include <utility>
 #include <vector>
 
 #include "base/files/file_path.h"
+#include "base/files/memory_mapped_file.h"
 
 namespace brave_component_updater {
 
@@ -21,32 +21,40 @@ std::string GetDATFileAsString(const base::FilePath& file_path);
 
 DATFileDataBuffer ReadDATFileData(const base::FilePath& dat_file_path);
 
-template <typename T>
-using LoadDATFileDataResult =
-    std::pair<std::unique_ptr<T>, brave_component_updater::DATFileDataBuffer>;
+// Maps |dat_file_path| into memory rather than reading it onto the heap. The
+// pages are backed by the file, so they can be dropped from resident memory
+// once the data has been consumed. Returns nullptr if the file is missing,
+// empty or can't be mapped.
+std::unique_ptr<base::MemoryMappedFile> MapDATFile(
+    const base::FilePath& dat_file_path);
 
+// Deserializes a |T| directly from the mapped contents of |dat_file_path|.
+// Returns nullptr if the file can't be mapped or deserialized.
 template <typename T>
-LoadDATFileDataResult<T> LoadDATFileData(const base::FilePath& dat_file_path) {
-  DATFileDataBuffer buffer = ReadDATFileData(dat_file_path);
-  std::unique_ptr<T> client;
-  client = std::make_unique<T>();
-  if (buffer.empty() ||
-      !client->deserialize(reinterpret_cast<char*>(&buffer.front()),
-                           buffer.size()))
-    client.reset();
-  return LoadDATFileDataResult<T>(std::move(client), std::move(buffer));
+std::unique_ptr<T> LoadDATFileData(const base::FilePath& dat_file_path) {
+  std::unique_ptr<base::MemoryMappedFile> mapped_file =
+      MapDATFile(dat_file_path);
+  if (!mapped_file)
+    return nullptr;
+
+  auto client = std::make_unique<T>();
+  if (!client->deserialize(reinterpret_cast<const char*>(mapped_file->data()),
+                           mapped_file->length()))
+    return nullptr;
+  return client;
 }
 
+// Constructs a |T| from the raw mapped contents of |dat_file_path|. Returns
+// nullptr if the file can't be mapped.
 template <typename T>
-LoadDATFileDataResult<T> LoadRawFileData(const base::FilePath& dat_file_path) {
-  DATFileDataBuffer buffer = ReadDATFileData(dat_file_path);
-  std::unique_ptr<T> client;
-
-  if (!buffer.empty())
-    client = std::make_unique<T>(reinterpret_cast<char*>(&buffer.front()),
-                                 buffer.size());
-
-  return LoadDATFileDataResult<T>(std::move(client), std::move(buffer));
+std::unique_ptr<T> LoadRawFileData(const base::FilePath& dat_file_path) {
+  std::unique_ptr<base::MemoryMappedFile> mapped_file =
+      MapDATFile(dat_file_path);
+  if (!mapped_file)
+    return nullptr;
+
+  return std::make_unique<T>(reinterpret_cast<const char*>(mapped_file->data()),
+                             mapped_file->length());
 }
 
 }  // namespace brave_component_updater
@@ -0,0 +1,84 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_component_updater/browser/dat_file_util.h"
+
+#include <memory>
+#include <string>
+
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave_component_updater {
+
+namespace {
+
+// Minimal stand-in for the component data clients, which can either be
+// deserialized or constructed from raw file contents.
+class TestClient {
+ public:
+  TestClient() = default;
+  TestClient(const char* data, size_t data_size) : data_(data, data_size) {}
+
+  bool deserialize(const char* data, size_t data_size) {
+    data_.assign(data, data_size);
+    return data_ != "invalid";
+  }
+
+  const std::string& data() const { return data_; }
+
+ private:
+  std::string data_;
+};
+
+}  // namespace
+
+class DATFileUtilTest : public testing::Test {
+ public:
+  void SetUp() override { ASSERT_TRUE(temp_dir_.CreateUniqueTempDir()); }
+
+  base::FilePath WriteDATFile(const std::string& contents) {
+    base::FilePath path = temp_dir_.GetPath().AppendASCII("test.dat");
+    EXPECT_TRUE(base::WriteFile(path, contents));
+    return path;
+  }
+
+ protected:
+  base::ScopedTempDir temp_dir_;
+};
+
+TEST_F(DATFileUtilTest, MapDATFile) {
+  std::unique_ptr<base::MemoryMappedFile> mapped_file =
+      MapDATFile(WriteDATFile("dat file contents"));
+  ASSERT_TRUE(mapped_file);
+  EXPECT_EQ("dat file contents",
+            std::string(reinterpret_cast<const char*>(mapped_file->data()),
+                        mapped_file->length()));
+
+  EXPECT_FALSE(MapDATFile(WriteDATFile("")));
+  EXPECT_FALSE(MapDATFile(temp_dir_.GetPath().AppendASCII("missing.dat")));
+}
+
+TEST_F(DATFileUtilTest, LoadDATFileData) {
+  std::unique_ptr<TestClient> client =
+      LoadDATFileData<TestClient>(WriteDATFile("serialized"));
+  ASSERT_TRUE(client);
+  EXPECT_EQ("serialized", client->data());
+
+  EXPECT_FALSE(LoadDATFileData<TestClient>(WriteDATFile("invalid")));
+  EXPECT_FALSE(LoadDATFileData<TestClient>(WriteDATFile("")));
+}
+
+TEST_F(DATFileUtilTest, LoadRawFileData) {
+  std::unique_ptr<TestClient> client =
+      LoadRawFileData<TestClient>(WriteDATFile("raw"));
+  ASSERT_TRUE(client);
+  EXPECT_EQ("raw", client->data());
+
+  EXPECT_FALSE(LoadRawFileData<TestClient>(WriteDATFile("")));
+}
+
+}  // namespace brave_component_updater
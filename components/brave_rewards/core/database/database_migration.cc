@@ -46,6 +46,7 @@
 #include "brave/components/brave_rewards/core/database/migration/migration_v39.h"
 #include "brave/components/brave_rewards/core/database/migration/migration_v4.h"
 #include "brave/components/brave_rewards/core/database/migration/migration_v40.h"
+#include "brave/components/brave_rewards/core/database/migration/migration_v41.h"
 #include "brave/components/brave_rewards/core/database/migration/migration_v5.h"
 #include "brave/components/brave_rewards/core/database/migration/migration_v6.h"
 #include "brave/components/brave_rewards/core/database/migration/migration_v7.h"
@@ -139,7 +140,8 @@ void DatabaseMigration::Start(uint32_t table_version,
                                           migration::v37,
                                           migration::v38,
                                           migration::v39,
-                                          migration::v40};
+                                          migration::v40,
+                                          migration::v41};
 
   DCHECK_LE(target_version, mappings.size());
 
@@ -821,4 +821,19 @@ TEST_F(LedgerDatabaseMigrationTest, Migration_40) {
   EXPECT_FALSE(GetDB()->DoesTableExist("processed_publisher"));
 }
 
+TEST_F(LedgerDatabaseMigrationTest, Migration_41) {
+  DatabaseMigration::SetTargetVersionForTesting(41);
+  InitializeDatabaseAtVersion(40);
+  InitializeLedger();
+  EXPECT_FALSE(GetDB()->DoesTableExist("publisher_prefix_list"));
+
+  sql::Statement sql(GetDB()->GetUniqueStatement(
+      "SELECT typeof(prefixes), hex(prefixes) "
+      "FROM publisher_prefix_list_data"));
+  ASSERT_TRUE(sql.Step());
+  EXPECT_EQ(sql.ColumnString(0), "blob");
+  EXPECT_EQ(sql.ColumnString(1), "0000000100000002FFFFFFFF");
+  EXPECT_FALSE(sql.Step());
+}
+
 }  // namespace brave_rewards::internal
@@ -5,10 +5,13 @@
 
 #include "brave/components/brave_rewards/core/database/database_publisher_prefix_list.h"
 
-#include <tuple>
+#include <algorithm>
 #include <utility>
 
-#include "base/strings/string_number_conversions.h"
+#include "base/check.h"
+#include "base/containers/span.h"
+#include "base/ranges/algorithm.h"
+#include "base/strings/string_piece.h"
 #include "base/strings/stringprintf.h"
 #include "brave/components/brave_rewards/core/database/database_util.h"
 #include "brave/components/brave_rewards/core/ledger_impl.h"
@@ -18,30 +21,63 @@ namespace brave_rewards::internal {
 
 namespace {
 
-const char kTableName[] = "publisher_prefix_list";
+const char kTableName[] = "publisher_prefix_list_data";
 
 constexpr size_t kHashPrefixSize = 4;
-constexpr size_t kMaxInsertRecords = 100'000;
-
-std::tuple<publisher::PrefixIterator, std::string, size_t> GetPrefixInsertList(
-    publisher::PrefixIterator begin,
-    publisher::PrefixIterator end) {
-  DCHECK(begin != end);
-  size_t count = 0;
-  std::string values;
-  publisher::PrefixIterator iter = begin;
-  for (iter = begin; iter != end && count < kMaxInsertRecords;
-       ++count, ++iter) {
-    auto prefix = *iter;
-    DCHECK(prefix.size() >= kHashPrefixSize);
-    std::string hex = base::HexEncode(prefix.data(), kHashPrefixSize);
-    values.append(base::StringPrintf("(x'%s'),", hex.c_str()));
+
+uint32_t ReadHashPrefix(base::StringPiece prefix) {
+  DCHECK(prefix.size() >= kHashPrefixSize);
+  uint32_t value = 0;
+  for (size_t i = 0; i < kHashPrefixSize; ++i) {
+    value = (value << 8) | static_cast<uint8_t>(prefix[i]);
+  }
+  return value;
+}
+
+std::vector<uint32_t> ReadHashPrefixes(
+    const publisher::PrefixListReader& reader) {
+  std::vector<uint32_t> prefixes;
+  prefixes.reserve(reader.size());
+  for (const auto prefix : reader) {
+    prefixes.push_back(ReadHashPrefix(prefix));
+  }
+  // PrefixListReader only spot checks the order of the list.
+  if (!base::ranges::is_sorted(prefixes)) {
+    base::ranges::sort(prefixes);
+  }
+  return prefixes;
+}
+
+std::vector<uint8_t> EncodeHashPrefixes(const std::vector<uint32_t>& prefixes) {
+  std::vector<uint8_t> blob;
+  blob.reserve(prefixes.size() * kHashPrefixSize);
+  for (const uint32_t prefix : prefixes) {
+    for (size_t i = kHashPrefixSize; i > 0; --i) {
+      blob.push_back(static_cast<uint8_t>(prefix >> ((i - 1) * 8)));
+    }
+  }
+  return blob;
+}
+
+absl::optional<std::vector<uint32_t>> DecodeHashPrefixes(
+    base::span<const uint8_t> blob) {
+  if (blob.size() % kHashPrefixSize != 0) {
+    return absl::nullopt;
+  }
+
+  std::vector<uint32_t> prefixes;
+  prefixes.reserve(blob.size() / kHashPrefixSize);
+  for (size_t offset = 0; offset < blob.size(); offset += kHashPrefixSize) {
+    uint32_t value = 0;
+    for (const uint8_t byte : blob.subspan(offset, kHashPrefixSize)) {
+      value = (value << 8) | byte;
+    }
+    prefixes.push_back(value);
   }
-  // Remove last comma
-  if (!values.empty()) {
-    values.pop_back();
+  if (!base::ranges::is_sorted(prefixes)) {
+    base::ranges::sort(prefixes);
   }
-  return {iter, std::move(values), count};
+  return prefixes;
 }
 
 }  // namespace
@@ -56,39 +92,71 @@ DatabasePublisherPrefixList::~DatabasePublisherPrefixList() = default;
 void DatabasePublisherPrefixList::Search(
     const std::string& publisher_key,
     SearchPublisherPrefixListCallback callback) {
-  std::string hex =
-      publisher::GetHashPrefixInHex(publisher_key, kHashPrefixSize);
+  if (prefixes_) {
+    callback(Contains(publisher_key));
+    return;
+  }
+
+  pending_searches_.emplace_back(publisher_key, std::move(callback));
+  if (pending_searches_.size() == 1) {
+    Load();
+  }
+}
 
+void DatabasePublisherPrefixList::Load() {
   auto command = mojom::DBCommand::New();
   command->type = mojom::DBCommand::Type::READ;
-  command->command = base::StringPrintf(
-      "SELECT EXISTS(SELECT hash_prefix FROM %s WHERE hash_prefix = x'%s')",
-      kTableName, hex.c_str());
+  command->command =
+      base::StringPrintf("SELECT prefixes FROM %s LIMIT 1", kTableName);
 
-  command->record_bindings = {mojom::DBCommand::RecordBindingType::BOOL_TYPE};
+  command->record_bindings = {mojom::DBCommand::RecordBindingType::BLOB_TYPE};
 
   auto transaction = mojom::DBTransaction::New();
   transaction->commands.push_back(std::move(command));
 
-  ledger_->RunDBTransaction(
-      std::move(transaction), [callback](mojom::DBCommandResponsePtr response) {
-        if (!response || !response->result ||
-            response->status != mojom::DBCommandResponse::Status::RESPONSE_OK ||
-            response->result->get_records().empty()) {
-          BLOG(0,
-               "Unexpected database result while searching "
-               "publisher prefix list.");
-          callback(false);
-          return;
-        }
-        callback(GetBoolColumn(response->result->get_records()[0].get(), 0));
-      });
+  ledger_->RunDBTransaction(std::move(transaction),
+                            [this](mojom::DBCommandResponsePtr response) {
+                              OnLoad(std::move(response));
+                            });
+}
+
+void DatabasePublisherPrefixList::OnLoad(
+    mojom::DBCommandResponsePtr response) {
+  // The list may have been reset while it was being loaded.
+  if (!prefixes_) {
+    if (!response || !response->result ||
+        response->status != mojom::DBCommandResponse::Status::RESPONSE_OK) {
+      BLOG(0, "Unexpected database result while loading "
+              "publisher prefix list.");
+      // Retry on the next search.
+      auto pending_searches = std::exchange(pending_searches_, {});
+      for (const auto& [publisher_key, callback] : pending_searches) {
+        callback(false);
+      }
+      return;
+    }
+
+    const auto& records = response->result->get_records();
+    if (records.empty()) {
+      prefixes_.emplace();
+    } else {
+      prefixes_ = DecodeHashPrefixes(GetBlobColumn(records[0].get(), 0));
+      if (!prefixes_) {
+        BLOG(0, "Publisher prefix list is ill-formed");
+        prefixes_.emplace();
+      }
+    }
+
+    BLOG(1, "Loaded " << prefixes_->size() << " publisher prefixes");
+  }
+
+  RunPendingSearches();
 }
 
 void DatabasePublisherPrefixList::Reset(publisher::PrefixListReader reader,
                                         LegacyResultCallback callback) {
-  if (reader_) {
-    BLOG(1, "Publisher prefix list batch insert in progress");
+  if (reset_in_progress_) {
+    BLOG(1, "Publisher prefix list reset in progress");
     callback(mojom::Result::LEDGER_ERROR);
     return;
   }
@@ -97,58 +165,78 @@ void DatabasePublisherPrefixList::Reset(publisher::PrefixListReader reader,
     callback(mojom::Result::LEDGER_ERROR);
     return;
   }
-  reader_ = std::move(reader);
-  InsertNext(reader_->begin(), callback);
-}
-
-void DatabasePublisherPrefixList::InsertNext(publisher::PrefixIterator begin,
-                                             LegacyResultCallback callback) {
-  DCHECK(reader_ && begin != reader_->end());
-
-  auto transaction = mojom::DBTransaction::New();
 
-  if (begin == reader_->begin()) {
-    BLOG(1, "Clearing publisher prefixes table");
-    auto command = mojom::DBCommand::New();
-    command->type = mojom::DBCommand::Type::RUN;
-    command->command = base::StringPrintf("DELETE FROM %s", kTableName);
-    transaction->commands.push_back(std::move(command));
+  std::vector<uint32_t> prefixes = ReadHashPrefixes(reader);
+  // Fetched lists are often the one that is already stored.
+  if (prefixes_ == prefixes) {
+    BLOG(1, "Publisher prefix list is unchanged");
+    callback(mojom::Result::LEDGER_OK);
+    return;
   }
 
-  auto insert_tuple = GetPrefixInsertList(begin, reader_->end());
+  BLOG(1, "Storing " << prefixes.size() << " publisher prefixes");
 
-  BLOG(1, "Inserting " << std::get<size_t>(insert_tuple)
-                       << " records into publisher prefix table");
+  auto transaction = mojom::DBTransaction::New();
 
   auto command = mojom::DBCommand::New();
   command->type = mojom::DBCommand::Type::RUN;
-  command->command = base::StringPrintf(
-      "INSERT OR REPLACE INTO %s (hash_prefix) VALUES %s", kTableName,
-      std::get<std::string>(insert_tuple).data());
+  command->command = base::StringPrintf("DELETE FROM %s", kTableName);
+  transaction->commands.push_back(std::move(command));
 
+  command = mojom::DBCommand::New();
+  command->type = mojom::DBCommand::Type::RUN;
+  command->command =
+      base::StringPrintf("INSERT INTO %s (prefixes) VALUES (?)", kTableName);
+  BindBlob(command.get(), 0, EncodeHashPrefixes(prefixes));
   transaction->commands.push_back(std::move(command));
 
-  auto iter = std::get<publisher::PrefixIterator>(insert_tuple);
+  reset_in_progress_ = true;
 
   ledger_->RunDBTransaction(
       std::move(transaction),
-      [this, iter, callback](mojom::DBCommandResponsePtr response) {
-        if (!response ||
-            response->status != mojom::DBCommandResponse::Status::RESPONSE_OK) {
-          reader_ = absl::nullopt;
-          callback(mojom::Result::LEDGER_ERROR);
-          return;
-        }
-
-        if (iter == reader_->end()) {
-          reader_ = absl::nullopt;
-          callback(mojom::Result::LEDGER_OK);
-          return;
-        }
-
-        InsertNext(iter, callback);
+      [this, prefixes = std::move(prefixes),
+       callback](mojom::DBCommandResponsePtr response) mutable {
+        OnReset(std::move(prefixes), callback, std::move(response));
       });
 }
 
+void DatabasePublisherPrefixList::OnReset(
+    std::vector<uint32_t> prefixes,
+    LegacyResultCallback callback,
+    mojom::DBCommandResponsePtr response) {
+  reset_in_progress_ = false;
+
+  if (!response ||
+      response->status != mojom::DBCommandResponse::Status::RESPONSE_OK) {
+    callback(mojom::Result::LEDGER_ERROR);
+    return;
+  }
+
+  // Searches only ever see either the previous or the new list.
+  prefixes_ = std::move(prefixes);
+  RunPendingSearches();
+
+  callback(mojom::Result::LEDGER_OK);
+}
+
+void DatabasePublisherPrefixList::RunPendingSearches() {
+  DCHECK(prefixes_);
+
+  auto pending_searches = std::exchange(pending_searches_, {});
+  for (const auto& [publisher_key, callback] : pending_searches) {
+    callback(Contains(publisher_key));
+  }
+}
+
+bool DatabasePublisherPrefixList::Contains(
+    const std::string& publisher_key) const {
+  DCHECK(prefixes_);
+
+  const std::string prefix =
+      publisher::GetHashPrefixRaw(publisher_key, kHashPrefixSize);
+  return std::binary_search(prefixes_->cbegin(), prefixes_->cend(),
+                            ReadHashPrefix(prefix));
+}
+
 }  // namespace database
 }  // namespace brave_rewards::internal
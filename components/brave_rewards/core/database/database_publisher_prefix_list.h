@@ -6,7 +6,10 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_REWARDS_CORE_DATABASE_DATABASE_PUBLISHER_PREFIX_LIST_H_
 #define BRAVE_COMPONENTS_BRAVE_REWARDS_CORE_DATABASE_DATABASE_PUBLISHER_PREFIX_LIST_H_
 
+#include <cstdint>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "brave/components/brave_rewards/core/database/database_table.h"
 #include "brave/components/brave_rewards/core/publisher/prefix_list_reader.h"
@@ -17,6 +20,8 @@ namespace database {
 
 using SearchPublisherPrefixListCallback = std::function<void(bool)>;
 
+// Publisher prefixes are searched in memory. The sorted list is loaded from
+// the database on the first search and replaced whenever the list is reset.
 class DatabasePublisherPrefixList : public DatabaseTable {
  public:
   explicit DatabasePublisherPrefixList(LedgerImpl& ledger);
@@ -28,10 +33,23 @@ class DatabasePublisherPrefixList : public DatabaseTable {
               SearchPublisherPrefixListCallback callback);
 
  private:
-  void InsertNext(publisher::PrefixIterator begin,
-                  LegacyResultCallback callback);
+  void Load();
 
-  absl::optional<publisher::PrefixListReader> reader_;
+  void OnLoad(mojom::DBCommandResponsePtr response);
+
+  void OnReset(std::vector<uint32_t> prefixes,
+               LegacyResultCallback callback,
+               mojom::DBCommandResponsePtr response);
+
+  void RunPendingSearches();
+
+  bool Contains(const std::string& publisher_key) const;
+
+  // Sorted big-endian values of the 4-byte hash prefixes, unset until loaded.
+  absl::optional<std::vector<uint32_t>> prefixes_;
+  bool reset_in_progress_ = false;
+  std::vector<std::pair<std::string, SearchPublisherPrefixListCallback>>
+      pending_searches_;
 };
 
 }  // namespace database
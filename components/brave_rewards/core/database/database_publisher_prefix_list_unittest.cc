@@ -3,16 +3,17 @@
  * License, v. 2.0. If a copy of the MPL was not distributed with this file,
  * You can obtain one at https://mozilla.org/MPL/2.0/. */
 
+#include <algorithm>
 #include <string>
 #include <utility>
 #include <vector>
 
-#include "base/big_endian.h"
-#include "base/strings/string_piece.h"
+#include "base/strings/strcat.h"
 #include "base/test/task_environment.h"
 #include "brave/components/brave_rewards/core/database/database_publisher_prefix_list.h"
 #include "brave/components/brave_rewards/core/ledger_client_mock.h"
 #include "brave/components/brave_rewards/core/ledger_impl_mock.h"
+#include "brave/components/brave_rewards/core/publisher/prefix_util.h"
 #include "brave/components/brave_rewards/core/publisher/protos/publisher_prefix_list.pb.h"
 
 // npm run test -- brave_unit_tests --filter=DatabasePublisherPrefixListTest.*
@@ -25,16 +26,17 @@ namespace database {
 
 class DatabasePublisherPrefixListTest : public ::testing::Test {
  protected:
-  publisher::PrefixListReader CreateReader(uint32_t prefix_count) {
-    publisher::PrefixListReader reader;
-    if (prefix_count == 0) {
-      return reader;
+  publisher::PrefixListReader CreateReader(
+      const std::vector<std::string>& publisher_keys) {
+    std::vector<std::string> hash_prefixes;
+    for (const auto& publisher_key : publisher_keys) {
+      hash_prefixes.push_back(publisher::GetHashPrefixRaw(publisher_key, 4));
     }
+    std::sort(hash_prefixes.begin(), hash_prefixes.end());
 
     std::string prefixes;
-    prefixes.resize(prefix_count * 4);
-    for (uint32_t i = 0; i < prefix_count; ++i) {
-      base::WriteBigEndian(&prefixes[i * 4], i);
+    for (const auto& hash_prefix : hash_prefixes) {
+      prefixes.append(hash_prefix);
     }
 
     publishers_pb::PublisherPrefixList message;
@@ -46,48 +48,134 @@ class DatabasePublisherPrefixListTest : public ::testing::Test {
 
     std::string out;
     message.SerializeToString(&out);
+    publisher::PrefixListReader reader;
     reader.Parse(out);
     return reader;
   }
 
+  bool Search(const std::string& publisher_key) {
+    absl::optional<bool> exists;
+    database_prefix_list_.Search(publisher_key,
+                                 [&exists](bool value) { exists = value; });
+    task_environment_.RunUntilIdle();
+    EXPECT_TRUE(exists.has_value());
+    return exists.value_or(false);
+  }
+
   base::test::TaskEnvironment task_environment_;
   MockLedgerImpl mock_ledger_impl_;
   DatabasePublisherPrefixList database_prefix_list_{mock_ledger_impl_};
 };
 
 TEST_F(DatabasePublisherPrefixListTest, Reset) {
+  std::vector<std::string> hash_prefixes = {
+      publisher::GetHashPrefixRaw("brave.com", 4),
+      publisher::GetHashPrefixRaw("basicattentiontoken.org", 4)};
+  std::sort(hash_prefixes.begin(), hash_prefixes.end());
+  const std::string raw_prefixes =
+      base::StrCat({hash_prefixes[0], hash_prefixes[1]});
+  const std::vector<uint8_t> expected_prefixes(raw_prefixes.begin(),
+                                               raw_prefixes.end());
+
   EXPECT_CALL(*mock_ledger_impl_.mock_client(), RunDBTransaction(_, _))
-      .Times(2)
-      .WillOnce([](mojom::DBTransactionPtr transaction, auto callback) {
+      .Times(1)
+      .WillOnce([&expected_prefixes](mojom::DBTransactionPtr transaction,
+                                     auto callback) {
         EXPECT_TRUE(transaction);
         EXPECT_EQ(transaction->commands.size(), 2u);
         EXPECT_EQ(transaction->commands[0]->command,
-                  "DELETE FROM publisher_prefix_list");
-        EXPECT_TRUE(base::StartsWith(
-            transaction->commands[1]->command,
-            "INSERT OR REPLACE INTO publisher_prefix_list (hash_prefix) "
-            "VALUES (x'00000000'),(x'00000001'),(x'00000002'),"));
+                  "DELETE FROM publisher_prefix_list_data");
+        EXPECT_EQ(transaction->commands[1]->command,
+                  "INSERT INTO publisher_prefix_list_data (prefixes) "
+                  "VALUES (?)");
+        EXPECT_EQ(transaction->commands[1]->bindings.size(), 1u);
+        EXPECT_EQ(
+            transaction->commands[1]->bindings[0]->value->get_blob_value(),
+            expected_prefixes);
 
         auto response = mojom::DBCommandResponse::New();
         response->status = mojom::DBCommandResponse::Status::RESPONSE_OK;
         std::move(callback).Run(std::move(response));
-      })
+      });
+
+  MockFunction<LegacyResultCallback> callback;
+  EXPECT_CALL(callback, Call(mojom::Result::LEDGER_OK)).Times(1);
+  database_prefix_list_.Reset(
+      CreateReader({"brave.com", "basicattentiontoken.org"}),
+      callback.AsStdFunction());
+
+  task_environment_.RunUntilIdle();
+
+  // The reset list is searched without querying the database.
+  EXPECT_TRUE(Search("brave.com"));
+  EXPECT_TRUE(Search("basicattentiontoken.org"));
+  EXPECT_FALSE(Search("example.com"));
+}
+
+TEST_F(DatabasePublisherPrefixListTest, ResetUnchanged) {
+  EXPECT_CALL(*mock_ledger_impl_.mock_client(), RunDBTransaction(_, _))
+      .Times(1)
       .WillOnce([](mojom::DBTransactionPtr transaction, auto callback) {
-        EXPECT_TRUE(transaction);
-        EXPECT_EQ(transaction->commands.size(), 1u);
-        EXPECT_EQ(transaction->commands[0]->command,
-                  "INSERT OR REPLACE INTO publisher_prefix_list (hash_prefix) "
-                  "VALUES (x'000186A0')");
+        auto response = mojom::DBCommandResponse::New();
+        response->status = mojom::DBCommandResponse::Status::RESPONSE_OK;
+        std::move(callback).Run(std::move(response));
+      });
 
+  MockFunction<LegacyResultCallback> callback;
+  EXPECT_CALL(callback, Call(mojom::Result::LEDGER_OK)).Times(2);
+  database_prefix_list_.Reset(CreateReader({"brave.com"}),
+                              callback.AsStdFunction());
+  task_environment_.RunUntilIdle();
+
+  // The same list isn't written again.
+  database_prefix_list_.Reset(CreateReader({"brave.com"}),
+                              callback.AsStdFunction());
+  task_environment_.RunUntilIdle();
+  EXPECT_TRUE(Search("brave.com"));
+}
+
+TEST_F(DatabasePublisherPrefixListTest, ResetFailed) {
+  EXPECT_CALL(*mock_ledger_impl_.mock_client(), RunDBTransaction(_, _))
+      .Times(1)
+      .WillOnce([](mojom::DBTransactionPtr transaction, auto callback) {
         std::move(callback).Run(db_error_response->Clone());
       });
 
   MockFunction<LegacyResultCallback> callback;
-  EXPECT_CALL(callback, Call).Times(1);
-  database_prefix_list_.Reset(CreateReader(100'001), callback.AsStdFunction());
+  EXPECT_CALL(callback, Call(mojom::Result::LEDGER_ERROR)).Times(1);
+  database_prefix_list_.Reset(CreateReader({"brave.com"}),
+                              callback.AsStdFunction());
 
   task_environment_.RunUntilIdle();
 }
 
+TEST_F(DatabasePublisherPrefixListTest, LoadOnFirstSearch) {
+  EXPECT_CALL(*mock_ledger_impl_.mock_client(), RunDBTransaction(_, _))
+      .Times(1)
+      .WillOnce([](mojom::DBTransactionPtr transaction, auto callback) {
+        EXPECT_TRUE(transaction);
+        EXPECT_EQ(transaction->commands.size(), 1u);
+        EXPECT_EQ(transaction->commands[0]->type,
+                  mojom::DBCommand::Type::READ);
+
+        auto record = mojom::DBRecord::New();
+        const std::string hash_prefix =
+            publisher::GetHashPrefixRaw("brave.com", 4);
+        record->fields.push_back(mojom::DBValue::NewBlobValue(
+            std::vector<uint8_t>(hash_prefix.begin(), hash_prefix.end())));
+        std::vector<mojom::DBRecordPtr> records;
+        records.push_back(std::move(record));
+
+        auto response = mojom::DBCommandResponse::New();
+        response->status = mojom::DBCommandResponse::Status::RESPONSE_OK;
+        response->result =
+            mojom::DBCommandResult::NewRecords(std::move(records));
+        std::move(callback).Run(std::move(response));
+      });
+
+  EXPECT_TRUE(Search("brave.com"));
+  EXPECT_FALSE(Search("example.com"));
+}
+
 }  // namespace database
 }  // namespace brave_rewards::internal
@@ -11,7 +11,7 @@
 
 namespace {
 
-const int kCurrentVersionNumber = 40;
+const int kCurrentVersionNumber = 41;
 const int kCompatibleVersionNumber = 1;
 
 }  // namespace
@@ -91,6 +91,19 @@ void BindString(mojom::DBCommand* command,
   command->bindings.push_back(std::move(binding));
 }
 
+void BindBlob(mojom::DBCommand* command,
+              const int index,
+              std::vector<uint8_t> value) {
+  if (!command) {
+    return;
+  }
+
+  auto binding = mojom::DBCommandBinding::New();
+  binding->index = index;
+  binding->value = mojom::DBValue::NewBlobValue(std::move(value));
+  command->bindings.push_back(std::move(binding));
+}
+
 int32_t GetCurrentVersion() {
   return kCurrentVersionNumber;
 }
@@ -175,6 +188,19 @@ std::string GetStringColumn(mojom::DBRecord* record, const int index) {
   return record->fields.at(index)->get_string_value();
 }
 
+std::vector<uint8_t> GetBlobColumn(mojom::DBRecord* record, const int index) {
+  if (!record || static_cast<int>(record->fields.size()) < index) {
+    return {};
+  }
+
+  if (!record->fields.at(index)->is_blob_value()) {
+    DCHECK(false);
+    return {};
+  }
+
+  return record->fields.at(index)->get_blob_value();
+}
+
 std::string GenerateStringInCase(const std::vector<std::string>& items) {
   if (items.empty()) {
     return "";
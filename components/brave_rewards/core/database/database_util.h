@@ -6,6 +6,7 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_REWARDS_CORE_DATABASE_DATABASE_UTIL_H_
 #define BRAVE_COMPONENTS_BRAVE_REWARDS_CORE_DATABASE_DATABASE_UTIL_H_
 
+#include <cstdint>
 #include <map>
 #include <string>
 #include <vector>
@@ -32,6 +33,10 @@ void BindString(mojom::DBCommand* command,
                 const int index,
                 const std::string& value);
 
+void BindBlob(mojom::DBCommand* command,
+              const int index,
+              std::vector<uint8_t> value);
+
 int32_t GetCurrentVersion();
 
 int32_t GetCompatibleVersion();
@@ -49,6 +54,8 @@ bool GetBoolColumn(mojom::DBRecord* record, const int index);
 
 std::string GetStringColumn(mojom::DBRecord* record, const int index);
 
+std::vector<uint8_t> GetBlobColumn(mojom::DBRecord* record, const int index);
+
 std::string GenerateStringInCase(const std::vector<std::string>& items);
 
 }  // namespace database
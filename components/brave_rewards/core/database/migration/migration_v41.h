@@ -0,0 +1,29 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_REWARDS_CORE_DATABASE_MIGRATION_MIGRATION_V41_H_
+#define BRAVE_COMPONENTS_BRAVE_REWARDS_CORE_DATABASE_MIGRATION_MIGRATION_V41_H_
+
+namespace brave_rewards::internal::database::migration {
+
+// Migration 41 packs the publisher prefix list into a single blob of sorted
+// 4-byte prefixes, which is loaded into memory for lookups. group_concat()
+// keeps the bytes of the blobs it joins, including zero bytes.
+constexpr char v41[] = R"sql(
+  CREATE TABLE publisher_prefix_list_data (prefixes BLOB NOT NULL);
+
+  INSERT INTO publisher_prefix_list_data (prefixes)
+  SELECT prefixes FROM (
+    SELECT CAST(group_concat(hash_prefix, '') AS BLOB) AS prefixes FROM (
+      SELECT hash_prefix FROM publisher_prefix_list ORDER BY hash_prefix
+    )
+  ) WHERE prefixes IS NOT NULL;
+
+  DROP TABLE IF EXISTS publisher_prefix_list;
+)sql";
+
+}  // namespace brave_rewards::internal::database::migration
+
+#endif  // BRAVE_COMPONENTS_BRAVE_REWARDS_CORE_DATABASE_MIGRATION_MIGRATION_V41_H_
@@ -49,6 +49,10 @@ void HandleBinding(sql::Statement* statement,
       statement->BindNull(binding.index);
       return;
     }
+    case mojom::DBValue::Tag::kBlobValue: {
+      statement->BindBlob(binding.index, binding.value->get_blob_value());
+      return;
+    }
     default: {
       NOTREACHED();
     }
@@ -88,6 +92,12 @@ mojom::DBRecordPtr CreateRecord(
         value = mojom::DBValue::NewBoolValue(statement->ColumnBool(column));
         break;
       }
+      case mojom::DBCommand::RecordBindingType::BLOB_TYPE: {
+        std::vector<uint8_t> blob;
+        statement->ColumnBlobAsVector(column, &blob);
+        value = mojom::DBValue::NewBlobValue(std::move(blob));
+        break;
+      }
       default: {
         NOTREACHED();
       }
@@ -0,0 +1,197 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/ad_block_class_id_selectors_cache.h"
+
+#include <utility>
+
+#include "base/containers/contains.h"
+#include "base/metrics/histogram_macros.h"
+#include "base/strings/strcat.h"
+#include "base/strings/string_piece.h"
+#include "base/strings/string_util.h"
+#include "brave/components/brave_shields/browser/ad_block_engine.h"
+
+namespace brave_shields {
+
+namespace {
+
+// Most class and id lookups don't match any selector, so entries are small.
+constexpr size_t kMaxCachedClassIdSelectors = 4096;
+
+// Whether |selector| contains |key|, a class (".name") or id ("#name"), as a
+// whole simple selector rather than as the prefix of a longer name.
+bool SelectorRefersTo(base::StringPiece selector, base::StringPiece key) {
+  for (size_t pos = selector.find(key); pos != base::StringPiece::npos;
+       pos = selector.find(key, pos + 1)) {
+    const size_t end = pos + key.size();
+    if (end == selector.size()) {
+      return true;
+    }
+    const char next = selector[end];
+    // Non-ASCII characters and escapes are part of a name too.
+    if (!base::IsAsciiAlphaNumeric(next) && next != '-' && next != '_' &&
+        next != '\\' && static_cast<unsigned char>(next) < 0x80) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+AdBlockClassIdSelectorsCache::Selectors::Selectors() = default;
+AdBlockClassIdSelectorsCache::Selectors::Selectors(Selectors&&) = default;
+AdBlockClassIdSelectorsCache::Selectors&
+AdBlockClassIdSelectorsCache::Selectors::operator=(Selectors&&) = default;
+AdBlockClassIdSelectorsCache::Selectors::~Selectors() = default;
+
+AdBlockClassIdSelectorsCache::AdBlockClassIdSelectorsCache(
+    AdBlockEngine* default_engine,
+    AdBlockEngine* additional_engine)
+    : default_engine_(default_engine),
+      additional_engine_(additional_engine),
+      cache_(kMaxCachedClassIdSelectors) {
+  DCHECK(default_engine_);
+  DCHECK(additional_engine_);
+  DETACH_FROM_SEQUENCE(sequence_checker_);
+}
+
+AdBlockClassIdSelectorsCache::~AdBlockClassIdSelectorsCache() = default;
+
+base::Value::Dict AdBlockClassIdSelectorsCache::HiddenClassIdSelectors(
+    const std::vector<std::string>& classes,
+    const std::vector<std::string>& ids,
+    const std::vector<std::string>& exceptions) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  if (default_engine_->update_count() != default_engine_updates_ ||
+      additional_engine_->update_count() != additional_engine_updates_) {
+    cache_.Clear();
+    generic_selectors_ = Selectors();
+    default_engine_updates_ = default_engine_->update_count();
+    additional_engine_updates_ = additional_engine_->update_count();
+  }
+
+  // Exceptions only filter the matched selectors, so they are applied here
+  // rather than being part of the cache key. Sets, since names which share a
+  // selector, e.g. ".a.b", would otherwise add it more than once.
+  const base::flat_set<std::string> exception_set(exceptions);
+  base::flat_set<std::string> hide_selectors;
+  base::flat_set<std::string> force_hide_selectors;
+  auto append_selectors = [&exception_set](
+                              const std::vector<std::string>& selectors,
+                              base::flat_set<std::string>& into) {
+    for (const auto& selector : selectors) {
+      if (!exception_set.contains(selector)) {
+        into.insert(selector);
+      }
+    }
+  };
+  auto add_selectors = [&](const Selectors& selectors) {
+    append_selectors(selectors.hide_selectors, hide_selectors);
+    append_selectors(selectors.force_hide_selectors, force_hide_selectors);
+  };
+
+  // Cached names are answered right away, the rest are collected so that each
+  // engine is queried once for the whole batch.
+  size_t cache_hits = 0;
+  base::flat_set<std::string> missed_keys;
+  std::vector<std::string> missed_classes;
+  std::vector<std::string> missed_ids;
+  auto lookup = [&](base::StringPiece prefix, const std::string& name,
+                    std::vector<std::string>& missed_names) {
+    std::string key = base::StrCat({prefix, name});
+    auto it = cache_.Get(key);
+    if (it != cache_.end()) {
+      ++cache_hits;
+      add_selectors(it->second);
+    } else if (missed_keys.insert(std::move(key)).second) {
+      missed_names.push_back(name);
+    }
+  };
+  for (const auto& class_name : classes) {
+    lookup(".", class_name, missed_classes);
+  }
+  for (const auto& id : ids) {
+    lookup("#", id, missed_ids);
+  }
+  if (!classes.empty() || !ids.empty()) {
+    UMA_HISTOGRAM_PERCENTAGE("Brave.Adblock.ClassIdSelectorsCacheHitRate",
+                             cache_hits * 100 / (classes.size() + ids.size()));
+  }
+
+  if (!missed_keys.empty()) {
+    for (auto& [key, selectors] :
+         QueryEngines(missed_keys, missed_classes, missed_ids)) {
+      add_selectors(selectors);
+      cache_.Put(key, std::move(selectors));
+    }
+  }
+  if (!classes.empty() || !ids.empty()) {
+    add_selectors(generic_selectors_);
+  }
+
+  auto to_list = [](base::flat_set<std::string> selectors) {
+    base::Value::List list;
+    for (auto& selector : selectors.extract()) {
+      list.Append(std::move(selector));
+    }
+    return list;
+  };
+  base::Value::Dict result;
+  result.Set("hide_selectors", to_list(std::move(hide_selectors)));
+  result.Set("force_hide_selectors", to_list(std::move(force_hide_selectors)));
+  return result;
+}
+
+// static
+void AdBlockClassIdSelectorsCache::SplitSelectors(
+    base::Value::List selectors,
+    bool force_hide,
+    SelectorsByKey& selectors_by_key,
+    Selectors& generic_selectors) {
+  auto select = [force_hide](Selectors& selectors) -> auto& {
+    return force_hide ? selectors.force_hide_selectors
+                      : selectors.hide_selectors;
+  };
+  for (auto& item : selectors) {
+    if (!item.is_string()) {
+      continue;
+    }
+    std::string selector = std::move(item).TakeString();
+    bool named = false;
+    for (auto& [key, key_selectors] : selectors_by_key) {
+      if (SelectorRefersTo(selector, key)) {
+        select(key_selectors).push_back(selector);
+        named = true;
+      }
+    }
+    if (!named && !base::Contains(select(generic_selectors), selector)) {
+      select(generic_selectors).push_back(std::move(selector));
+    }
+  }
+}
+
+AdBlockClassIdSelectorsCache::SelectorsByKey
+AdBlockClassIdSelectorsCache::QueryEngines(
+    const base::flat_set<std::string>& keys,
+    const std::vector<std::string>& classes,
+    const std::vector<std::string>& ids) {
+  SelectorsByKey selectors_by_key;
+  for (const auto& key : keys) {
+    selectors_by_key.emplace(key, Selectors());
+  }
+
+  // The engines return the selectors of the whole batch, so they are split by
+  // the names they refer to.
+  SplitSelectors(default_engine_->HiddenClassIdSelectors(classes, ids, {}),
+                 /*force_hide=*/false, selectors_by_key, generic_selectors_);
+  SplitSelectors(additional_engine_->HiddenClassIdSelectors(classes, ids, {}),
+                 /*force_hide=*/true, selectors_by_key, generic_selectors_);
+  return selectors_by_key;
+}
+
+}  // namespace brave_shields
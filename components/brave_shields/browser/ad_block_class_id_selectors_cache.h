@@ -0,0 +1,100 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_CLASS_ID_SELECTORS_CACHE_H_
+#define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_CLASS_ID_SELECTORS_CACHE_H_
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "base/containers/flat_map.h"
+#include "base/containers/flat_set.h"
+#include "base/containers/lru_cache.h"
+#include "base/gtest_prod_util.h"
+#include "base/memory/raw_ptr.h"
+#include "base/sequence_checker.h"
+#include "base/values.h"
+
+namespace brave_shields {
+
+class AdBlockEngine;
+
+// Keeps the selectors matched by each class and id in
+// AdBlockService::HiddenClassIdSelectors, shared by every frame, so that
+// names seen across many pages only query the engines once. Entries are
+// dropped whenever either engine loads new filters.
+//
+// Must be used on the sequence of the engines, which have to outlive it.
+class AdBlockClassIdSelectorsCache {
+ public:
+  AdBlockClassIdSelectorsCache(AdBlockEngine* default_engine,
+                               AdBlockEngine* additional_engine);
+  AdBlockClassIdSelectorsCache(const AdBlockClassIdSelectorsCache&) = delete;
+  AdBlockClassIdSelectorsCache& operator=(const AdBlockClassIdSelectorsCache&) =
+      delete;
+  ~AdBlockClassIdSelectorsCache();
+
+  // Returns "hide_selectors" from the default engine and "force_hide_selectors"
+  // from the additional engine, without |exceptions|.
+  base::Value::Dict HiddenClassIdSelectors(
+      const std::vector<std::string>& classes,
+      const std::vector<std::string>& ids,
+      const std::vector<std::string>& exceptions);
+
+ private:
+  FRIEND_TEST_ALL_PREFIXES(AdBlockClassIdSelectorsCacheTest, SplitSelectors);
+
+  // Selectors before exceptions are applied.
+  struct Selectors {
+    Selectors();
+    Selectors(Selectors&&);
+    Selectors& operator=(Selectors&&);
+    ~Selectors();
+
+    // From the default engine.
+    std::vector<std::string> hide_selectors;
+    // From the additional engine.
+    std::vector<std::string> force_hide_selectors;
+  };
+
+  // Keyed by class (".name") or id ("#name").
+  using SelectorsByKey = base::flat_map<std::string, Selectors>;
+
+  // Gives each of |selectors| to the keys of |selectors_by_key| that it
+  // names. A selector which names none of them, e.g. one using an escaped
+  // name, is added to |generic_selectors| instead.
+  static void SplitSelectors(base::Value::List selectors,
+                             bool force_hide,
+                             SelectorsByKey& selectors_by_key,
+                             Selectors& generic_selectors);
+
+  // Queries both engines once for all of |classes| and |ids|, whose cache keys
+  // are |keys|.
+  SelectorsByKey QueryEngines(const base::flat_set<std::string>& keys,
+                              const std::vector<std::string>& classes,
+                              const std::vector<std::string>& ids);
+
+  const raw_ptr<AdBlockEngine> default_engine_;
+  const raw_ptr<AdBlockEngine> additional_engine_;
+
+  base::LRUCache<std::string, Selectors> cache_
+      GUARDED_BY_CONTEXT(sequence_checker_);
+  // Selectors which didn't name any of the classes and ids they were matched
+  // for. They are still generic hiding rules, so they are returned for every
+  // lookup rather than stored under each of those names.
+  Selectors generic_selectors_ GUARDED_BY_CONTEXT(sequence_checker_);
+  // AdBlockEngine::update_count() of the engines that |cache_| is for.
+  uint64_t default_engine_updates_ GUARDED_BY_CONTEXT(sequence_checker_) = 0;
+  uint64_t additional_engine_updates_ GUARDED_BY_CONTEXT(sequence_checker_) =
+      0;
+
+  SEQUENCE_CHECKER(sequence_checker_);
+};
+
+}  // namespace brave_shields
+
+#endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_CLASS_ID_SELECTORS_CACHE_H_
@@ -0,0 +1,155 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/ad_block_class_id_selectors_cache.h"
+
+#include <string>
+#include <vector>
+
+#include "base/test/metrics/histogram_tester.h"
+#include "brave/components/brave_shields/browser/ad_block_engine.h"
+#include "testing/gmock/include/gmock/gmock.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+using testing::ElementsAre;
+using testing::IsEmpty;
+
+namespace brave_shields {
+
+namespace {
+
+constexpr char kHitRateHistogram[] =
+    "Brave.Adblock.ClassIdSelectorsCacheHitRate";
+
+void LoadRules(AdBlockEngine* engine, const std::string& rules) {
+  engine->Load(false, DATFileDataBuffer(rules.begin(), rules.end()), "[]");
+}
+
+std::vector<std::string> GetSelectors(const base::Value::Dict& result,
+                                      const std::string& key) {
+  std::vector<std::string> selectors;
+  const base::Value::List* list = result.FindList(key);
+  if (list) {
+    for (const auto& selector : *list) {
+      selectors.push_back(selector.GetString());
+    }
+  }
+  return selectors;
+}
+
+}  // namespace
+
+class AdBlockClassIdSelectorsCacheTest : public testing::Test {
+ public:
+  AdBlockClassIdSelectorsCacheTest()
+      : cache_(&default_engine_, &additional_engine_) {}
+  ~AdBlockClassIdSelectorsCacheTest() override = default;
+
+ protected:
+  AdBlockEngine default_engine_;
+  AdBlockEngine additional_engine_;
+  AdBlockClassIdSelectorsCache cache_;
+};
+
+TEST_F(AdBlockClassIdSelectorsCacheTest, CachesLookups) {
+  LoadRules(&default_engine_, "##.ad\n###banner");
+
+  base::HistogramTester histogram_tester;
+  base::Value::Dict result = cache_.HiddenClassIdSelectors({"ad"}, {"banner"},
+                                                           {});
+  EXPECT_THAT(GetSelectors(result, "hide_selectors"),
+              ElementsAre("#banner", ".ad"));
+  EXPECT_THAT(GetSelectors(result, "force_hide_selectors"), IsEmpty());
+  histogram_tester.ExpectUniqueSample(kHitRateHistogram, 0, 1);
+
+  result = cache_.HiddenClassIdSelectors({"ad"}, {"banner"}, {});
+  EXPECT_THAT(GetSelectors(result, "hide_selectors"),
+              ElementsAre("#banner", ".ad"));
+  histogram_tester.ExpectBucketCount(kHitRateHistogram, 100, 1);
+
+  // Only the new id has to be looked up.
+  result = cache_.HiddenClassIdSelectors({"ad"}, {"footer"}, {});
+  EXPECT_THAT(GetSelectors(result, "hide_selectors"), ElementsAre(".ad"));
+  histogram_tester.ExpectBucketCount(kHitRateHistogram, 50, 1);
+}
+
+TEST_F(AdBlockClassIdSelectorsCacheTest, SplitsBatchedLookups) {
+  LoadRules(&default_engine_, "##.ad\n##.promo > div");
+
+  cache_.HiddenClassIdSelectors({"ad", "promo"}, {}, {});
+
+  // Each name only gets the selectors that refer to it.
+  base::HistogramTester histogram_tester;
+  base::Value::Dict result = cache_.HiddenClassIdSelectors({"promo"}, {}, {});
+  histogram_tester.ExpectUniqueSample(kHitRateHistogram, 100, 1);
+  EXPECT_THAT(GetSelectors(result, "hide_selectors"),
+              ElementsAre(".promo > div"));
+}
+
+TEST_F(AdBlockClassIdSelectorsCacheTest, AppliesExceptionsToCachedLookups) {
+  LoadRules(&default_engine_, "##.ad\n##.sponsored");
+
+  base::Value::Dict result =
+      cache_.HiddenClassIdSelectors({"ad", "sponsored"}, {}, {".ad"});
+  EXPECT_THAT(GetSelectors(result, "hide_selectors"),
+              ElementsAre(".sponsored"));
+
+  base::HistogramTester histogram_tester;
+  result = cache_.HiddenClassIdSelectors({"ad", "sponsored"}, {}, {});
+  histogram_tester.ExpectUniqueSample(kHitRateHistogram, 100, 1);
+  EXPECT_THAT(GetSelectors(result, "hide_selectors"),
+              ElementsAre(".ad", ".sponsored"));
+}
+
+TEST_F(AdBlockClassIdSelectorsCacheTest, ClearedWhenEitherEngineUpdates) {
+  LoadRules(&default_engine_, "##.ad");
+  cache_.HiddenClassIdSelectors({"ad"}, {}, {});
+
+  base::HistogramTester histogram_tester;
+  LoadRules(&additional_engine_, "##.ad");
+  base::Value::Dict result = cache_.HiddenClassIdSelectors({"ad"}, {}, {});
+  histogram_tester.ExpectUniqueSample(kHitRateHistogram, 0, 1);
+  EXPECT_THAT(GetSelectors(result, "hide_selectors"), ElementsAre(".ad"));
+  EXPECT_THAT(GetSelectors(result, "force_hide_selectors"), ElementsAre(".ad"));
+
+  LoadRules(&default_engine_, "##.banner");
+  result = cache_.HiddenClassIdSelectors({"ad"}, {}, {});
+  histogram_tester.ExpectUniqueSample(kHitRateHistogram, 0, 2);
+  EXPECT_THAT(GetSelectors(result, "hide_selectors"), IsEmpty());
+  EXPECT_THAT(GetSelectors(result, "force_hide_selectors"), ElementsAre(".ad"));
+}
+
+TEST_F(AdBlockClassIdSelectorsCacheTest, SplitSelectors) {
+  AdBlockClassIdSelectorsCache::SelectorsByKey selectors_by_key;
+  selectors_by_key.emplace(".a", AdBlockClassIdSelectorsCache::Selectors());
+  selectors_by_key.emplace("#b", AdBlockClassIdSelectorsCache::Selectors());
+  AdBlockClassIdSelectorsCache::Selectors generic_selectors;
+
+  auto make_list = [] {
+    base::Value::List list;
+    list.Append(".a > p");
+    list.Append("div#b");
+    list.Append(".a#b");
+    list.Append(".ab");
+    return list;
+  };
+  AdBlockClassIdSelectorsCache::SplitSelectors(
+      make_list(), /*force_hide=*/false, selectors_by_key, generic_selectors);
+  AdBlockClassIdSelectorsCache::SplitSelectors(
+      make_list(), /*force_hide=*/true, selectors_by_key, generic_selectors);
+  // Generic selectors are returned for every lookup, so matching them again
+  // doesn't add them twice.
+  AdBlockClassIdSelectorsCache::SplitSelectors(
+      make_list(), /*force_hide=*/true, selectors_by_key, generic_selectors);
+
+  EXPECT_THAT(selectors_by_key[".a"].hide_selectors,
+              ElementsAre(".a > p", ".a#b"));
+  EXPECT_THAT(selectors_by_key["#b"].hide_selectors,
+              ElementsAre("div#b", ".a#b"));
+  EXPECT_THAT(generic_selectors.hide_selectors, ElementsAre(".ab"));
+  EXPECT_THAT(generic_selectors.force_hide_selectors, ElementsAre(".ab"));
+}
+
+}  // namespace brave_shields
@@ -59,8 +59,7 @@ void AdBlockComponentFiltersProvider::OnComponentReady(
 }
 
 void AdBlockComponentFiltersProvider::LoadDATBuffer(
-    base::OnceCallback<void(bool deserialize, const DATFileDataBuffer& dat_buf)>
-        cb) {
+    base::OnceCallback<void(bool deserialize, DATFileDataBuffer dat_buf)> cb) {
   if (component_path_.empty()) {
     // If the path is not ready yet, run the callback with an empty list. An
     // update will be pushed later to notify about the newly available list.
@@ -12,8 +12,12 @@
 
 #include "base/containers/contains.h"
 #include "base/json/json_reader.h"
+#include "base/metrics/histogram_macros.h"
 #include "base/strings/string_number_conversions.h"
+#include "base/timer/elapsed_timer.h"
 #include "brave/components/adblock_rust_ffi/src/wrapper.h"
+#include "brave/components/brave_shields/browser/ad_block_engine_cache.h"
+#include "crypto/sha2.h"
 #include "net/base/registry_controlled_domains/registry_controlled_domain.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
 #include "url/origin.h"
@@ -88,6 +92,11 @@ std::string ResourceTypeToString(blink::mojom::ResourceType resource_type) {
   return filter_option;
 }
 
+std::string HashBuffer(const DATFileDataBuffer& buffer) {
+  return crypto::SHA256HashString(base::StringPiece(
+      reinterpret_cast<const char*>(buffer.data()), buffer.size()));
+}
+
 }  // namespace
 
 namespace brave_shields {
@@ -96,6 +105,11 @@ AdBlockEngine::AdBlockEngine() : ad_block_client_(new adblock::Engine()) {
   DETACH_FROM_SEQUENCE(sequence_checker_);
 }
 
+AdBlockEngine::AdBlockEngine(const base::FilePath& cache_dir)
+    : AdBlockEngine() {
+  cache_ = std::make_unique<AdBlockEngineCache>(cache_dir);
+}
+
 AdBlockEngine::~AdBlockEngine() = default;
 
 void AdBlockEngine::ShouldStartRequest(const GURL& url,
@@ -167,6 +181,11 @@ void AdBlockEngine::UseResources(const std::string& resources) {
   ad_block_client_->useResources(resources);
 }
 
+uint64_t AdBlockEngine::update_count() const {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  return update_count_;
+}
+
 bool AdBlockEngine::TagExists(const std::string& tag) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
   return base::Contains(tags_, tag);
@@ -243,6 +262,32 @@ void AdBlockEngine::Load(bool deserialize,
   }
 }
 
+std::unique_ptr<adblock::Engine> AdBlockEngine::CompileFilterList(
+    const std::string& key,
+    const DATFileDataBuffer& filters) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  base::ElapsedTimer timer;
+  if (cache_) {
+    if (auto engine = cache_->Load(key)) {
+      UMA_HISTOGRAM_TIMES("Brave.Adblock.FilterListDeserializeTime",
+                          timer.Elapsed());
+      return engine;
+    }
+  }
+
+  auto engine = std::make_unique<adblock::Engine>(
+      reinterpret_cast<const char*>(filters.data()), filters.size());
+  UMA_HISTOGRAM_TIMES("Brave.Adblock.FilterListCompileTime", timer.Elapsed());
+
+  // Serialize before any resources or tags are applied, so that the cached
+  // engine only depends on the list contents.
+  if (cache_) {
+    cache_->Store(key, engine.get());
+  }
+  return engine;
+}
+
 void AdBlockEngine::UpdateAdBlockClient(
     std::unique_ptr<adblock::Engine> ad_block_client,
     const std::string& resources_json) {
@@ -253,6 +298,7 @@ void AdBlockEngine::UpdateAdBlockClient(
   }
   UseResources(resources_json);
   AddKnownTagsToAdBlockInstance();
+  ++update_count_;
   if (test_observer_) {
     test_observer_->OnEngineUpdated();
   }
@@ -268,8 +314,11 @@ void AdBlockEngine::AddKnownTagsToAdBlockInstance() {
 
 void AdBlockEngine::OnListSourceLoaded(const DATFileDataBuffer& filters,
                                        const std::string& resources_json) {
-  auto engine = std::make_unique<adblock::Engine>(
-      reinterpret_cast<const char*>(filters.data()), filters.size());
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  auto engine = CompileFilterList(HashBuffer(filters), filters);
+  if (cache_) {
+    cache_->RemoveStaleEntries();
+  }
   UpdateAdBlockClient(std::move(engine), resources_json);
 }
 
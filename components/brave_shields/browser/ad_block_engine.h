@@ -14,6 +14,7 @@
 #include <utility>
 #include <vector>
 
+#include "base/files/file_path.h"
 #include "base/memory/weak_ptr.h"
 #include "base/observer_list_types.h"
 #include "base/sequence_checker.h"
@@ -36,13 +37,16 @@ class PerfPredictorTabHelperTest;
 
 namespace brave_shields {
 
+class AdBlockEngineCache;
+
 // Service managing an adblock engine.
 class AdBlockEngine : public base::SupportsWeakPtr<AdBlockEngine> {
  public:
-  using GetDATFileDataResult =
-      brave_component_updater::LoadDATFileDataResult<adblock::Engine>;
-
   AdBlockEngine();
+  // Compiled filters are persisted under |cache_dir|, so that unchanged
+  // filters can be deserialized rather than recompiled on the next load. Must
+  // then be used on a sequence that allows blocking.
+  explicit AdBlockEngine(const base::FilePath& cache_dir);
   AdBlockEngine(const AdBlockEngine&) = delete;
   AdBlockEngine& operator=(const AdBlockEngine&) = delete;
   ~AdBlockEngine();
@@ -83,6 +87,10 @@ class AdBlockEngine : public base::SupportsWeakPtr<AdBlockEngine> {
     virtual void OnEngineUpdated() = 0;
   };
 
+  // Incremented whenever the set of loaded filters changes, so that results
+  // derived from this engine can be invalidated.
+  uint64_t update_count() const;
+
   void AddObserverForTest(TestObserver* observer);
   void RemoveObserverForTest();
 
@@ -96,8 +104,13 @@ class AdBlockEngine : public base::SupportsWeakPtr<AdBlockEngine> {
   void OnDATLoaded(const DATFileDataBuffer& dat_buf,
                    const std::string& resources_json);
 
+  std::unique_ptr<adblock::Engine> CompileFilterList(
+      const std::string& key,
+      const DATFileDataBuffer& filters);
+
   std::unique_ptr<adblock::Engine> ad_block_client_
       GUARDED_BY_CONTEXT(sequence_checker_);
+  uint64_t update_count_ GUARDED_BY_CONTEXT(sequence_checker_) = 0;
 
  private:
   friend class ::AdBlockServiceTest;
@@ -105,6 +118,8 @@ class AdBlockEngine : public base::SupportsWeakPtr<AdBlockEngine> {
   friend class ::EphemeralStorage1pDomainBlockBrowserTest;
   friend class ::PerfPredictorTabHelperTest;
 
+  std::unique_ptr<AdBlockEngineCache> cache_
+      GUARDED_BY_CONTEXT(sequence_checker_);
   std::set<std::string> tags_ GUARDED_BY_CONTEXT(sequence_checker_);
   absl::optional<adblock::RegexManagerDiscardPolicy> regex_discard_policy_
       GUARDED_BY_CONTEXT(sequence_checker_);
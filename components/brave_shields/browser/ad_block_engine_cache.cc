@@ -0,0 +1,109 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/ad_block_engine_cache.h"
+
+#include <string>
+#include <vector>
+
+#include "base/files/file_enumerator.h"
+#include "base/files/file_util.h"
+#include "base/files/important_file_writer.h"
+#include "base/strings/strcat.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_piece.h"
+#include "base/strings/string_util.h"
+#include "base/time/time.h"
+#include "brave/components/adblock_rust_ffi/buildflags.h"
+#include "brave/components/adblock_rust_ffi/src/wrapper.h"
+#include "brave/components/brave_component_updater/browser/dat_file_util.h"
+#include "crypto/sha2.h"
+
+namespace brave_shields {
+
+namespace {
+
+// Serialized engines are only readable by the adblock-rust version that wrote
+// them. The version comes from Cargo.lock, so updating the crate invalidates
+// the cache.
+constexpr char kSerializedEnginePrefix[] = "adblock-rust-";
+
+constexpr char kCacheEntryExtension[] = ".dat";
+
+// Entries which haven't been loaded or stored for this long are deleted.
+constexpr base::TimeDelta kStaleEntryAge = base::Days(30);
+
+}  // namespace
+
+AdBlockEngineCache::AdBlockEngineCache(const base::FilePath& cache_dir)
+    : cache_dir_(cache_dir) {}
+
+AdBlockEngineCache::~AdBlockEngineCache() = default;
+
+std::unique_ptr<adblock::Engine> AdBlockEngineCache::Load(
+    const std::string& list_hash) {
+  const base::FilePath path = GetEntryPath(list_hash);
+  if (!base::PathExists(path)) {
+    return nullptr;
+  }
+
+  // The entry is only needed until it has been deserialized, so map it rather
+  // than copying it onto the heap.
+  auto engine = brave_component_updater::LoadDATFileData<adblock::Engine>(path);
+  if (!engine) {
+    base::DeleteFile(path);
+    return nullptr;
+  }
+
+  // Keeps the entry from being considered stale.
+  const base::Time now = base::Time::Now();
+  base::TouchFile(path, now, now);
+  return engine;
+}
+
+void AdBlockEngineCache::Store(const std::string& list_hash,
+                               adblock::Engine* engine) {
+  DCHECK(engine);
+  const std::vector<unsigned char> serialized = engine->serialize();
+  if (serialized.empty()) {
+    return;
+  }
+
+  if (!base::CreateDirectory(cache_dir_)) {
+    return;
+  }
+
+  // Several engines may be compiling the same list at once, so never leave a
+  // partially written entry behind.
+  base::ImportantFileWriter::WriteFileAtomically(
+      GetEntryPath(list_hash),
+      base::StringPiece(reinterpret_cast<const char*>(serialized.data()),
+                        serialized.size()));
+}
+
+void AdBlockEngineCache::RemoveStaleEntries() {
+  const base::Time cutoff = base::Time::Now() - kStaleEntryAge;
+  base::FileEnumerator enumerator(
+      cache_dir_, /*recursive=*/false, base::FileEnumerator::FILES,
+      base::StrCat({"*", kCacheEntryExtension}));
+  for (base::FilePath path = enumerator.Next(); !path.empty();
+       path = enumerator.Next()) {
+    if (enumerator.GetInfo().GetLastModifiedTime() < cutoff) {
+      base::DeleteFile(path);
+    }
+  }
+}
+
+base::FilePath AdBlockEngineCache::GetEntryPath(
+    const std::string& list_hash) const {
+  const std::string key = crypto::SHA256HashString(
+      base::StrCat({kSerializedEnginePrefix, BUILDFLAG(ADBLOCK_RUST_VERSION),
+                    ":", list_hash}));
+  return cache_dir_.AppendASCII(base::StrCat(
+      {base::ToLowerASCII(base::HexEncode(key.data(), key.size())),
+       kCacheEntryExtension}));
+}
+
+}  // namespace brave_shields
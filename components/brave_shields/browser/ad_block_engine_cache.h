@@ -0,0 +1,50 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_ENGINE_CACHE_H_
+#define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_ENGINE_CACHE_H_
+
+#include <memory>
+#include <string>
+
+#include "base/files/file_path.h"
+
+namespace adblock {
+class Engine;
+}  // namespace adblock
+
+namespace brave_shields {
+
+// Keeps serialized adblock engines on disk, keyed by a hash of the filter list
+// they were compiled from, so that unchanged lists can be deserialized instead
+// of parsed again on the next startup. Entries are also keyed by the engine
+// serialization version, so an adblock-rust upgrade invalidates them.
+//
+// All methods do blocking file IO and must be called on a sequence that
+// allows it.
+class AdBlockEngineCache {
+ public:
+  explicit AdBlockEngineCache(const base::FilePath& cache_dir);
+  AdBlockEngineCache(const AdBlockEngineCache&) = delete;
+  AdBlockEngineCache& operator=(const AdBlockEngineCache&) = delete;
+  ~AdBlockEngineCache();
+
+  // Returns nullptr if there is no usable cached engine for |list_hash|.
+  std::unique_ptr<adblock::Engine> Load(const std::string& list_hash);
+  void Store(const std::string& list_hash, adblock::Engine* engine);
+
+  // Deletes entries that haven't been used for a while, e.g. old versions of
+  // regularly updated lists.
+  void RemoveStaleEntries();
+
+ private:
+  base::FilePath GetEntryPath(const std::string& list_hash) const;
+
+  const base::FilePath cache_dir_;
+};
+
+}  // namespace brave_shields
+
+#endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_ENGINE_CACHE_H_
@@ -0,0 +1,103 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/ad_block_engine_cache.h"
+
+#include <memory>
+#include <string>
+
+#include "base/files/file_enumerator.h"
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/test/metrics/histogram_tester.h"
+#include "brave/components/adblock_rust_ffi/src/wrapper.h"
+#include "brave/components/brave_shields/browser/ad_block_engine.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace brave_shields {
+
+namespace {
+
+constexpr char kListHash[] = "list-hash";
+
+bool IsBlocked(AdBlockEngine* engine, const std::string& url) {
+  bool did_match_rule = false;
+  bool did_match_exception = false;
+  bool did_match_important = false;
+  std::string mock_data_url;
+  std::string rewritten_url;
+  engine->ShouldStartRequest(GURL(url), blink::mojom::ResourceType::kScript,
+                             "example.com", false, &did_match_rule,
+                             &did_match_exception, &did_match_important,
+                             &mock_data_url, &rewritten_url);
+  return did_match_important || (did_match_rule && !did_match_exception);
+}
+
+}  // namespace
+
+class AdBlockEngineCacheTest : public testing::Test {
+ public:
+  AdBlockEngineCacheTest() = default;
+  ~AdBlockEngineCacheTest() override = default;
+
+  void SetUp() override { ASSERT_TRUE(temp_dir_.CreateUniqueTempDir()); }
+
+  base::FilePath cache_dir() const {
+    return temp_dir_.GetPath().AppendASCII("adblock_engine_cache");
+  }
+
+ private:
+  base::ScopedTempDir temp_dir_;
+};
+
+TEST_F(AdBlockEngineCacheTest, LoadMissingEntry) {
+  AdBlockEngineCache cache(cache_dir());
+  EXPECT_FALSE(cache.Load(kListHash));
+}
+
+TEST_F(AdBlockEngineCacheTest, LoadCorruptEntry) {
+  const std::string rules = "||tracker.com^";
+  adblock::Engine engine(rules.c_str(), rules.size());
+
+  AdBlockEngineCache cache(cache_dir());
+  cache.Store(kListHash, &engine);
+
+  base::FileEnumerator enumerator(cache_dir(), false,
+                                  base::FileEnumerator::FILES);
+  const base::FilePath entry = enumerator.Next();
+  ASSERT_FALSE(entry.empty());
+  ASSERT_TRUE(base::WriteFile(entry, "not an engine"));
+
+  EXPECT_FALSE(cache.Load(kListHash));
+  // Unreadable entries are dropped rather than retried on every load.
+  EXPECT_FALSE(base::PathExists(entry));
+}
+
+TEST_F(AdBlockEngineCacheTest, WarmLoadDeserializes) {
+  const DATFileDataBuffer list = {'|', '|', 't', 'r', 'a', 'c', 'k',
+                                  'e', 'r', '.', 'c', 'o', 'm', '^'};
+
+  {
+    base::HistogramTester histogram_tester;
+    AdBlockEngine engine(cache_dir());
+    engine.Load(false, list, "[]");
+    histogram_tester.ExpectTotalCount("Brave.Adblock.FilterListCompileTime", 1);
+    histogram_tester.ExpectTotalCount("Brave.Adblock.FilterListDeserializeTime",
+                                      0);
+    EXPECT_TRUE(IsBlocked(&engine, "https://tracker.com/ad.js"));
+  }
+
+  base::HistogramTester histogram_tester;
+  AdBlockEngine engine(cache_dir());
+  engine.Load(false, list, "[]");
+  histogram_tester.ExpectTotalCount("Brave.Adblock.FilterListCompileTime", 0);
+  histogram_tester.ExpectTotalCount("Brave.Adblock.FilterListDeserializeTime",
+                                    1);
+  EXPECT_TRUE(IsBlocked(&engine, "https://tracker.com/ad.js"));
+  EXPECT_FALSE(IsBlocked(&engine, "https://example.com/ad.js"));
+}
+
+}  // namespace brave_shields
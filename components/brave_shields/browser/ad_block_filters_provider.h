@@ -34,14 +34,14 @@ class AdBlockFiltersProvider {
   void RemoveObserver(Observer* observer);
 
   void LoadDAT(base::OnceCallback<void(bool deserialize,
-                                       const DATFileDataBuffer& dat_buf)>);
+                                       DATFileDataBuffer dat_buf)>);
 
   base::WeakPtr<AdBlockFiltersProvider> AsWeakPtr();
 
  protected:
   virtual void LoadDATBuffer(
       base::OnceCallback<void(bool deserialize,
-                              const DATFileDataBuffer& dat_buf)>) = 0;
+                              DATFileDataBuffer dat_buf)>) = 0;
 
   void NotifyObservers();
 
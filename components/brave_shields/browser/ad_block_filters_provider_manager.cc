@@ -22,13 +22,13 @@ namespace {
 static void OnDATLoaded(
     base::OnceCallback<void(DATFileDataBuffer)> collect_and_merge,
     bool deserialize,
-    const DATFileDataBuffer& dat_buf) {
+    DATFileDataBuffer dat_buf) {
   // This manager should never be used for a provider that returns a serialized
   // DAT. The ability should be removed from the FiltersProvider API when
   // possible.
   CHECK(!deserialize);
 
-  std::move(collect_and_merge).Run(dat_buf);
+  std::move(collect_and_merge).Run(std::move(dat_buf));
 }
 
 }  // namespace
@@ -64,8 +64,7 @@ void AdBlockFiltersProviderManager::OnChanged() {
 }
 
 void AdBlockFiltersProviderManager::LoadDATBuffer(
-    base::OnceCallback<void(bool deserialize, const DATFileDataBuffer& dat_buf)>
-        cb) {
+    base::OnceCallback<void(bool deserialize, DATFileDataBuffer dat_buf)> cb) {
   if (task_tracker_.HasTrackedTasks()) {
     // There's already an in-progress load, cancel it.
     task_tracker_.TryCancelAll();
@@ -85,8 +84,8 @@ void AdBlockFiltersProviderManager::LoadDATBuffer(
 }
 
 void AdBlockFiltersProviderManager::FinishCombinating(
-    base::OnceCallback<void(bool, const DATFileDataBuffer&)> cb,
-    const std::vector<DATFileDataBuffer>& results) {
+    base::OnceCallback<void(bool, DATFileDataBuffer)> cb,
+    std::vector<DATFileDataBuffer> results) {
   DATFileDataBuffer combined_list;
   for (const auto& dat_buf : results) {
     combined_list.push_back('\n');
@@ -98,7 +97,7 @@ void AdBlockFiltersProviderManager::FinishCombinating(
     // state using an entirely empty DAT.
     combined_list.push_back('\n');
   }
-  std::move(cb).Run(false, combined_list);
+  std::move(cb).Run(false, std::move(combined_list));
 }
 
 }  // namespace brave_shields
@@ -38,7 +38,7 @@ class AdBlockFiltersProviderManager : public AdBlockFiltersProvider,
 
   void LoadDATBuffer(
       base::OnceCallback<void(bool deserialize,
-                              const DATFileDataBuffer& dat_buf)>) override;
+                              DATFileDataBuffer dat_buf)>) override;
 
   // AdBlockFiltersProvider::Observer
   void OnChanged() override;
@@ -50,8 +50,8 @@ class AdBlockFiltersProviderManager : public AdBlockFiltersProvider,
   friend base::NoDestructor<AdBlockFiltersProviderManager>;
 
   void FinishCombinating(
-      base::OnceCallback<void(bool, const DATFileDataBuffer&)> cb,
-      const std::vector<DATFileDataBuffer>& results);
+      base::OnceCallback<void(bool, DATFileDataBuffer)> cb,
+      std::vector<DATFileDataBuffer> results);
   base::flat_set<AdBlockFiltersProvider*> filters_providers_;
 
   base::CancelableTaskTracker task_tracker_;
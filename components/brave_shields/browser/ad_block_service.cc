@@ -8,11 +8,15 @@
 #include <algorithm>
 #include <utility>
 
+#include "base/barrier_callback.h"
 #include "base/feature_list.h"
 #include "base/files/file_path.h"
 #include "base/functional/bind.h"
 #include "base/logging.h"
+#include "base/metrics/histogram_macros.h"
+#include "base/task/thread_pool.h"
 #include "base/threading/thread_restrictions.h"
+#include "brave/components/brave_shields/browser/ad_block_class_id_selectors_cache.h"
 #include "brave/components/brave_shields/browser/ad_block_component_filters_provider.h"
 #include "brave/components/brave_shields/browser/ad_block_custom_filters_provider.h"
 #include "brave/components/brave_shields/browser/ad_block_default_resource_provider.h"
@@ -32,6 +36,11 @@
 
 namespace {
 
+// Compiled additional filter lists are cached here, relative to the profile
+// directory.
+constexpr base::FilePath::CharType kAdBlockEngineCacheDirName[] =
+    FILE_PATH_LITERAL("adblock_engine_cache");
+
 const char kAdBlockDefaultComponentName[] = "Brave Ad Block Updater";
 const char kAdBlockDefaultComponentId[] = "iodkpdagapdfkphljnddpjlldadblomo";
 const char kAdBlockDefaultComponentBase64PublicKey[] =
@@ -63,6 +72,46 @@ std::string g_ad_block_default_component_base64_public_key_(
 
 namespace brave_shields {
 
+namespace {
+
+// Checks a request against a single engine, starting from |previous_result|.
+// Runs on the engine's sequence and records how long the check waited behind
+// other adblock work, and how long the match itself took.
+AdBlockService::ShouldStartRequestResult MatchOnEngine(
+    base::WeakPtr<AdBlockEngine> engine,
+    const GURL& url,
+    blink::mojom::ResourceType resource_type,
+    const std::string& tab_host,
+    bool aggressive_blocking,
+    AdBlockService::ShouldStartRequestResult previous_result,
+    base::TimeTicks posted_at) {
+  const base::TimeTicks start_time = base::TimeTicks::Now();
+  UMA_HISTOGRAM_CUSTOM_MICROSECONDS_TIMES(
+      "Brave.Adblock.ParallelMatching.QueueDelay", start_time - posted_at,
+      base::Microseconds(1), base::Seconds(1), 50);
+
+  if (!engine) {
+    return previous_result;
+  }
+
+  const GURL request_url = previous_result.rewritten_url.empty()
+                               ? url
+                               : GURL(previous_result.rewritten_url);
+  engine->ShouldStartRequest(
+      request_url, resource_type, tab_host, aggressive_blocking,
+      &previous_result.did_match_rule, &previous_result.did_match_exception,
+      &previous_result.did_match_important, &previous_result.mock_data_url,
+      &previous_result.rewritten_url);
+
+  UMA_HISTOGRAM_CUSTOM_MICROSECONDS_TIMES(
+      "Brave.Adblock.ParallelMatching.MatchTime",
+      base::TimeTicks::Now() - start_time, base::Microseconds(1),
+      base::Seconds(1), 50);
+  return previous_result;
+}
+
+}  // namespace
+
 AdBlockService::SourceProviderObserver::SourceProviderObserver(
     AdBlockEngine* adblock_engine,
     AdBlockFiltersProvider* filters_provider,
@@ -91,7 +140,7 @@ void AdBlockService::SourceProviderObserver::OnChanged() {
 
 void AdBlockService::SourceProviderObserver::OnDATLoaded(
     bool deserialize,
-    const DATFileDataBuffer& dat_buf) {
+    DATFileDataBuffer dat_buf) {
   deserialize_ = deserialize;
   dat_buf_ = std::move(dat_buf);
   // multiple AddObserver calls are ignored
@@ -135,12 +184,7 @@ void AdBlockService::ShouldStartRequest(
 
   GURL request_url;
 
-  if (aggressive_blocking ||
-      base::FeatureList::IsEnabled(
-          brave_shields::features::kBraveAdblockDefault1pBlocking) ||
-      !SameDomainOrHost(
-          url, url::Origin::CreateFromNormalizedTuple("https", tab_host, 80),
-          net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES)) {
+  if (ShouldCheckDefaultEngine(url, tab_host, aggressive_blocking)) {
     request_url =
         rewritten_url && !rewritten_url->empty() ? GURL(*rewritten_url) : url;
     default_engine_->ShouldStartRequest(
@@ -159,6 +203,132 @@ void AdBlockService::ShouldStartRequest(
       did_match_exception, did_match_important, mock_data_url, rewritten_url);
 }
 
+void AdBlockService::ShouldStartRequestAsync(
+    const GURL& url,
+    blink::mojom::ResourceType resource_type,
+    const std::string& tab_host,
+    bool aggressive_blocking,
+    ShouldStartRequestResult previous_result,
+    ShouldStartRequestCallback callback) {
+  if (!additional_filters_matching_engine_) {
+    // base::Unretained() is safe because AdBlockService outlives the browser
+    // process' network stack, same as for the other adblock sequence tasks.
+    GetTaskRunner()->PostTaskAndReplyWithResult(
+        FROM_HERE,
+        base::BindOnce(
+            [](AdBlockService* service, const GURL& url,
+               blink::mojom::ResourceType resource_type,
+               const std::string& tab_host, bool aggressive_blocking,
+               ShouldStartRequestResult result) {
+              service->ShouldStartRequest(
+                  url, resource_type, tab_host, aggressive_blocking,
+                  &result.did_match_rule, &result.did_match_exception,
+                  &result.did_match_important, &result.mock_data_url,
+                  &result.rewritten_url);
+              return result;
+            },
+            base::Unretained(this), url, resource_type, tab_host,
+            aggressive_blocking, std::move(previous_result)),
+        std::move(callback));
+    return;
+  }
+
+  const base::TimeTicks posted_at = base::TimeTicks::Now();
+
+  if (!ShouldCheckDefaultEngine(url, tab_host, aggressive_blocking)) {
+    matching_task_runner_->PostTaskAndReplyWithResult(
+        FROM_HERE,
+        base::BindOnce(&MatchOnEngine,
+                       additional_filters_matching_engine_->AsWeakPtr(), url,
+                       resource_type, tab_host, aggressive_blocking,
+                       std::move(previous_result), posted_at),
+        std::move(callback));
+    return;
+  }
+
+  auto barrier = base::BarrierCallback<EngineMatch>(
+      2, base::BindOnce(&AdBlockService::OnParallelMatchesDone,
+                        matching_task_runner_,
+                        additional_filters_matching_engine_->AsWeakPtr(), url,
+                        resource_type, tab_host, aggressive_blocking,
+                        std::move(callback)));
+  auto to_engine_match = [](bool from_default_engine,
+                            ShouldStartRequestResult result) {
+    return EngineMatch{from_default_engine, std::move(result)};
+  };
+
+  GetTaskRunner()->PostTaskAndReplyWithResult(
+      FROM_HERE,
+      base::BindOnce(&MatchOnEngine, default_engine_->AsWeakPtr(), url,
+                     resource_type, tab_host, aggressive_blocking,
+                     previous_result, posted_at)
+          .Then(base::BindOnce(to_engine_match, true)),
+      barrier);
+  matching_task_runner_->PostTaskAndReplyWithResult(
+      FROM_HERE,
+      base::BindOnce(&MatchOnEngine,
+                     additional_filters_matching_engine_->AsWeakPtr(), url,
+                     resource_type, tab_host, aggressive_blocking,
+                     std::move(previous_result), posted_at)
+          .Then(base::BindOnce(to_engine_match, false)),
+      barrier);
+}
+
+// static
+void AdBlockService::OnParallelMatchesDone(
+    scoped_refptr<base::SequencedTaskRunner> matching_task_runner,
+    base::WeakPtr<AdBlockEngine> additional_filters_engine,
+    const GURL& url,
+    blink::mojom::ResourceType resource_type,
+    const std::string& tab_host,
+    bool aggressive_blocking,
+    ShouldStartRequestCallback callback,
+    std::vector<EngineMatch> matches) {
+  DCHECK_EQ(matches.size(), 2u);
+  if (!matches[0].from_default_engine) {
+    std::swap(matches[0], matches[1]);
+  }
+  ShouldStartRequestResult& default_result = matches[0].result;
+  ShouldStartRequestResult& additional_result = matches[1].result;
+
+  if (default_result.did_match_important) {
+    std::move(callback).Run(std::move(default_result));
+    return;
+  }
+
+  // The additional engine's answer only stands on its own if the default
+  // engine neither matched nor rewrote the request. Otherwise exceptions from
+  // the additional lists have to be checked against the default engine's match
+  // (or its rewritten URL), so redo that check in sequence as
+  // ShouldStartRequest does. This is the rare, blocked, path.
+  if (default_result.did_match_rule || default_result.did_match_exception ||
+      !default_result.rewritten_url.empty()) {
+    matching_task_runner->PostTaskAndReplyWithResult(
+        FROM_HERE,
+        base::BindOnce(&MatchOnEngine, std::move(additional_filters_engine),
+                       url, resource_type, tab_host, aggressive_blocking,
+                       std::move(default_result), base::TimeTicks::Now()),
+        std::move(callback));
+    return;
+  }
+
+  if (additional_result.mock_data_url.empty()) {
+    additional_result.mock_data_url = std::move(default_result.mock_data_url);
+  }
+  std::move(callback).Run(std::move(additional_result));
+}
+
+bool AdBlockService::ShouldCheckDefaultEngine(const GURL& url,
+                                              const std::string& tab_host,
+                                              bool aggressive_blocking) const {
+  return aggressive_blocking ||
+         base::FeatureList::IsEnabled(
+             brave_shields::features::kBraveAdblockDefault1pBlocking) ||
+         !SameDomainOrHost(
+             url, url::Origin::CreateFromNormalizedTuple("https", tab_host, 80),
+             net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
+}
+
 absl::optional<std::string> AdBlockService::GetCspDirectives(
     const GURL& url,
     blink::mojom::ResourceType resource_type,
@@ -221,19 +391,8 @@ base::Value::Dict AdBlockService::HiddenClassIdSelectors(
     const std::vector<std::string>& ids,
     const std::vector<std::string>& exceptions) {
   DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
-  base::Value::List hide_selectors =
-      default_engine_->HiddenClassIdSelectors(classes, ids, exceptions);
-
-  base::Value::List additional_selectors =
-      additional_filters_engine_->HiddenClassIdSelectors(classes, ids,
-                                                         exceptions);
-
-  base::Value::List force_hide_selectors = std::move(additional_selectors);
-
-  base::Value::Dict result;
-  result.Set("hide_selectors", std::move(hide_selectors));
-  result.Set("force_hide_selectors", std::move(force_hide_selectors));
-  return result;
+  return class_id_selectors_cache_->HiddenClassIdSelectors(classes, ids,
+                                                           exceptions);
 }
 
 AdBlockRegionalServiceManager* AdBlockService::regional_service_manager() {
@@ -272,7 +431,16 @@ AdBlockService::AdBlockService(
           base::OnTaskRunnerDeleter(GetTaskRunner()))),
       additional_filters_engine_(
           std::unique_ptr<AdBlockEngine, base::OnTaskRunnerDeleter>(
-              new AdBlockEngine(),
+              new AdBlockEngine(GetEngineCacheDir()),
+              base::OnTaskRunnerDeleter(GetTaskRunner()))),
+      additional_filters_matching_engine_(
+          nullptr,
+          base::OnTaskRunnerDeleter(GetTaskRunner())),
+      class_id_selectors_cache_(
+          std::unique_ptr<AdBlockClassIdSelectorsCache,
+                          base::OnTaskRunnerDeleter>(
+              new AdBlockClassIdSelectorsCache(
+                  default_engine_.get(), additional_filters_engine_.get()),
               base::OnTaskRunnerDeleter(GetTaskRunner()))) {
   // Initializes adblock-rust's domain resolution implementation
   adblock::SetDomainResolver(AdBlockServiceDomainResolver);
@@ -322,6 +490,21 @@ AdBlockService::AdBlockService(
           additional_filters_engine_.get(),
           AdBlockFiltersProviderManager::GetInstance(),
           resource_provider_.get(), GetTaskRunner());
+
+  if (base::FeatureList::IsEnabled(features::kAdblockParallelMatching)) {
+    matching_task_runner_ = base::ThreadPool::CreateSequencedTaskRunner(
+        {base::MayBlock(), base::TaskPriority::USER_BLOCKING,
+         base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN});
+    additional_filters_matching_engine_ =
+        std::unique_ptr<AdBlockEngine, base::OnTaskRunnerDeleter>(
+            new AdBlockEngine(GetEngineCacheDir()),
+            base::OnTaskRunnerDeleter(matching_task_runner_));
+    additional_filters_matching_service_observer_ =
+        std::make_unique<SourceProviderObserver>(
+            additional_filters_matching_engine_.get(),
+            AdBlockFiltersProviderManager::GetInstance(),
+            resource_provider_.get(), matching_task_runner_);
+  }
 }
 
 AdBlockService::~AdBlockService() {
@@ -372,6 +555,17 @@ void AdBlockService::SetupDiscardPolicy(
       FROM_HERE,
       base::BindOnce(&AdBlockEngine::SetupDiscardPolicy,
                      additional_filters_engine_->AsWeakPtr(), policy));
+  if (additional_filters_matching_engine_) {
+    matching_task_runner_->PostTask(
+        FROM_HERE,
+        base::BindOnce(&AdBlockEngine::SetupDiscardPolicy,
+                       additional_filters_matching_engine_->AsWeakPtr(),
+                       policy));
+  }
+}
+
+base::FilePath AdBlockService::GetEngineCacheDir() const {
+  return profile_dir_.Append(kAdBlockEngineCacheDirName);
 }
 
 base::SequencedTaskRunner* AdBlockService::GetTaskRunner() {
@@ -40,6 +40,7 @@ struct RegexManagerDiscardPolicy;
 }
 namespace brave_shields {
 
+class AdBlockClassIdSelectorsCache;
 class AdBlockEngine;
 class AdBlockComponentFiltersProvider;
 class AdBlockDefaultResourceProvider;
@@ -64,7 +65,7 @@ class AdBlockService {
     ~SourceProviderObserver() override;
 
    private:
-    void OnDATLoaded(bool deserialize, const DATFileDataBuffer& dat_buf);
+    void OnDATLoaded(bool deserialize, DATFileDataBuffer dat_buf);
 
     // AdBlockFiltersProvider::Observer
     void OnChanged() override;
@@ -93,6 +94,17 @@ class AdBlockService {
   AdBlockService& operator=(const AdBlockService&) = delete;
   ~AdBlockService();
 
+  // Flags and outputs of a network request check. See ShouldStartRequest.
+  struct ShouldStartRequestResult {
+    bool did_match_rule = false;
+    bool did_match_exception = false;
+    bool did_match_important = false;
+    std::string mock_data_url;
+    std::string rewritten_url;
+  };
+  using ShouldStartRequestCallback =
+      base::OnceCallback<void(ShouldStartRequestResult)>;
+
   void ShouldStartRequest(const GURL& url,
                           blink::mojom::ResourceType resource_type,
                           const std::string& tab_host,
@@ -102,6 +114,17 @@ class AdBlockService {
                           bool* did_match_important,
                           std::string* mock_data_url,
                           std::string* rewritten_url);
+  // Asynchronous version of ShouldStartRequest, starting from
+  // |previous_result|. With features::kAdblockParallelMatching the default and
+  // additional engines are queried concurrently on separate sequences;
+  // otherwise the check runs on GetTaskRunner(). |callback| is run on the
+  // calling sequence.
+  void ShouldStartRequestAsync(const GURL& url,
+                               blink::mojom::ResourceType resource_type,
+                               const std::string& tab_host,
+                               bool aggressive_blocking,
+                               ShouldStartRequestResult previous_result,
+                               ShouldStartRequestCallback callback);
   absl::optional<std::string> GetCspDirectives(
       const GURL& url,
       blink::mojom::ResourceType resource_type,
@@ -142,6 +165,7 @@ class AdBlockService {
   static std::string g_ad_block_dat_file_version_;
 
   AdBlockResourceProvider* resource_provider();
+  base::FilePath GetEngineCacheDir() const;
   AdBlockComponentFiltersProvider* default_filters_provider() {
     DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
     return default_filters_provider_.get();
@@ -154,6 +178,27 @@ class AdBlockService {
   void TagExistsForTest(const std::string& tag,
                         base::OnceCallback<void(bool)> cb);
 
+  // Result of checking a request against a single engine.
+  struct EngineMatch {
+    bool from_default_engine = false;
+    ShouldStartRequestResult result;
+  };
+
+  bool ShouldCheckDefaultEngine(const GURL& url,
+                                const std::string& tab_host,
+                                bool aggressive_blocking) const;
+  // Combines the results of both engines. Doesn't use the service, so that
+  // |callback| runs even if the service is gone by then.
+  static void OnParallelMatchesDone(
+      scoped_refptr<base::SequencedTaskRunner> matching_task_runner,
+      base::WeakPtr<AdBlockEngine> additional_filters_engine,
+      const GURL& url,
+      blink::mojom::ResourceType resource_type,
+      const std::string& tab_host,
+      bool aggressive_blocking,
+      ShouldStartRequestCallback callback,
+      std::vector<EngineMatch> matches);
+
   raw_ptr<PrefService> local_state_;
   std::string locale_;
   base::FilePath profile_dir_;
@@ -164,6 +209,9 @@ class AdBlockService {
   raw_ptr<component_updater::ComponentUpdateService> component_update_service_;
 
   scoped_refptr<base::SequencedTaskRunner> task_runner_;
+  // Only used with features::kAdblockParallelMatching, see
+  // |additional_filters_matching_engine_|.
+  scoped_refptr<base::SequencedTaskRunner> matching_task_runner_;
 
   std::unique_ptr<AdBlockDefaultResourceProvider> resource_provider_
       GUARDED_BY_CONTEXT(sequence_checker_);
@@ -183,11 +231,32 @@ class AdBlockService {
   std::unique_ptr<AdBlockEngine, base::OnTaskRunnerDeleter> default_engine_;
   std::unique_ptr<AdBlockEngine, base::OnTaskRunnerDeleter>
       additional_filters_engine_;
+  // Replica of |additional_filters_engine_| living on |matching_task_runner_|
+  // so network requests can be checked against it while
+  // |default_engine_| is busy. Only used for ShouldStartRequestAsync; null
+  // unless features::kAdblockParallelMatching is enabled.
+  //
+  // AdBlockEngine is not thread safe and is reloaded in place on its own
+  // sequence, so it can't be shared between the two sequences. The replica
+  // costs a second copy of the additional lists only, which are the custom
+  // filters plus the opted-in regional and subscription lists and are usually
+  // a small fraction of |default_engine_|. Being behind a disabled-by-default
+  // feature, it is only paid by clients in the experiment.
+  std::unique_ptr<AdBlockEngine, base::OnTaskRunnerDeleter>
+      additional_filters_matching_engine_;
+
+  // Used on GetTaskRunner(), and declared after the engines so that it is
+  // deleted before them.
+  std::unique_ptr<AdBlockClassIdSelectorsCache, base::OnTaskRunnerDeleter>
+      class_id_selectors_cache_;
 
   std::unique_ptr<SourceProviderObserver> default_service_observer_
       GUARDED_BY_CONTEXT(sequence_checker_);
   std::unique_ptr<SourceProviderObserver> additional_filters_service_observer_
       GUARDED_BY_CONTEXT(sequence_checker_);
+  std::unique_ptr<SourceProviderObserver>
+      additional_filters_matching_service_observer_
+          GUARDED_BY_CONTEXT(sequence_checker_);
 
   SEQUENCE_CHECKER(sequence_checker_);
 
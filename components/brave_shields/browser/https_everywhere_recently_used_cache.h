@@ -6,40 +6,87 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_HTTPS_EVERYWHERE_RECENTLY_USED_CACHE_H_
 #define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_HTTPS_EVERYWHERE_RECENTLY_USED_CACHE_H_
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "base/containers/lru_cache.h"
 #include "base/synchronization/lock.h"
+#include "base/thread_annotations.h"
 
-template <class T> class HTTPSERecentlyUsedCache {
+// Thread-safe LRU cache, split into independently locked shards so that
+// lookups of different keys from different threads rarely contend. Each shard
+// evicts on its own, so recency is only exact within a shard. Small caches
+// use a single shard and behave as a plain LRU.
+template <class T, class Key = std::string>
+class HTTPSERecentlyUsedCache {
  public:
-  explicit HTTPSERecentlyUsedCache(size_t size = 100) : data_(size) {}
+  // Shards are never smaller than this, so that splitting doesn't make
+  // eviction noticeably less accurate.
+  static constexpr size_t kMinShardSize = 16;
 
-  void add(const std::string& key, const T& value) {
-    base::AutoLock create(lock_);
-    data_.Put(key, value);
+  explicit HTTPSERecentlyUsedCache(size_t size = 100, size_t max_shards = 8) {
+    const size_t shard_count =
+        std::max<size_t>(1, std::min(max_shards, size / kMinShardSize));
+    const size_t shard_size = (size + shard_count - 1) / shard_count;
+    shards_.reserve(shard_count);
+    for (size_t i = 0; i < shard_count; ++i)
+      shards_.push_back(std::make_unique<Shard>(shard_size));
   }
+  HTTPSERecentlyUsedCache(const HTTPSERecentlyUsedCache&) = delete;
+  HTTPSERecentlyUsedCache& operator=(const HTTPSERecentlyUsedCache&) = delete;
 
-  bool get(const std::string& key, T* value) {
-    base::AutoLock create(lock_);
-    auto it = data_.Get(key);
-    if (it != data_.end()) {
-      *value = it->second;
-      return true;
+  void add(const Key& key, const T& value) {
+    Shard& shard = GetShard(key);
+    base::AutoLock lock(shard.lock);
+    shard.data.Put(key, value);
+  }
+
+  bool get(const Key& key, T* value) {
+    Shard& shard = GetShard(key);
+    {
+      base::AutoLock lock(shard.lock);
+      auto it = shard.data.Get(key);
+      if (it != shard.data.end()) {
+        *value = it->second;
+        hits_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+      }
     }
+    misses_.fetch_add(1, std::memory_order_relaxed);
     return false;
   }
 
-  void remove(const std::string& key) {
-    base::AutoLock lock(lock_);
-    auto it = data_.Peek(key);
-    if (it != data_.end())
-      data_.Erase(it);
+  void remove(const Key& key) {
+    Shard& shard = GetShard(key);
+    base::AutoLock lock(shard.lock);
+    auto it = shard.data.Peek(key);
+    if (it != shard.data.end())
+      shard.data.Erase(it);
   }
 
+  size_t shard_count() const { return shards_.size(); }
+  size_t hits() const { return hits_.load(std::memory_order_relaxed); }
+  size_t misses() const { return misses_.load(std::memory_order_relaxed); }
+
  private:
-  base::LRUCache<std::string, T> data_;
-  base::Lock lock_;
+  struct Shard {
+    explicit Shard(size_t size) : data(size) {}
+
+    base::Lock lock;
+    base::LRUCache<Key, T> data GUARDED_BY(lock);
+  };
+
+  Shard& GetShard(const Key& key) {
+    return *shards_[std::hash<Key>()(key) % shards_.size()];
+  }
+
+  std::vector<std::unique_ptr<Shard>> shards_;
+  std::atomic<size_t> hits_{0};
+  std::atomic<size_t> misses_{0};
 };
 
 #endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_HTTPS_EVERYWHERE_RECENTLY_USED_CACHE_H_
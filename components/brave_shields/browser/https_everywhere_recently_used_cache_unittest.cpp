@@ -5,6 +5,12 @@
 
 #include <string>
 
+#include "base/barrier_closure.h"
+#include "base/functional/bind.h"
+#include "base/run_loop.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/task/thread_pool.h"
+#include "base/test/task_environment.h"
 #include "brave/components/brave_shields/browser/https_everywhere_recently_used_cache.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -27,4 +33,63 @@ TEST(HTTPSEverywhereRecentlyUsedCacheTest, Operations) {
   // Test remove.
   cache.remove("kD");
   ASSERT_FALSE(cache.get("kD", &v));
+
+  EXPECT_EQ(2u, cache.hits());
+  EXPECT_EQ(2u, cache.misses());
+}
+
+TEST(HTTPSEverywhereRecentlyUsedCacheTest, Sharding) {
+  using Cache = HTTPSERecentlyUsedCache<int>;
+  EXPECT_EQ(1u, Cache(Cache::kMinShardSize).shard_count());
+  EXPECT_EQ(4u, Cache(4 * Cache::kMinShardSize).shard_count());
+  EXPECT_EQ(8u, Cache(1000).shard_count());
+  EXPECT_EQ(2u, Cache(1000, 2).shard_count());
+
+  // All recently added entries fit, whichever shards they land in.
+  Cache cache(1000);
+  for (int i = 0; i < 500; ++i)
+    cache.add(base::NumberToString(i), i);
+  int v = 0;
+  for (int i = 0; i < 500; ++i) {
+    ASSERT_TRUE(cache.get(base::NumberToString(i), &v));
+    EXPECT_EQ(i, v);
+  }
+}
+
+// Hammers a single cache from several threads with overlapping keys. Mostly
+// useful under TSan, and to compare lock contention between implementations.
+TEST(HTTPSEverywhereRecentlyUsedCacheTest, ConcurrentAccess) {
+  constexpr int kThreads = 8;
+  constexpr int kKeys = 200;
+  constexpr int kIterations = 2000;
+
+  base::test::TaskEnvironment task_environment;
+  HTTPSERecentlyUsedCache<int> cache(100);
+
+  base::RunLoop run_loop;
+  auto done = base::BarrierClosure(kThreads, run_loop.QuitClosure());
+  for (int thread = 0; thread < kThreads; ++thread) {
+    base::ThreadPool::PostTaskAndReply(
+        FROM_HERE, base::BindOnce(
+                       [](HTTPSERecentlyUsedCache<int>* cache, int thread) {
+                         for (int i = 0; i < kIterations; ++i) {
+                           const std::string key =
+                               base::NumberToString((i * (thread + 1)) % kKeys);
+                           int value = 0;
+                           if (cache->get(key, &value)) {
+                             EXPECT_EQ(key, base::NumberToString(value));
+                           } else {
+                             cache->add(key, (i * (thread + 1)) % kKeys);
+                           }
+                           if (i % 7 == 0)
+                             cache->remove(key);
+                         }
+                       },
+                       &cache, thread),
+        done);
+  }
+  run_loop.Run();
+
+  EXPECT_EQ(static_cast<size_t>(kThreads * kIterations),
+            cache.hits() + cache.misses());
 }
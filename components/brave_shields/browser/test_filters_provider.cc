@@ -27,11 +27,10 @@ TestFiltersProvider::TestFiltersProvider(const base::FilePath& dat_location,
 TestFiltersProvider::~TestFiltersProvider() = default;
 
 void TestFiltersProvider::LoadDATBuffer(
-    base::OnceCallback<void(bool deserialize, const DATFileDataBuffer& dat_buf)>
-        cb) {
+    base::OnceCallback<void(bool deserialize, DATFileDataBuffer dat_buf)> cb) {
   if (dat_buffer_.empty()) {
     auto buffer = std::vector<unsigned char>(rules_.begin(), rules_.end());
-    std::move(cb).Run(false, buffer);
+    std::move(cb).Run(false, std::move(buffer));
   } else {
     std::move(cb).Run(true, dat_buffer_);
   }
@@ -123,5 +123,12 @@ constexpr base::FeatureParam<int>
     kAdblockOverrideRegexDiscardPolicyDiscardUnusedSec{
         &kAdblockOverrideRegexDiscardPolicy, "discard_unused_sec", 180};
 
+// When enabled, network requests are checked against the default and the
+// additional filter list engines concurrently on separate sequences, instead of
+// one after another on the shared adblock sequence.
+BASE_FEATURE(kAdblockParallelMatching,
+             "AdblockParallelMatching",
+             base::FEATURE_DISABLED_BY_DEFAULT);
+
 }  // namespace features
 }  // namespace brave_shields
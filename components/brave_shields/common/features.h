@@ -41,6 +41,7 @@ extern const base::FeatureParam<int>
     kAdblockOverrideRegexDiscardPolicyCleanupIntervalSec;
 extern const base::FeatureParam<int>
     kAdblockOverrideRegexDiscardPolicyDiscardUnusedSec;
+BASE_DECLARE_FEATURE(kAdblockParallelMatching);
 
 }  // namespace features
 }  // namespace brave_shields
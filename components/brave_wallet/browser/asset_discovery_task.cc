@@ -424,31 +424,17 @@ void AssetDiscoveryTask::MergeDiscoveredSPLTokens(
   base::flat_set<std::string> discovered_mint_addresses_set(
       std::move(discovered_mint_addresses));
 
-  auto internal_callback =
-      base::BindOnce(&AssetDiscoveryTask::OnGetSolanaTokenRegistry,
-                     weak_ptr_factory_.GetWeakPtr(), std::move(callback),
-                     std::move(discovered_mint_addresses_set));
-
-  // Fetch SOL registry tokens (mainnet only).
+  // Look up SOL registry tokens (mainnet only).
   // TODO(nvonpentz) This needs to be changed when we support multiple chains
   // for Solana.
-  BlockchainRegistry::GetInstance()->GetAllTokens(mojom::kSolanaMainnet,
-                                                  mojom::CoinType::SOL,
-                                                  std::move(internal_callback));
-}
-
-void AssetDiscoveryTask::OnGetSolanaTokenRegistry(
-    DiscoverAssetsCompletedCallback callback,
-    const base::flat_set<std::string>& discovered_mint_addresses,
-    std::vector<mojom::BlockchainTokenPtr> sol_token_registry) {
   std::vector<mojom::BlockchainTokenPtr> discovered_tokens;
-  for (const auto& token : sol_token_registry) {
-    if (discovered_mint_addresses.contains(token->contract_address)) {
-      if (!BraveWalletService::AddUserAsset(token.Clone(), prefs_)) {
-        continue;
-      }
-      discovered_tokens.push_back(token.Clone());
+  for (auto& token : BlockchainRegistry::GetInstance()->GetTokensByAddresses(
+           mojom::kSolanaMainnet, mojom::CoinType::SOL,
+           discovered_mint_addresses_set)) {
+    if (!BraveWalletService::AddUserAsset(token.Clone(), prefs_)) {
+      continue;
     }
+    discovered_tokens.push_back(std::move(token));
   }
 
   std::move(callback).Run(std::move(discovered_tokens));
@@ -104,10 +104,6 @@ class AssetDiscoveryTask {
   void MergeDiscoveredSPLTokens(DiscoverAssetsCompletedCallback callback,
                                 const std::vector<std::vector<SolanaAddress>>&
                                     all_discovered_contract_addresses);
-  void OnGetSolanaTokenRegistry(
-      DiscoverAssetsCompletedCallback callback,
-      const base::flat_set<std::string>& discovered_contract_addresses,
-      std::vector<mojom::BlockchainTokenPtr> sol_token_registry);
 
   // For discovering NFTs on Solana and Ethereum
   using FetchNFTsFromSimpleHashCallback =
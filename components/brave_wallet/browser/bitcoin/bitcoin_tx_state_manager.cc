@@ -16,8 +16,9 @@
 namespace brave_wallet {
 
 BitcoinTxStateManager::BitcoinTxStateManager(PrefService* prefs,
-                                             JsonRpcService* json_rpc_service)
-    : TxStateManager(prefs) {}
+                                             JsonRpcService* json_rpc_service,
+                                             TxStorage* tx_storage)
+    : TxStateManager(prefs, tx_storage) {}
 
 BitcoinTxStateManager::~BitcoinTxStateManager() = default;
 
@@ -39,13 +39,45 @@ void BlockchainRegistry::Bind(
   receivers_.Add(this, std::move(receiver));
 }
 
+BlockchainRegistry::TokenListIndex::TokenListIndex() = default;
+BlockchainRegistry::TokenListIndex::TokenListIndex(TokenListIndex&&) = default;
+BlockchainRegistry::TokenListIndex&
+BlockchainRegistry::TokenListIndex::operator=(TokenListIndex&&) = default;
+BlockchainRegistry::TokenListIndex::~TokenListIndex() = default;
+
+// static
+BlockchainRegistry::TokenListIndex BlockchainRegistry::BuildTokenListIndex(
+    const std::vector<mojom::BlockchainTokenPtr>& tokens) {
+  std::vector<std::pair<std::string, size_t>> contract_addresses;
+  std::vector<std::pair<std::string, size_t>> symbols;
+  contract_addresses.reserve(tokens.size());
+  symbols.reserve(tokens.size());
+  for (size_t i = 0; i < tokens.size(); ++i) {
+    contract_addresses.emplace_back(tokens[i]->contract_address, i);
+    symbols.emplace_back(tokens[i]->symbol, i);
+  }
+
+  // Keeps the first token of any sharing a contract address or symbol, as a
+  // linear search would find.
+  TokenListIndex index;
+  index.contract_addresses =
+      base::flat_map<std::string, size_t>(std::move(contract_addresses));
+  index.symbols = base::flat_map<std::string, size_t>(std::move(symbols));
+  return index;
+}
+
 void BlockchainRegistry::UpdateTokenList(TokenListMap token_list_map) {
   token_list_map_ = std::move(token_list_map);
+  token_list_indexes_.clear();
+  for (const auto& [key, tokens] : token_list_map_) {
+    token_list_indexes_[key] = BuildTokenListIndex(tokens);
+  }
 }
 
 void BlockchainRegistry::UpdateTokenList(
     const std::string key,
     std::vector<mojom::BlockchainTokenPtr> list) {
+  token_list_indexes_[key] = BuildTokenListIndex(list);
   token_list_map_[key] = std::move(list);
 }
 
@@ -69,16 +101,44 @@ mojom::BlockchainTokenPtr BlockchainRegistry::GetTokenByAddress(
     mojom::CoinType coin,
     const std::string& address) {
   const auto key = GetTokenListKey(coin, chain_id);
-  if (!token_list_map_.contains(key)) {
+  const auto index_it = token_list_indexes_.find(key);
+  if (index_it == token_list_indexes_.end()) {
     return nullptr;
   }
 
+  const auto token_it = index_it->second.contract_addresses.find(address);
+  if (token_it == index_it->second.contract_addresses.end()) {
+    return nullptr;
+  }
+  return token_list_map_[key][token_it->second].Clone();
+}
+
+std::vector<mojom::BlockchainTokenPtr> BlockchainRegistry::GetTokensByAddresses(
+    const std::string& chain_id,
+    mojom::CoinType coin,
+    const base::flat_set<std::string>& addresses) {
+  std::vector<mojom::BlockchainTokenPtr> result;
+  const auto key = GetTokenListKey(coin, chain_id);
+  const auto index_it = token_list_indexes_.find(key);
+  if (index_it == token_list_indexes_.end()) {
+    return result;
+  }
+
+  std::vector<size_t> positions;
+  for (const auto& address : addresses) {
+    const auto token_it = index_it->second.contract_addresses.find(address);
+    if (token_it != index_it->second.contract_addresses.end()) {
+      positions.push_back(token_it->second);
+    }
+  }
+  base::ranges::sort(positions);
+
   const auto& tokens = token_list_map_[key];
-  auto token_it = base::ranges::find_if(
-      tokens, [&](const mojom::BlockchainTokenPtr& current_token) {
-        return current_token->contract_address == address;
-      });
-  return token_it == tokens.end() ? nullptr : token_it->Clone();
+  result.reserve(positions.size());
+  for (const size_t position : positions) {
+    result.push_back(tokens[position].Clone());
+  }
+  return result;
 }
 
 void BlockchainRegistry::GetTokenBySymbol(const std::string& chain_id,
@@ -86,22 +146,19 @@ void BlockchainRegistry::GetTokenBySymbol(const std::string& chain_id,
                                           const std::string& symbol,
                                           GetTokenBySymbolCallback callback) {
   const auto key = GetTokenListKey(coin, chain_id);
-  if (!token_list_map_.contains(key)) {
+  const auto index_it = token_list_indexes_.find(key);
+  if (index_it == token_list_indexes_.end()) {
     std::move(callback).Run(nullptr);
     return;
   }
-  const auto& tokens = token_list_map_[key];
-  auto token_it = base::ranges::find_if(
-      tokens, [&](const mojom::BlockchainTokenPtr& current_token) {
-        return current_token->symbol == symbol;
-      });
 
-  if (token_it == tokens.end()) {
+  const auto token_it = index_it->second.symbols.find(symbol);
+  if (token_it == index_it->second.symbols.end()) {
     std::move(callback).Run(nullptr);
     return;
   }
 
-  std::move(callback).Run(token_it->Clone());
+  std::move(callback).Run(token_list_map_[key][token_it->second].Clone());
 }
 
 void BlockchainRegistry::GetAllTokens(const std::string& chain_id,
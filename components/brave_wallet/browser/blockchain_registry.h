@@ -9,6 +9,8 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/flat_map.h"
+#include "base/containers/flat_set.h"
 #include "brave/components/brave_wallet/browser/blockchain_list_parser.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
 #include "build/build_config.h"
@@ -42,6 +44,12 @@ class BlockchainRegistry : public mojom::BlockchainRegistry {
   mojom::BlockchainTokenPtr GetTokenByAddress(const std::string& chain_id,
                                               mojom::CoinType coin,
                                               const std::string& address);
+  // Returns the tokens whose contract address is in |addresses|, in token
+  // list order.
+  std::vector<mojom::BlockchainTokenPtr> GetTokensByAddresses(
+      const std::string& chain_id,
+      mojom::CoinType coin,
+      const base::flat_set<std::string>& addresses);
   std::vector<mojom::NetworkInfoPtr> GetPrepopulatedNetworks();
 
   // BlockchainRegistry interface methods
@@ -87,6 +95,24 @@ class BlockchainRegistry : public mojom::BlockchainRegistry {
   BlockchainRegistry();
 
  private:
+  // Positions in a token list of the first token with each contract address
+  // and symbol.
+  struct TokenListIndex {
+    TokenListIndex();
+    TokenListIndex(TokenListIndex&&);
+    TokenListIndex& operator=(TokenListIndex&&);
+    ~TokenListIndex();
+
+    base::flat_map<std::string, size_t> contract_addresses;
+    base::flat_map<std::string, size_t> symbols;
+  };
+
+  static TokenListIndex BuildTokenListIndex(
+      const std::vector<mojom::BlockchainTokenPtr>& tokens);
+
+  // Keyed like token_list_map_, rebuilt whenever a token list is updated.
+  base::flat_map<std::string, TokenListIndex> token_list_indexes_;
+
   mojo::ReceiverSet<mojom::BlockchainRegistry> receivers_;
   std::vector<brave_wallet::mojom::BlockchainTokenPtr> GetBuyTokens(
       const std::vector<mojom::OnRampProvider>& providers,
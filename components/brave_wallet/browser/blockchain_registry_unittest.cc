@@ -7,6 +7,8 @@
 #include <utility>
 #include <vector>
 
+#include "base/containers/flat_set.h"
+#include "base/strings/stringprintf.h"
 #include "base/test/bind.h"
 #include "base/test/task_environment.h"
 #include "brave/components/brave_wallet/browser/blockchain_list_parser.h"
@@ -525,6 +527,76 @@ TEST(BlockchainRegistryUnitTest, GetTokenBySymbol) {
   run_loop5.Run();
 }
 
+TEST(BlockchainRegistryUnitTest, GetTokensByAddresses) {
+  base::test::TaskEnvironment task_environment;
+  auto* registry = BlockchainRegistry::GetInstance();
+  TokenListMap token_list_map;
+  ASSERT_TRUE(
+      ParseTokenList(token_list_json, &token_list_map, mojom::CoinType::ETH));
+  registry->UpdateTokenList(std::move(token_list_map));
+
+  auto tokens = registry->GetTokensByAddresses(
+      mojom::kMainnetChainId, mojom::CoinType::ETH,
+      {"0x6090A6e47849629b7245Dfa1Ca21D94cd15878Ef",
+       "0xCCC775F648430679A709E98d2b0Cb6250d2887EF",
+       "0x06012c8cf97BEaD5deAe237070F9587f8E7A266d"});
+  ASSERT_EQ(tokens.size(), 2u);
+  EXPECT_EQ(tokens[0]->symbol, "CK");
+  EXPECT_EQ(tokens[1]->name, "ENS Registrar");
+
+  EXPECT_TRUE(registry
+                  ->GetTokensByAddresses(
+                      mojom::kSolanaMainnet, mojom::CoinType::SOL,
+                      {"EPjFWdd5AufqSSqeM2qN1xzybapC8G4wEGGkZwyTDt1v"})
+                  .empty());
+}
+
+TEST(BlockchainRegistryUnitTest, LargeTokenList) {
+  base::test::TaskEnvironment task_environment;
+  auto* registry = BlockchainRegistry::GetInstance();
+
+  // Roughly the size of the Ethereum mainnet token list, with every symbol
+  // used twice so lookups by symbol must return the first token.
+  constexpr size_t kTokenCount = 20000;
+  std::vector<mojom::BlockchainTokenPtr> tokens;
+  for (size_t i = 0; i < kTokenCount; ++i) {
+    auto token = mojom::BlockchainToken::New();
+    token->contract_address = base::StringPrintf("0x%040zx", i);
+    token->symbol = base::StringPrintf("TKN%zu", i / 2);
+    token->chain_id = mojom::kMainnetChainId;
+    token->coin = mojom::CoinType::ETH;
+    tokens.push_back(std::move(token));
+  }
+  registry->UpdateTokenList(
+      GetTokenListKey(mojom::CoinType::ETH, mojom::kMainnetChainId),
+      std::move(tokens));
+
+  base::flat_set<std::string> addresses;
+  for (size_t i = 0; i < kTokenCount; i += 100) {
+    auto token = registry->GetTokenByAddress(
+        mojom::kMainnetChainId, mojom::CoinType::ETH,
+        base::StringPrintf("0x%040zx", i + 1));
+    ASSERT_TRUE(token);
+    EXPECT_EQ(token->symbol, base::StringPrintf("TKN%zu", (i + 1) / 2));
+    addresses.insert(token->contract_address);
+  }
+  EXPECT_EQ(registry
+                ->GetTokensByAddresses(mojom::kMainnetChainId,
+                                       mojom::CoinType::ETH, addresses)
+                .size(),
+            kTokenCount / 100);
+
+  base::RunLoop run_loop;
+  registry->GetTokenBySymbol(
+      mojom::kMainnetChainId, mojom::CoinType::ETH, "TKN42",
+      base::BindLambdaForTesting([&](mojom::BlockchainTokenPtr token) {
+        ASSERT_TRUE(token);
+        EXPECT_EQ(token->contract_address, base::StringPrintf("0x%040x", 84));
+        run_loop.Quit();
+      }));
+  run_loop.Run();
+}
+
 TEST(BlockchainRegistryUnitTest, GetBuyTokens) {
   base::test::TaskEnvironment task_environment;
   auto* registry = BlockchainRegistry::GetInstance();
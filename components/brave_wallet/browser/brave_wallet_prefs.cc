@@ -208,6 +208,9 @@ void RegisterProfilePrefsForMigration(
   // Added 04/2023
   registry->RegisterBooleanPref(kBraveWalletSolanaTransactionsV0SupportMigrated,
                                 false);
+
+  // Added 10/2023
+  registry->RegisterBooleanPref(kBraveWalletTransactionsDBMigrated, false);
 }
 
 void ClearJsonRpcServiceProfilePrefs(PrefService* prefs) {
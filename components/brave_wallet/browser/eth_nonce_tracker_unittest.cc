@@ -9,6 +9,7 @@
 #include <string>
 #include <utility>
 
+#include "base/files/file_path.h"
 #include "base/test/bind.h"
 #include "base/test/task_environment.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_constants.h"
@@ -19,6 +20,7 @@
 #include "brave/components/brave_wallet/browser/eth_tx_state_manager.h"
 #include "brave/components/brave_wallet/browser/json_rpc_service.h"
 #include "brave/components/brave_wallet/browser/tx_meta.h"
+#include "brave/components/brave_wallet/browser/tx_storage.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
 #include "brave/components/brave_wallet/common/brave_wallet_types.h"
 #include "brave/components/brave_wallet/common/eth_address.h"
@@ -104,7 +106,8 @@ class EthNonceTrackerUnitTest : public testing::Test {
 TEST_F(EthNonceTrackerUnitTest, GetNonce) {
   JsonRpcService service(shared_url_loader_factory(), GetPrefs());
 
-  EthTxStateManager tx_state_manager(GetPrefs());
+  TxStorage tx_storage(GetPrefs(), base::FilePath());
+  EthTxStateManager tx_state_manager(GetPrefs(), &tx_storage);
   EthNonceTracker nonce_tracker(&tx_state_manager, &service);
 
   SetTransactionCount(2);
@@ -155,7 +158,8 @@ TEST_F(EthNonceTrackerUnitTest, GetNonce) {
 
 TEST_F(EthNonceTrackerUnitTest, NonceLock) {
   JsonRpcService service(shared_url_loader_factory(), GetPrefs());
-  EthTxStateManager tx_state_manager(GetPrefs());
+  TxStorage tx_storage(GetPrefs(), base::FilePath());
+  EthTxStateManager tx_state_manager(GetPrefs(), &tx_storage);
   EthNonceTracker nonce_tracker(&tx_state_manager, &service);
 
   SetTransactionCount(4);
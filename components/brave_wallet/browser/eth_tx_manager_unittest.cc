@@ -11,6 +11,7 @@
 #include <utility>
 #include <vector>
 
+#include "base/files/file_path.h"
 #include "base/functional/callback_helpers.h"
 #include "base/test/bind.h"
 #include "base/test/scoped_feature_list.h"
@@ -258,7 +259,8 @@ class EthTxManagerUnitTest : public testing::Test {
         json_rpc_service_.get(), &profile_prefs_, &local_state_);
     tx_service_ =
         std::make_unique<TxService>(json_rpc_service_.get(), nullptr,
-                                    keyring_service_.get(), &profile_prefs_);
+                                    keyring_service_.get(), &profile_prefs_,
+                                    base::FilePath());
 
     keyring_service_->CreateWallet("testing123", base::DoNothing());
     base::RunLoop().RunUntilIdle();
@@ -2493,14 +2495,16 @@ TEST_F(EthTxManagerUnitTest, Reset) {
   auto tx = EthTransaction::FromTxData(tx_data, false);
   meta.set_tx(std::make_unique<EthTransaction>(*tx));
   eth_tx_manager()->tx_state_manager_->AddOrUpdateTx(meta);
-  EXPECT_TRUE(GetPrefs()->HasPrefPath(kBraveWalletTransactions));
+  EXPECT_TRUE(eth_tx_manager()->tx_state_manager_->GetTx(
+      mojom::kLocalhostChainId, "001"));
 
   tx_service_->Reset();
 
   EXPECT_TRUE(eth_tx_manager()->pending_chain_ids_.empty());
   EXPECT_FALSE(
       eth_tx_manager()->block_tracker_->IsRunning(mojom::kLocalhostChainId));
-  EXPECT_FALSE(GetPrefs()->HasPrefPath(kBraveWalletTransactions));
+  EXPECT_FALSE(eth_tx_manager()->tx_state_manager_->GetTx(
+      mojom::kLocalhostChainId, "001"));
 }
 
 }  //  namespace brave_wallet
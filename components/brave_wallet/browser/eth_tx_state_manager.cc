@@ -20,8 +20,9 @@
 
 namespace brave_wallet {
 
-EthTxStateManager::EthTxStateManager(PrefService* prefs)
-    : TxStateManager(prefs) {}
+EthTxStateManager::EthTxStateManager(PrefService* prefs,
+                                     TxStorage* tx_storage)
+    : TxStateManager(prefs, tx_storage) {}
 
 EthTxStateManager::~EthTxStateManager() = default;
 
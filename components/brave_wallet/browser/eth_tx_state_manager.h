@@ -30,7 +30,7 @@ class EthTxMeta;
 
 class EthTxStateManager : public TxStateManager {
  public:
-  explicit EthTxStateManager(PrefService* prefs);
+  EthTxStateManager(PrefService* prefs, TxStorage* tx_storage);
   ~EthTxStateManager() override;
   EthTxStateManager(const EthTxStateManager&) = delete;
   EthTxStateManager operator=(const EthTxStateManager&) = delete;
@@ -8,6 +8,7 @@
 #include <memory>
 #include <utility>
 
+#include "base/files/file_path.h"
 #include "base/run_loop.h"
 #include "base/test/bind.h"
 #include "base/test/task_environment.h"
@@ -36,13 +37,15 @@ class EthTxStateManagerUnitTest : public testing::Test {
  protected:
   void SetUp() override {
     brave_wallet::RegisterProfilePrefs(prefs_.registry());
-    eth_tx_state_manager_ = std::make_unique<EthTxStateManager>(GetPrefs());
+    eth_tx_state_manager_ =
+        std::make_unique<EthTxStateManager>(GetPrefs(), &tx_storage_);
   }
 
   PrefService* GetPrefs() { return &prefs_; }
 
   base::test::TaskEnvironment task_environment_;
   sync_preferences::TestingPrefServiceSyncable prefs_;
+  TxStorage tx_storage_{&prefs_, base::FilePath()};
   std::unique_ptr<EthTxStateManager> eth_tx_state_manager_;
 };
 
@@ -7,6 +7,7 @@
 
 #include <utility>
 
+#include "base/files/file_path.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/test/bind.h"
 #include "base/test/task_environment.h"
@@ -15,6 +16,7 @@
 #include "brave/components/brave_wallet/browser/fil_tx_meta.h"
 #include "brave/components/brave_wallet/browser/fil_tx_state_manager.h"
 #include "brave/components/brave_wallet/browser/json_rpc_service.h"
+#include "brave/components/brave_wallet/browser/tx_storage.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
 #include "components/sync_preferences/testing_pref_service_syncable.h"
 #include "services/data_decoder/public/cpp/test_support/in_process_data_decoder.h"
@@ -94,7 +96,8 @@ class FilNonceTrackerUnitTest : public testing::Test {
 TEST_F(FilNonceTrackerUnitTest, GetNonce) {
   JsonRpcService service(shared_url_loader_factory(), GetPrefs());
 
-  FilTxStateManager tx_state_manager(GetPrefs());
+  TxStorage tx_storage(GetPrefs(), base::FilePath());
+  FilTxStateManager tx_state_manager(GetPrefs(), &tx_storage);
   FilNonceTracker nonce_tracker(&tx_state_manager, &service);
 
   SetTransactionCount(2);
@@ -142,7 +145,8 @@ TEST_F(FilNonceTrackerUnitTest, GetNonce) {
 
 TEST_F(FilNonceTrackerUnitTest, NonceLock) {
   JsonRpcService service(shared_url_loader_factory(), GetPrefs());
-  FilTxStateManager tx_state_manager(GetPrefs());
+  TxStorage tx_storage(GetPrefs(), base::FilePath());
+  FilTxStateManager tx_state_manager(GetPrefs(), &tx_storage);
   FilNonceTracker nonce_tracker(&tx_state_manager, &service);
 
   SetTransactionCount(4);
@@ -18,8 +18,9 @@
 
 namespace brave_wallet {
 
-FilTxStateManager::FilTxStateManager(PrefService* prefs)
-    : TxStateManager(prefs) {}
+FilTxStateManager::FilTxStateManager(PrefService* prefs,
+                                     TxStorage* tx_storage)
+    : TxStateManager(prefs, tx_storage) {}
 
 FilTxStateManager::~FilTxStateManager() = default;
 
@@ -26,7 +26,7 @@ class FilTxMeta;
 
 class FilTxStateManager : public TxStateManager {
  public:
-  explicit FilTxStateManager(PrefService* prefs);
+  FilTxStateManager(PrefService* prefs, TxStorage* tx_storage);
   ~FilTxStateManager() override;
   FilTxStateManager(const FilTxStateManager&) = delete;
   FilTxStateManager operator=(const FilTxStateManager&) = delete;
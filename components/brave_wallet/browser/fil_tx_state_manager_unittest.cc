@@ -9,6 +9,7 @@
 #include <utility>
 #include <vector>
 
+#include "base/files/file_path.h"
 #include "base/test/bind.h"
 #include "base/test/task_environment.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_prefs.h"
@@ -29,13 +30,15 @@ class FilTxStateManagerUnitTest : public testing::Test {
  protected:
   void SetUp() override {
     brave_wallet::RegisterProfilePrefs(prefs_.registry());
-    fil_tx_state_manager_ = std::make_unique<FilTxStateManager>(GetPrefs());
+    fil_tx_state_manager_ =
+        std::make_unique<FilTxStateManager>(GetPrefs(), &tx_storage_);
   }
 
   PrefService* GetPrefs() { return &prefs_; }
 
   base::test::TaskEnvironment task_environment_;
   sync_preferences::TestingPrefServiceSyncable prefs_;
+  TxStorage tx_storage_{&prefs_, base::FilePath()};
   std::unique_ptr<FilTxStateManager> fil_tx_state_manager_;
 };
 
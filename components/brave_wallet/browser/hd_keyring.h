@@ -66,6 +66,9 @@ class HDKeyring {
 
   std::unique_ptr<HDKeyBase> root_;
   std::vector<std::unique_ptr<HDKeyBase>> accounts_;
+  // Addresses of the leading accounts_, filled in by GetAddress so the public
+  // key and address of an account are only computed once.
+  mutable std::vector<std::string> account_addresses_;
   // TODO(apaymyshev): make separate abstraction for imported keys as they are
   // not HD keys.
   // (address, key)
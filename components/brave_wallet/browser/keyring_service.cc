@@ -11,6 +11,7 @@
 #include "base/base64.h"
 #include "base/check_op.h"
 #include "base/command_line.h"
+#include "base/functional/bind.h"
 #include "base/logging.h"
 #include "base/notreached.h"
 #include "base/strings/strcat.h"
@@ -18,6 +19,7 @@
 #include "base/strings/string_split.h"
 #include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/task/thread_pool.h"
 #include "base/value_iterators.h"
 #include "base/values.h"
 #include "brave/components/brave_wallet/browser/bitcoin/bitcoin_keyring.h"
@@ -517,6 +519,38 @@ mojom::AccountInfoPtr MakeAccountInfoForImportedAccount(
       nullptr);
 }
 
+// Deriving a key from a password takes hundreds of milliseconds, so the
+// functions below run on the thread pool.
+base::flat_map<mojom::KeyringId, std::unique_ptr<PasswordEncryptor>>
+DeriveEncryptors(
+    const std::string& password,
+    const base::flat_map<mojom::KeyringId, std::vector<uint8_t>>& salts,
+    int iterations) {
+  base::flat_map<mojom::KeyringId, std::unique_ptr<PasswordEncryptor>>
+      encryptors;
+  for (const auto& [keyring_id, salt] : salts) {
+    encryptors[keyring_id] =
+        PasswordEncryptor::DeriveKeyFromPasswordUsingPbkdf2(
+            password, salt, iterations, kPbkdf2KeySize);
+  }
+  return encryptors;
+}
+
+bool IsPasswordValid(const std::string& password,
+                     const std::vector<uint8_t>& salt,
+                     int iterations,
+                     const std::vector<uint8_t>& encrypted_mnemonic,
+                     const std::vector<uint8_t>& nonce) {
+  auto encryptor = PasswordEncryptor::DeriveKeyFromPasswordUsingPbkdf2(
+      password, salt, iterations, kPbkdf2KeySize);
+  if (!encryptor) {
+    return false;
+  }
+
+  auto mnemonic = encryptor->Decrypt(encrypted_mnemonic, nonce);
+  return mnemonic && !mnemonic->empty();
+}
+
 }  // namespace
 
 KeyringService::KeyringService(JsonRpcService* json_rpc_service,
@@ -669,6 +703,16 @@ HDKeyring* KeyringService::ResumeKeyring(mojom::KeyringId keyring_id,
     return nullptr;
   }
 
+  return ResumeKeyringWithEncryptor(keyring_id);
+}
+
+HDKeyring* KeyringService::ResumeKeyringWithEncryptor(
+    mojom::KeyringId keyring_id) {
+  DCHECK(profile_prefs_);
+  if (!encryptors_[keyring_id]) {
+    return nullptr;
+  }
+
   const std::string mnemonic = GetMnemonicForKeyringImpl(keyring_id);
   if (mnemonic.empty()) {
     return nullptr;
@@ -788,7 +832,16 @@ void KeyringService::GetKeyringInfo(mojom::KeyringId keyring_id,
 void KeyringService::GetMnemonicForDefaultKeyring(
     const std::string& password,
     GetMnemonicForDefaultKeyringCallback callback) {
-  if (!ValidatePasswordInternal(password)) {
+  ValidatePasswordInternal(
+      password,
+      base::BindOnce(&KeyringService::OnValidatePasswordForGetMnemonic,
+                     weak_ptr_factory_.GetWeakPtr(), std::move(callback)));
+}
+
+void KeyringService::OnValidatePasswordForGetMnemonic(
+    GetMnemonicForDefaultKeyringCallback callback,
+    bool is_password_valid) {
+  if (!is_password_valid) {
     std::move(callback).Run("");
     return;
   }
@@ -1017,7 +1070,23 @@ void KeyringService::EncodePrivateKeyForExport(
     mojom::AccountIdPtr account_id,
     const std::string& password,
     EncodePrivateKeyForExportCallback callback) {
-  if (!account_id || !ValidatePasswordInternal(password)) {
+  if (!account_id) {
+    std::move(callback).Run("");
+    return;
+  }
+
+  ValidatePasswordInternal(
+      password,
+      base::BindOnce(&KeyringService::OnValidatePasswordForExport,
+                     weak_ptr_factory_.GetWeakPtr(), std::move(account_id),
+                     std::move(callback)));
+}
+
+void KeyringService::OnValidatePasswordForExport(
+    mojom::AccountIdPtr account_id,
+    EncodePrivateKeyForExportCallback callback,
+    bool is_password_valid) {
+  if (!is_password_valid) {
     std::move(callback).Run("");
     return;
   }
@@ -1237,14 +1306,12 @@ void KeyringService::RemoveSelectedAccountForCoin(mojom::CoinType coin,
 void KeyringService::RemoveAccount(mojom::AccountIdPtr account_id,
                                    const std::string& password,
                                    RemoveAccountCallback callback) {
-  if (account_id->kind == mojom::AccountKind::kImported &&
-      !ValidatePasswordInternal(password)) {
-    std::move(callback).Run(false);
-    return;
-  }
-
   if (account_id->kind == mojom::AccountKind::kImported) {
-    std::move(callback).Run(RemoveImportedAccountInternal(*account_id));
+    ValidatePasswordInternal(
+        password,
+        base::BindOnce(&KeyringService::OnValidatePasswordForRemoveAccount,
+                       weak_ptr_factory_.GetWeakPtr(), std::move(account_id),
+                       std::move(callback)));
     return;
   }
 
@@ -1257,6 +1324,18 @@ void KeyringService::RemoveAccount(mojom::AccountIdPtr account_id,
   std::move(callback).Run(false);
 }
 
+void KeyringService::OnValidatePasswordForRemoveAccount(
+    mojom::AccountIdPtr account_id,
+    RemoveAccountCallback callback,
+    bool is_password_valid) {
+  if (!is_password_valid) {
+    std::move(callback).Run(false);
+    return;
+  }
+
+  std::move(callback).Run(RemoveImportedAccountInternal(*account_id));
+}
+
 bool KeyringService::RemoveImportedAccountInternal(
     const mojom::AccountId& account_id) {
   DCHECK_EQ(account_id.kind, mojom::AccountKind::kImported);
@@ -1700,6 +1779,9 @@ absl::optional<std::string> KeyringService::GetFilecoinSelectedAccount(
 }
 
 void KeyringService::Lock() {
+  // Drop the result of any unlock still deriving its keys, which would
+  // otherwise unlock the wallet again once it arrives.
+  ++unlock_generation_;
   if (IsLockedSync()) {
     return;
   }
@@ -1727,14 +1809,96 @@ bool KeyringService::IsHardwareAccount(mojom::KeyringId keyring_id,
 
 void KeyringService::Unlock(const std::string& password,
                             KeyringService::UnlockCallback callback) {
-  if (!ResumeKeyring(mojom::kDefaultKeyringId, password)) {
+  if (password.empty()) {
     encryptors_.erase(mojom::kDefaultKeyringId);
     std::move(callback).Run(false);
     return;
   }
 
+  // Added 08.08.2022
+  MaybeMigratePBKDF2Iterations(password);
+
+  std::vector<mojom::KeyringId> keyring_ids = {mojom::kDefaultKeyringId};
   if (IsFilecoinEnabled()) {
-    if (!ResumeKeyring(mojom::kFilecoinKeyringId, password)) {
+    keyring_ids.push_back(mojom::kFilecoinKeyringId);
+    keyring_ids.push_back(mojom::kFilecoinTestnetKeyringId);
+  }
+  if (IsSolanaEnabled()) {
+    keyring_ids.push_back(mojom::kSolanaKeyringId);
+  }
+  if (IsBitcoinEnabled()) {
+    keyring_ids.push_back(mojom::kBitcoinKeyring84Id);
+    keyring_ids.push_back(mojom::kBitcoinKeyring84TestId);
+  }
+
+  // Keys for all keyrings are derived in a single background task. Keyrings
+  // without a salt get a new one, which is only stored once the password is
+  // known to be correct.
+  base::flat_map<mojom::KeyringId, std::vector<uint8_t>> salts;
+  base::flat_map<mojom::KeyringId, std::vector<uint8_t>> new_salts;
+  for (const auto keyring_id : keyring_ids) {
+    if (auto salt = GetPrefInBytesForKeyring(
+            *profile_prefs_, kPasswordEncryptorSalt, keyring_id)) {
+      salts[keyring_id] = std::move(*salt);
+      continue;
+    }
+    std::vector<uint8_t> salt(kSaltSize);
+    crypto::RandBytes(salt);
+    salts[keyring_id] = salt;
+    new_salts[keyring_id] = std::move(salt);
+  }
+
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, {base::TaskPriority::USER_BLOCKING},
+      base::BindOnce(&DeriveEncryptors, password, std::move(salts),
+                     GetPbkdf2Iterations()),
+      base::BindOnce(&KeyringService::OnUnlockEncryptorsDerived,
+                     weak_ptr_factory_.GetWeakPtr(), unlock_generation_,
+                     std::move(new_salts), std::move(callback)));
+}
+
+void KeyringService::OnUnlockEncryptorsDerived(
+    uint64_t unlock_generation,
+    base::flat_map<mojom::KeyringId, std::vector<uint8_t>> new_salts,
+    UnlockCallback callback,
+    base::flat_map<mojom::KeyringId, std::unique_ptr<PasswordEncryptor>>
+        encryptors) {
+  if (unlock_generation != unlock_generation_) {
+    // The wallet was locked or reset while the keys were being derived.
+    std::move(callback).Run(false);
+    return;
+  }
+
+  encryptors_[mojom::kDefaultKeyringId] =
+      std::move(encryptors[mojom::kDefaultKeyringId]);
+  if (new_salts.contains(mojom::kDefaultKeyringId) ||
+      !ResumeKeyringWithEncryptor(mojom::kDefaultKeyringId)) {
+    encryptors_.erase(mojom::kDefaultKeyringId);
+    std::move(callback).Run(false);
+    return;
+  }
+
+  for (auto& [keyring_id, encryptor] : encryptors) {
+    if (keyring_id == mojom::kDefaultKeyringId) {
+      continue;
+    }
+    const auto new_salt = new_salts.find(keyring_id);
+    if (new_salt != new_salts.end()) {
+      const auto salt = GetPrefInBytesForKeyring(
+          *profile_prefs_, kPasswordEncryptorSalt, keyring_id);
+      if (!salt) {
+        SetPrefInBytesForKeyring(profile_prefs_, kPasswordEncryptorSalt,
+                                 new_salt->second, keyring_id);
+      } else if (*salt != new_salt->second) {
+        // Another salt was stored while the key was being derived.
+        continue;
+      }
+    }
+    encryptors_[keyring_id] = std::move(encryptor);
+  }
+
+  if (IsFilecoinEnabled()) {
+    if (!ResumeKeyringWithEncryptor(mojom::kFilecoinKeyringId)) {
       // If Filecoin keyring doesnt exist we keep encryptor pre-created
       // to be able to lazily create keyring later
       if (IsKeyringExist(mojom::kFilecoinKeyringId)) {
@@ -1745,7 +1909,7 @@ void KeyringService::Unlock(const std::string& password,
       }
     }
 
-    if (!ResumeKeyring(mojom::kFilecoinTestnetKeyringId, password)) {
+    if (!ResumeKeyringWithEncryptor(mojom::kFilecoinTestnetKeyringId)) {
       if (IsKeyringExist(mojom::kFilecoinTestnetKeyringId)) {
         VLOG(1) << __func__ << " Unable to unlock filecoin testnet keyring";
         encryptors_.erase(mojom::kFilecoinTestnetKeyringId);
@@ -1755,7 +1919,8 @@ void KeyringService::Unlock(const std::string& password,
     }
   }
 
-  if (IsSolanaEnabled() && !ResumeKeyring(mojom::kSolanaKeyringId, password)) {
+  if (IsSolanaEnabled() &&
+      !ResumeKeyringWithEncryptor(mojom::kSolanaKeyringId)) {
     if (IsKeyringExist(mojom::kSolanaKeyringId)) {
       VLOG(1) << __func__ << " Unable to unlock Solana keyring";
       encryptors_.erase(mojom::kSolanaKeyringId);
@@ -1765,8 +1930,8 @@ void KeyringService::Unlock(const std::string& password,
   }
 
   if (IsBitcoinEnabled()) {
-    ResumeKeyring(mojom::kBitcoinKeyring84Id, password);
-    ResumeKeyring(mojom::kBitcoinKeyring84TestId, password);
+    ResumeKeyringWithEncryptor(mojom::kBitcoinKeyring84Id);
+    ResumeKeyringWithEncryptor(mojom::kBitcoinKeyring84TestId);
   }
 
   UpdateLastUnlockPref(local_state_);
@@ -1788,6 +1953,7 @@ void KeyringService::IsLocked(IsLockedCallback callback) {
 }
 
 void KeyringService::Reset(bool notify_observer) {
+  ++unlock_generation_;
   account_discovery_manager_.reset();
   StopAutoLockTimer();
   encryptors_.clear();
@@ -2308,9 +2474,12 @@ void KeyringService::IsStrongPassword(const std::string& password,
   std::move(callback).Run(true);
 }
 
-bool KeyringService::ValidatePasswordInternal(const std::string& password) {
+void KeyringService::ValidatePasswordInternal(
+    const std::string& password,
+    base::OnceCallback<void(bool)> callback) {
   if (password.empty()) {
-    return false;
+    std::move(callback).Run(false);
+    return;
   }
 
   const mojom::KeyringId keyring_id = mojom::kDefaultKeyringId;
@@ -2323,7 +2492,8 @@ bool KeyringService::ValidatePasswordInternal(const std::string& password) {
                                         kPasswordEncryptorNonce, keyring_id);
 
   if (!salt || !encrypted_mnemonic || !nonce) {
-    return false;
+    std::move(callback).Run(false);
+    return;
   }
 
   auto iterations =
@@ -2331,22 +2501,16 @@ bool KeyringService::ValidatePasswordInternal(const std::string& password) {
           ? GetPbkdf2Iterations()
           : kPbkdf2IterationsLegacy;
 
-  // TODO(apaymyshev): move this call(and other ones in this file) to
-  // background thread.
-  auto encryptor = PasswordEncryptor::DeriveKeyFromPasswordUsingPbkdf2(
-      password, *salt, iterations, kPbkdf2KeySize);
-
-  if (!encryptor) {
-    return false;
-  }
-
-  auto mnemonic = encryptor->Decrypt(*encrypted_mnemonic, *nonce);
-  return mnemonic && !mnemonic->empty();
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, {base::TaskPriority::USER_BLOCKING},
+      base::BindOnce(&IsPasswordValid, password, std::move(*salt), iterations,
+                     std::move(*encrypted_mnemonic), std::move(*nonce)),
+      std::move(callback));
 }
 
 void KeyringService::ValidatePassword(const std::string& password,
                                       ValidatePasswordCallback callback) {
-  std::move(callback).Run(ValidatePasswordInternal(password));
+  ValidatePasswordInternal(password, std::move(callback));
 }
 
 void KeyringService::GetChecksumEthAddress(
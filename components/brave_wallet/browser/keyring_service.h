@@ -11,6 +11,8 @@
 #include <utility>
 #include <vector>
 
+#include "base/containers/flat_map.h"
+#include "base/functional/callback.h"
 #include "base/gtest_prod_util.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/weak_ptr.h"
@@ -346,6 +348,14 @@ class KeyringService : public KeyedService, public mojom::KeyringService {
   // It's used to reconstruct same default keyring between browser relaunch
   HDKeyring* ResumeKeyring(mojom::KeyringId keyring_id,
                            const std::string& password);
+  // Same as ResumeKeyring but with the encryptor already in encryptors_.
+  HDKeyring* ResumeKeyringWithEncryptor(mojom::KeyringId keyring_id);
+  void OnUnlockEncryptorsDerived(
+      uint64_t unlock_generation,
+      base::flat_map<mojom::KeyringId, std::vector<uint8_t>> new_salts,
+      UnlockCallback callback,
+      base::flat_map<mojom::KeyringId, std::unique_ptr<PasswordEncryptor>>
+          encryptors);
 
   void MaybeMigratePBKDF2Iterations(const std::string& password);
 
@@ -366,7 +376,19 @@ class KeyringService : public KeyedService, public mojom::KeyringService {
   void AddHardwareAccounts(std::vector<mojom::HardwareWalletAccountPtr> info,
                            mojom::KeyringId keyring_id);
 
-  bool ValidatePasswordInternal(const std::string& password);
+  // Derives the key on the thread pool and runs |callback| with whether
+  // |password| decrypts the default keyring.
+  void ValidatePasswordInternal(const std::string& password,
+                                base::OnceCallback<void(bool)> callback);
+  void OnValidatePasswordForGetMnemonic(
+      GetMnemonicForDefaultKeyringCallback callback,
+      bool is_password_valid);
+  void OnValidatePasswordForExport(mojom::AccountIdPtr account_id,
+                                   EncodePrivateKeyForExportCallback callback,
+                                   bool is_password_valid);
+  void OnValidatePasswordForRemoveAccount(mojom::AccountIdPtr account_id,
+                                          RemoveAccountCallback callback,
+                                          bool is_password_valid);
   void MaybeUnlockWithCommandLine();
 
   std::unique_ptr<base::OneShotTimer> auto_lock_timer_;
@@ -379,12 +401,17 @@ class KeyringService : public KeyedService, public mojom::KeyringService {
   raw_ptr<PrefService> profile_prefs_ = nullptr;
   raw_ptr<PrefService> local_state_ = nullptr;
   bool request_unlock_pending_ = false;
+  // Incremented by Lock() and Reset(), so that an Unlock() whose keys are
+  // still being derived on the thread pool can tell it was superseded.
+  uint64_t unlock_generation_ = 0;
 
   mojo::RemoteSet<mojom::KeyringServiceObserver> observers_;
   mojo::ReceiverSet<mojom::KeyringService> receivers_;
 
   std::unique_ptr<AccountDiscoveryManager> account_discovery_manager_;
 
+  base::WeakPtrFactory<KeyringService> weak_ptr_factory_{this};
+
   KeyringService(const KeyringService&) = delete;
   KeyringService& operator=(const KeyringService&) = delete;
 };
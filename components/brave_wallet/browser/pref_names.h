@@ -62,6 +62,8 @@ extern const char kBraveWalletLastTransactionSentTimeDict[];
 extern const char kBraveWalletTransactionsChainIdMigrated[];
 // Added 04/2023 to migrate solana transactions for v0 transaction support.
 extern const char kBraveWalletSolanaTransactionsV0SupportMigrated[];
+// Added 10/2023 to move kBraveWalletTransactions to TxDatabase.
+extern const char kBraveWalletTransactionsDBMigrated[];
 
 // DEPRECATED
 extern const char kShowWalletTestNetworksDeprecated[];
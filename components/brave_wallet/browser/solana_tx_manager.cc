@@ -32,8 +32,9 @@ namespace brave_wallet {
 SolanaTxManager::SolanaTxManager(TxService* tx_service,
                                  JsonRpcService* json_rpc_service,
                                  KeyringService* keyring_service,
-                                 PrefService* prefs)
-    : TxManager(std::make_unique<SolanaTxStateManager>(prefs),
+                                 PrefService* prefs,
+                                 TxStorage* tx_storage)
+    : TxManager(std::make_unique<SolanaTxStateManager>(prefs, tx_storage),
                 std::make_unique<SolanaBlockTracker>(json_rpc_service),
                 tx_service,
                 json_rpc_service,
@@ -81,7 +82,11 @@ void SolanaTxManager::AddUnapprovedTransaction(
   meta.set_created_time(base::Time::Now());
   meta.set_status(mojom::TransactionStatus::Unapproved);
   meta.set_chain_id(chain_id);
-  tx_state_manager_->AddOrUpdateTx(meta);
+  if (!tx_state_manager_->AddOrUpdateTx(meta)) {
+    std::move(callback).Run(
+        false, "", l10n_util::GetStringUTF8(IDS_WALLET_INTERNAL_ERROR));
+    return;
+  }
   std::move(callback).Run(true, meta.id(), "");
 }
 
@@ -15,8 +15,9 @@
 
 namespace brave_wallet {
 
-SolanaTxStateManager::SolanaTxStateManager(PrefService* prefs)
-    : TxStateManager(prefs) {}
+SolanaTxStateManager::SolanaTxStateManager(PrefService* prefs,
+                                           TxStorage* tx_storage)
+    : TxStateManager(prefs, tx_storage) {}
 
 SolanaTxStateManager::~SolanaTxStateManager() = default;
 
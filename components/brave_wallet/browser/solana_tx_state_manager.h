@@ -25,7 +25,7 @@ class SolanaTxMeta;
 
 class SolanaTxStateManager : public TxStateManager {
  public:
-  explicit SolanaTxStateManager(PrefService* prefs);
+  SolanaTxStateManager(PrefService* prefs, TxStorage* tx_storage);
   ~SolanaTxStateManager() override;
   SolanaTxStateManager(const SolanaTxStateManager&) = delete;
   SolanaTxStateManager operator=(const SolanaTxStateManager&) = delete;
@@ -9,6 +9,7 @@
 #include <utility>
 #include <vector>
 
+#include "base/files/file_path.h"
 #include "base/test/bind.h"
 #include "base/test/task_environment.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_prefs.h"
@@ -34,13 +35,14 @@ class SolanaTxStateManagerUnitTest : public testing::Test {
   void SetUp() override {
     brave_wallet::RegisterProfilePrefs(prefs_.registry());
     solana_tx_state_manager_ =
-        std::make_unique<SolanaTxStateManager>(GetPrefs());
+        std::make_unique<SolanaTxStateManager>(GetPrefs(), &tx_storage_);
   }
 
   PrefService* GetPrefs() { return &prefs_; }
 
   base::test::TaskEnvironment task_environment_;
   sync_preferences::TestingPrefServiceSyncable prefs_;
+  TxStorage tx_storage_{&prefs_, base::FilePath()};
   std::unique_ptr<SolanaTxStateManager> solana_tx_state_manager_;
 };
 
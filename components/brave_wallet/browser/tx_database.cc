@@ -0,0 +1,194 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_wallet/browser/tx_database.h"
+
+#include <tuple>
+#include <utility>
+
+#include "base/functional/bind.h"
+#include "base/json/json_reader.h"
+#include "base/json/json_writer.h"
+#include "base/logging.h"
+#include "base/strings/string_util.h"
+#include "sql/recovery.h"
+#include "sql/statement.h"
+#include "sql/transaction.h"
+
+namespace brave_wallet {
+
+namespace {
+
+void DatabaseErrorCallback(sql::Database* db,
+                           const base::FilePath& db_path,
+                           int extended_error,
+                           sql::Statement* stmt) {
+  if (sql::Recovery::ShouldRecover(extended_error)) {
+    // Prevent reentrant calls.
+    db->reset_error_callback();
+
+    // After this call, the |db| handle is poisoned so that future calls will
+    // return errors until the handle is re-opened.
+    sql::Recovery::RecoverDatabase(db, db_path);
+
+    // The ignored call signals the test-expectation framework that the error
+    // was handled.
+    std::ignore = sql::Database::IsExpectedSqliteError(extended_error);
+    return;
+  }
+
+  // The default handling is to assert on debug and to ignore on release.
+  if (!sql::Database::IsExpectedSqliteError(extended_error)) {
+    DLOG(FATAL) << db->GetErrorMessage();
+  }
+}
+
+}  // namespace
+
+TxDatabase::TxDatabase(const base::FilePath& db_path)
+    : database_({.exclusive_locking = true, .page_size = 4096}),
+      db_path_(db_path) {
+  DETACH_FROM_SEQUENCE(sequence_checker_);
+}
+
+TxDatabase::~TxDatabase() = default;
+
+absl::optional<base::Value::Dict> TxDatabase::Init(
+    base::Value::Dict txs_to_import) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  database_.set_histogram_tag("BraveWalletTransactions");
+
+  // To recover from corruption.
+  database_.set_error_callback(
+      base::BindRepeating(&DatabaseErrorCallback, &database_, db_path_));
+
+  if (!database_.Open(db_path_) || !MaybeCreateTable()) {
+    return absl::nullopt;
+  }
+  if (!txs_to_import.empty() && !ImportTxs(txs_to_import)) {
+    return absl::nullopt;
+  }
+  return LoadTxs();
+}
+
+bool TxDatabase::SetTx(const std::string& coin,
+                       const std::string& network_id,
+                       const std::string& id,
+                       base::Value::Dict tx) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  std::string value;
+  if (!base::JSONWriter::Write(tx, &value)) {
+    return false;
+  }
+
+  sql::Statement statement(database_.GetCachedStatement(
+      SQL_FROM_HERE,
+      "INSERT OR REPLACE INTO transactions (coin, network_id, id, value) "
+      "VALUES (?,?,?,?)"));
+  statement.BindString(0, coin);
+  statement.BindString(1, network_id);
+  statement.BindString(2, id);
+  statement.BindString(3, value);
+  return statement.Run();
+}
+
+bool TxDatabase::DeleteTx(const std::string& coin,
+                          const std::string& network_id,
+                          const std::string& id) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  sql::Statement statement(database_.GetCachedStatement(
+      SQL_FROM_HERE,
+      "DELETE FROM transactions WHERE coin = ? AND network_id = ? AND id = ?"));
+  statement.BindString(0, coin);
+  statement.BindString(1, network_id);
+  statement.BindString(2, id);
+  return statement.Run();
+}
+
+bool TxDatabase::DeleteTxs(const std::string& coin) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  if (coin.empty()) {
+    return database_.Execute("DELETE FROM transactions");
+  }
+
+  sql::Statement statement(database_.GetCachedStatement(
+      SQL_FROM_HERE, "DELETE FROM transactions WHERE coin = ?"));
+  statement.BindString(0, coin);
+  return statement.Run();
+}
+
+bool TxDatabase::MaybeCreateTable() {
+  if (database_.DoesTableExist("transactions")) {
+    return true;
+  }
+
+  return database_.Execute(
+      "CREATE TABLE transactions (coin TEXT NOT NULL, "
+      "network_id TEXT NOT NULL, id TEXT NOT NULL, value TEXT NOT NULL, "
+      "PRIMARY KEY (coin, network_id, id))");
+}
+
+bool TxDatabase::ImportTxs(const base::Value::Dict& txs) {
+  sql::Transaction transaction(&database_);
+  if (!transaction.Begin()) {
+    return false;
+  }
+
+  // Rows which already exist are newer than the pref, e.g. when an earlier
+  // import was committed but not recorded as done.
+  sql::Statement statement(database_.GetCachedStatement(
+      SQL_FROM_HERE,
+      "INSERT OR IGNORE INTO transactions (coin, network_id, id, value) "
+      "VALUES (?,?,?,?)"));
+  for (const auto [coin, coin_value] : txs) {
+    const base::Value::Dict* coin_dict = coin_value.GetIfDict();
+    if (!coin_dict) {
+      continue;
+    }
+    for (const auto [network_id, network_value] : *coin_dict) {
+      const base::Value::Dict* network_dict = network_value.GetIfDict();
+      if (!network_dict) {
+        continue;
+      }
+      for (const auto [id, tx] : *network_dict) {
+        std::string value;
+        if (!tx.is_dict() || !base::JSONWriter::Write(tx, &value)) {
+          continue;
+        }
+        statement.Reset(/*clear_bound_vars=*/true);
+        statement.BindString(0, coin);
+        statement.BindString(1, network_id);
+        statement.BindString(2, id);
+        statement.BindString(3, value);
+        if (!statement.Run()) {
+          return false;
+        }
+      }
+    }
+  }
+  return transaction.Commit();
+}
+
+base::Value::Dict TxDatabase::LoadTxs() {
+  base::Value::Dict txs;
+  sql::Statement statement(database_.GetUniqueStatement(
+      "SELECT coin, network_id, id, value FROM transactions"));
+  while (statement.Step()) {
+    absl::optional<base::Value> tx =
+        base::JSONReader::Read(statement.ColumnString(3));
+    if (!tx || !tx->is_dict()) {
+      continue;
+    }
+    // Same paths as TxStateManager uses for lookups.
+    txs.SetByDottedPath(
+        base::JoinString({statement.ColumnString(0), statement.ColumnString(1),
+                          statement.ColumnString(2)},
+                         "."),
+        std::move(*tx));
+  }
+  return txs;
+}
+
+}  // namespace brave_wallet
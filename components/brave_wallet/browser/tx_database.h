@@ -0,0 +1,62 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_TX_DATABASE_H_
+#define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_TX_DATABASE_H_
+
+#include <string>
+
+#include "base/files/file_path.h"
+#include "base/sequence_checker.h"
+#include "base/values.h"
+#include "sql/database.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+namespace brave_wallet {
+
+// SQLite storage of the wallet transactions of every coin, one row per
+// transaction so that changing a transaction only writes its row. Blocks on
+// file IO, so it lives on a background sequence, see TxStorage.
+//
+// Transactions are passed around in the layout kBraveWalletTransactions used:
+// a dict of coins ("ethereum", "solana", ...), each a dict of network ids,
+// each a dict of transaction values by transaction id.
+class TxDatabase {
+ public:
+  explicit TxDatabase(const base::FilePath& db_path);
+  ~TxDatabase();
+
+  TxDatabase(const TxDatabase&) = delete;
+  TxDatabase& operator=(const TxDatabase&) = delete;
+
+  // Opens the database, adds the transactions of |txs_to_import| which are
+  // not stored yet, and returns every stored transaction. Returns
+  // absl::nullopt if the database can't be used.
+  absl::optional<base::Value::Dict> Init(base::Value::Dict txs_to_import);
+
+  bool SetTx(const std::string& coin,
+             const std::string& network_id,
+             const std::string& id,
+             base::Value::Dict tx);
+  bool DeleteTx(const std::string& coin,
+                const std::string& network_id,
+                const std::string& id);
+  // Deletes the transactions of |coin|, or of every coin if it is empty.
+  bool DeleteTxs(const std::string& coin);
+
+ private:
+  bool MaybeCreateTable();
+  bool ImportTxs(const base::Value::Dict& txs);
+  base::Value::Dict LoadTxs();
+
+  sql::Database database_;
+  const base::FilePath db_path_;
+
+  SEQUENCE_CHECKER(sequence_checker_);
+};
+
+}  // namespace brave_wallet
+
+#endif  // BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_TX_DATABASE_H_
@@ -131,6 +131,13 @@ void TxManager::OnNewUnapprovedTx(mojom::TransactionInfoPtr tx_info) {
   tx_service_->OnNewUnapprovedTx(tx_info->Clone());
 }
 
+void TxManager::OnTransactionsLoaded() {
+  // Transactions submitted in an earlier session are only known now.
+  if (!keyring_service_->IsLockedSync()) {
+    UpdatePendingTransactions(absl::nullopt);
+  }
+}
+
 void TxManager::Locked() {
   block_tracker_->Stop();
 }
@@ -146,6 +153,7 @@ void TxManager::KeyringReset() {
 void TxManager::Reset() {
   block_tracker_->Stop();
   pending_chain_ids_.clear();
+  tx_state_manager_->Reset();
 }
 
 }  // namespace brave_wallet
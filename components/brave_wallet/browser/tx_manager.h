@@ -108,6 +108,7 @@ class TxManager : public TxStateManager::Observer,
   // TxStateManager::Observer
   void OnTransactionStatusChanged(mojom::TransactionInfoPtr tx_info) override;
   void OnNewUnapprovedTx(mojom::TransactionInfoPtr tx_info) override;
+  void OnTransactionsLoaded() override;
 
   // mojom::KeyringServiceObserverBase:
   void KeyringReset() override;
@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "base/containers/flat_map.h"
+#include "base/files/file_path.h"
 #include "base/memory/raw_ptr.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
 #include "components/keyed_service/core/keyed_service.h"
@@ -27,6 +28,7 @@ class JsonRpcService;
 class BitcoinWalletService;
 class KeyringService;
 class TxManager;
+class TxStorage;
 class EthTxManager;
 class SolanaTxManager;
 class FilTxManager;
@@ -40,7 +42,8 @@ class TxService : public KeyedService,
   TxService(JsonRpcService* json_rpc_service,
             BitcoinWalletService* bitcoin_wallet_service,
             KeyringService* keyring_service,
-            PrefService* prefs);
+            PrefService* prefs,
+            const base::FilePath& wallet_base_directory);
   ~TxService() override;
   TxService(const TxService&) = delete;
   TxService operator=(const TxService&) = delete;
@@ -226,6 +229,8 @@ class TxService : public KeyedService,
 
   raw_ptr<PrefService> prefs_;  // NOT OWNED
   raw_ptr<JsonRpcService> json_rpc_service_ = nullptr;
+  // Outlives the TxManagers, whose TxStateManagers use it.
+  std::unique_ptr<TxStorage> tx_storage_;
   base::flat_map<mojom::CoinType, std::unique_ptr<TxManager>> tx_manager_map_;
   mojo::RemoteSet<mojom::TxServiceObserver> observers_;
   mojo::ReceiverSet<mojom::TxService> tx_service_receivers_;
@@ -8,6 +8,7 @@
 #include <utility>
 
 #include "base/json/values_util.h"
+#include "base/strings/strcat.h"
 #include "base/values.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_constants.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_utils.h"
@@ -107,24 +108,33 @@ bool TxStateManager::ValueToTxMeta(const base::Value::Dict& value,
   return true;
 }
 
-TxStateManager::TxStateManager(PrefService* prefs)
-    : prefs_(prefs), weak_factory_(this) {}
+TxStateManager::TxStateManager(PrefService* prefs, TxStorage* tx_storage)
+    : prefs_(prefs), tx_storage_(tx_storage), weak_factory_(this) {
+  DCHECK(tx_storage_);
+  tx_storage_observation_.Observe(tx_storage_);
+}
 
 TxStateManager::~TxStateManager() = default;
 
-void TxStateManager::AddOrUpdateTx(const TxMeta& meta) {
-  ScopedDictPrefUpdate update(prefs_, kBraveWalletTransactions);
-  base::Value::Dict& dict = update.Get();
-  const std::string path =
-      base::JoinString({GetTxPrefPathPrefix(meta.chain_id()), meta.id()}, ".");
+bool TxStateManager::AddOrUpdateTx(const TxMeta& meta) {
+  // Whether |meta| is new is unknown until the stored transactions are loaded.
+  if (!tx_storage_->IsLoaded()) {
+    return false;
+  }
+
+  const std::string prefix = GetTxPrefPathPrefix(meta.chain_id());
+  const std::string path = base::JoinString({prefix, meta.id()}, ".");
 
-  bool is_add = dict.FindByDottedPath(path) == nullptr;
-  dict.SetByDottedPath(path, meta.ToValue());
+  bool is_add = tx_storage_->txs().FindByDottedPath(path) == nullptr;
+  tx_storage_->SetTx(prefix, meta.id(), meta.ToValue());
+  if (tx_index_) {
+    (*tx_index_)[prefix][meta.id()] = {meta.status(), meta.from()};
+  }
   if (!is_add) {
     for (auto& observer : observers_) {
       observer.OnTransactionStatusChanged(meta.ToTransactionInfo());
     }
-    return;
+    return true;
   }
 
   for (auto& observer : observers_) {
@@ -136,12 +146,16 @@ void TxStateManager::AddOrUpdateTx(const TxMeta& meta) {
                    kMaxConfirmedTxNum);
   RetireTxByStatus(meta.chain_id(), mojom::TransactionStatus::Rejected,
                    kMaxRejectedTxNum);
+  return true;
 }
 
 std::unique_ptr<TxMeta> TxStateManager::GetTx(const std::string& chain_id,
                                               const std::string& id) {
-  const auto& dict = prefs_->GetDict(kBraveWalletTransactions);
-  const base::Value::Dict* value = dict.FindDictByDottedPath(
+  if (!tx_storage_->IsLoaded()) {
+    return nullptr;
+  }
+
+  const base::Value::Dict* value = tx_storage_->txs().FindDictByDottedPath(
       base::JoinString({GetTxPrefPathPrefix(chain_id), id}, "."));
   if (!value) {
     return nullptr;
@@ -152,14 +166,23 @@ std::unique_ptr<TxMeta> TxStateManager::GetTx(const std::string& chain_id,
 
 void TxStateManager::DeleteTx(const std::string& chain_id,
                               const std::string& id) {
-  ScopedDictPrefUpdate update(prefs_, kBraveWalletTransactions);
-  update->RemoveByDottedPath(
-      base::JoinString({GetTxPrefPathPrefix(chain_id), id}, "."));
+  const std::string prefix = GetTxPrefPathPrefix(chain_id);
+  tx_storage_->DeleteTx(prefix, id);
+  if (tx_index_) {
+    const auto iter = tx_index_->find(prefix);
+    if (iter != tx_index_->end()) {
+      iter->second.erase(id);
+    }
+  }
 }
 
 void TxStateManager::WipeTxs() {
-  ScopedDictPrefUpdate update(prefs_, kBraveWalletTransactions);
-  update->RemoveByDottedPath(GetTxPrefPathPrefix(absl::nullopt));
+  tx_storage_->DeleteTxs(GetTxPrefPathPrefix(absl::nullopt));
+  tx_index_.emplace();
+}
+
+void TxStateManager::Reset() {
+  tx_index_.reset();
 }
 
 std::vector<std::unique_ptr<TxMeta>> TxStateManager::GetTransactionsByStatus(
@@ -167,26 +190,19 @@ std::vector<std::unique_ptr<TxMeta>> TxStateManager::GetTransactionsByStatus(
     const absl::optional<mojom::TransactionStatus>& status,
     const absl::optional<std::string>& from) {
   std::vector<std::unique_ptr<TxMeta>> result;
-  const auto& dict = prefs_->GetDict(kBraveWalletTransactions);
+  if (!tx_storage_->IsLoaded()) {
+    return result;
+  }
+
+  const std::string prefix = GetTxPrefPathPrefix(chain_id);
   const base::Value::Dict* network_dict =
-      dict.FindDictByDottedPath(GetTxPrefPathPrefix(chain_id));
+      tx_storage_->txs().FindDictByDottedPath(prefix);
   if (!network_dict) {
     return result;
   }
 
-  for (const auto it : *network_dict) {
-    if (chain_id.has_value()) {
-      std::unique_ptr<TxMeta> meta = ValueToTxMeta(it.second.GetDict());
-      if (!meta) {
-        continue;
-      }
-      if (!status.has_value() || meta->status() == *status) {
-        if (from.has_value() && meta->from() != *from) {
-          continue;
-        }
-        result.push_back(std::move(meta));
-      }
-    } else {
+  if (!chain_id.has_value()) {
+    for (const auto it : *network_dict) {
       auto chain_id_from_pref =
           GetChainIdByNetworkId(prefs_, GetCoinType(), it.first);
       if (!chain_id_from_pref) {
@@ -196,10 +212,81 @@ std::vector<std::unique_ptr<TxMeta>> TxStateManager::GetTransactionsByStatus(
       result.insert(result.end(), std::make_move_iterator(metas.begin()),
                     std::make_move_iterator(metas.end()));
     }
+    return result;
+  }
+
+  // Only the matching transactions are deserialized.
+  const TxIndex& tx_index = GetTxIndex();
+  const auto network_iter = tx_index.find(prefix);
+  if (network_iter == tx_index.end()) {
+    return result;
+  }
+
+  for (const auto& [id, entry] : network_iter->second) {
+    if (status.has_value() && entry.status != *status) {
+      continue;
+    }
+    if (from.has_value() && entry.from != *from) {
+      continue;
+    }
+    const base::Value::Dict* value = network_dict->FindDict(id);
+    if (!value) {
+      continue;
+    }
+    std::unique_ptr<TxMeta> meta = ValueToTxMeta(*value);
+    if (!meta) {
+      continue;
+    }
+    result.push_back(std::move(meta));
   }
   return result;
 }
 
+const TxStateManager::TxIndex& TxStateManager::GetTxIndex() {
+  if (tx_index_) {
+    return *tx_index_;
+  }
+
+  tx_index_.emplace();
+  const std::string coin_prefix = GetTxPrefPathPrefix(absl::nullopt);
+  const base::Value::Dict* coin_dict =
+      tx_storage_->txs().FindDictByDottedPath(coin_prefix);
+  if (!coin_dict) {
+    return *tx_index_;
+  }
+
+  for (const auto [network_id, network_value] : *coin_dict) {
+    const base::Value::Dict* network_dict = network_value.GetIfDict();
+    if (!network_dict) {
+      continue;
+    }
+    auto& network_index =
+        (*tx_index_)[base::StrCat({coin_prefix, ".", network_id})];
+    for (const auto [id, value] : *network_dict) {
+      const base::Value::Dict* tx_dict = value.GetIfDict();
+      if (!tx_dict) {
+        continue;
+      }
+      const absl::optional<int> status = tx_dict->FindInt("status");
+      const std::string* from = tx_dict->FindString("from");
+      // ValueToTxMeta rejects these anyway.
+      if (!status || !from) {
+        continue;
+      }
+      network_index[id] = {static_cast<mojom::TransactionStatus>(*status),
+                           *from};
+    }
+  }
+  return *tx_index_;
+}
+
+void TxStateManager::OnTxStorageLoaded() {
+  tx_index_.reset();
+  for (auto& observer : observers_) {
+    observer.OnTransactionsLoaded();
+  }
+}
+
 void TxStateManager::RetireTxByStatus(const std::string& chain_id,
                                       mojom::TransactionStatus status,
                                       size_t max_num) {
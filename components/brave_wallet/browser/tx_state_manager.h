@@ -6,6 +6,7 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_TX_STATE_MANAGER_H_
 #define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_TX_STATE_MANAGER_H_
 
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -15,6 +16,8 @@
 #include "base/memory/weak_ptr.h"
 #include "base/observer_list.h"
 #include "base/observer_list_types.h"
+#include "base/scoped_observation.h"
+#include "brave/components/brave_wallet/browser/tx_storage.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
 
@@ -28,17 +31,22 @@ namespace brave_wallet {
 
 class TxMeta;
 
-class TxStateManager {
+class TxStateManager : public TxStorage::Observer {
  public:
-  explicit TxStateManager(PrefService* prefs);
-  virtual ~TxStateManager();
+  TxStateManager(PrefService* prefs, TxStorage* tx_storage);
+  ~TxStateManager() override;
   TxStateManager(const TxStateManager&) = delete;
 
-  void AddOrUpdateTx(const TxMeta& meta);
+  // Transactions can't be read or added until the stored ones are loaded,
+  // see TxStorage::IsLoaded. Until then AddOrUpdateTx returns false, GetTx
+  // returns nullptr and GetTransactionsByStatus returns nothing.
+  bool AddOrUpdateTx(const TxMeta& meta);
   std::unique_ptr<TxMeta> GetTx(const std::string& chain_id,
                                 const std::string& id);
   void DeleteTx(const std::string& chain_id, const std::string& id);
   void WipeTxs();
+  // Drops the transaction index after the stored transactions are cleared.
+  void Reset();
 
   static void MigrateAddChainIdToTransactionInfo(PrefService* prefs);
   static void MigrateSolanaTransactionsForV0TransactionsSupport(
@@ -54,6 +62,8 @@ class TxStateManager {
     virtual void OnTransactionStatusChanged(mojom::TransactionInfoPtr tx_info) {
     }
     virtual void OnNewUnapprovedTx(mojom::TransactionInfoPtr tx_info) {}
+    // Called once the stored transactions are loaded, see TxStorage.
+    virtual void OnTransactionsLoaded() {}
   };
 
   void AddObserver(Observer* observer);
@@ -67,6 +77,24 @@ class TxStateManager {
 
  private:
   FRIEND_TEST_ALL_PREFIXES(TxStateManagerUnitTest, TxOperations);
+
+  // Status and sender of a stored transaction, enough to filter transactions
+  // without deserializing them.
+  struct TxIndexEntry {
+    mojom::TransactionStatus status;
+    std::string from;
+  };
+
+  // Transactions keyed by the pref path prefix of their network, see
+  // GetTxPrefPathPrefix, and then by id.
+  using TxIndex = std::map<std::string, std::map<std::string, TxIndexEntry>>;
+
+  // Builds the index from |tx_storage_| on first use.
+  const TxIndex& GetTxIndex();
+
+  // TxStorage::Observer:
+  void OnTxStorageLoaded() override;
+
   void RetireTxByStatus(const std::string& chain_id,
                         mojom::TransactionStatus status,
                         size_t max_num);
@@ -81,7 +109,7 @@ class TxStateManager {
 
   // Each derived class should provide transaction pref path prefix as
   // coin_type.network_id. For example, ethereum.mainnet or solana.testnet.
-  // This will be used to get/set the transaction pref for a specific
+  // This will be used to get/set the transactions in TxStorage for a specific
   // coin_type. When chain_id is not provided, prefix will be just coin_type,
   // ex. ethereum and solana and it will be used to acess all the transactions
   // across different network for the coin.
@@ -90,6 +118,14 @@ class TxStateManager {
 
   base::ObserverList<Observer> observers_;
 
+  raw_ptr<TxStorage> tx_storage_ = nullptr;
+  base::ScopedObservation<TxStorage, TxStorage::Observer>
+      tx_storage_observation_{this};
+
+  // Kept in sync by AddOrUpdateTx, DeleteTx and WipeTxs, and dropped when
+  // the stored transactions are loaded or cleared.
+  absl::optional<TxIndex> tx_index_;
+
   base::WeakPtrFactory<TxStateManager> weak_factory_;
 };
 
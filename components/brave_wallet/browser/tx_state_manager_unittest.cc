@@ -8,6 +8,8 @@
 
 #include "brave/components/brave_wallet/browser/tx_state_manager.h"
 
+#include "base/files/file_path.h"
+#include "base/files/scoped_temp_dir.h"
 #include "base/run_loop.h"
 #include "base/scoped_observation.h"
 #include "base/test/bind.h"
@@ -20,6 +22,7 @@
 #include "brave/components/brave_wallet/browser/eth_tx_meta.h"
 #include "brave/components/brave_wallet/browser/eth_tx_state_manager.h"
 #include "brave/components/brave_wallet/browser/pref_names.h"
+#include "brave/components/brave_wallet/browser/tx_storage.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
 #include "brave/components/brave_wallet/common/test_utils.h"
 #include "brave/components/brave_wallet/common/value_conversion_utils.h"
@@ -60,7 +63,9 @@ class TxStateManagerUnitTest : public testing::Test {
     // The only different between each coin type's tx state manager in these
     // base functions are their pref paths, so here we just use
     // EthTxStateManager to test common methods in TxStateManager.
-    tx_state_manager_ = std::make_unique<EthTxStateManager>(&prefs_);
+    tx_storage_ = std::make_unique<TxStorage>(&prefs_, base::FilePath());
+    tx_state_manager_ =
+        std::make_unique<EthTxStateManager>(&prefs_, tx_storage_.get());
   }
 
   void UpdateCustomNetworks(PrefService* prefs,
@@ -76,21 +81,19 @@ class TxStateManagerUnitTest : public testing::Test {
 
   base::test::TaskEnvironment task_environment_;
   sync_preferences::TestingPrefServiceSyncable prefs_;
+  std::unique_ptr<TxStorage> tx_storage_;
   std::unique_ptr<TxStateManager> tx_state_manager_;
 };
 
 TEST_F(TxStateManagerUnitTest, TxOperations) {
-  prefs_.ClearPref(kBraveWalletTransactions);
-
   EthTxMeta meta;
   meta.set_id("001");
   meta.set_chain_id(mojom::kMainnetChainId);
-  EXPECT_FALSE(prefs_.HasPrefPath(kBraveWalletTransactions));
+  EXPECT_TRUE(tx_storage_->txs().empty());
   // Add
   tx_state_manager_->AddOrUpdateTx(meta);
-  EXPECT_TRUE(prefs_.HasPrefPath(kBraveWalletTransactions));
   {
-    const auto& dict = prefs_.GetDict(kBraveWalletTransactions);
+    const auto& dict = tx_storage_->txs();
     EXPECT_EQ(dict.size(), 1u);
     const auto* ethereum_dict = dict.FindDict("ethereum");
     ASSERT_TRUE(ethereum_dict);
@@ -109,7 +112,7 @@ TEST_F(TxStateManagerUnitTest, TxOperations) {
   // Update
   tx_state_manager_->AddOrUpdateTx(meta);
   {
-    const auto& dict = prefs_.GetDict(kBraveWalletTransactions);
+    const auto& dict = tx_storage_->txs();
     EXPECT_EQ(dict.size(), 1u);
     const auto* ethereum_dict = dict.FindDict("ethereum");
     ASSERT_TRUE(ethereum_dict);
@@ -129,7 +132,7 @@ TEST_F(TxStateManagerUnitTest, TxOperations) {
   // Add another one
   tx_state_manager_->AddOrUpdateTx(meta);
   {
-    const auto& dict = prefs_.GetDict(kBraveWalletTransactions);
+    const auto& dict = tx_storage_->txs();
     EXPECT_EQ(dict.size(), 1u);
     const auto* ethereum_dict = dict.FindDict("ethereum");
     ASSERT_TRUE(ethereum_dict);
@@ -161,7 +164,7 @@ TEST_F(TxStateManagerUnitTest, TxOperations) {
   // Delete
   tx_state_manager_->DeleteTx(mojom::kMainnetChainId, "001");
   {
-    const auto& dict = prefs_.GetDict(kBraveWalletTransactions);
+    const auto& dict = tx_storage_->txs();
     EXPECT_EQ(dict.size(), 1u);
     const auto* ethereum_dict = dict.FindDict("ethereum");
     ASSERT_TRUE(ethereum_dict);
@@ -173,14 +176,10 @@ TEST_F(TxStateManagerUnitTest, TxOperations) {
 
   // Purge
   tx_state_manager_->WipeTxs();
-  EXPECT_TRUE(prefs_.HasPrefPath(kBraveWalletTransactions));
-  EXPECT_FALSE(
-      prefs_.HasPrefPath(std::string(kBraveWalletTransactions) + ".ethereum"));
+  EXPECT_FALSE(tx_storage_->txs().FindDict("ethereum"));
 }
 
 TEST_F(TxStateManagerUnitTest, GetTransactionsByStatus) {
-  prefs_.ClearPref(kBraveWalletTransactions);
-
   std::string addr1 = "0x3535353535353535353535353535353535353535";
   std::string addr2 = "0x2f015c60e0be116b1f0cd534704db9c92118fb6a";
 
@@ -372,8 +371,6 @@ TEST_F(TxStateManagerUnitTest, GetTransactionsByStatus) {
 }
 
 TEST_F(TxStateManagerUnitTest, MultiChainId) {
-  prefs_.ClearPref(kBraveWalletTransactions);
-
   EthTxMeta meta;
   meta.set_id("001");
   meta.set_chain_id(mojom::kMainnetChainId);
@@ -387,7 +384,7 @@ TEST_F(TxStateManagerUnitTest, MultiChainId) {
   meta.set_chain_id(mojom::kLocalhostChainId);
   tx_state_manager_->AddOrUpdateTx(meta);
 
-  const auto& dict = prefs_.GetDict(kBraveWalletTransactions);
+  const auto& dict = tx_storage_->txs();
   EXPECT_EQ(dict.size(), 1u);
   const auto* ethereum_dict = dict.FindDict("ethereum");
   ASSERT_TRUE(ethereum_dict);
@@ -411,8 +408,6 @@ TEST_F(TxStateManagerUnitTest, MultiChainId) {
 }
 
 TEST_F(TxStateManagerUnitTest, RetireOldTxMeta) {
-  prefs_.ClearPref(kBraveWalletTransactions);
-
   for (size_t i = 0; i < 20; ++i) {
     EthTxMeta meta;
     meta.set_id(base::NumberToString(i));
@@ -468,8 +463,130 @@ TEST_F(TxStateManagerUnitTest, RetireOldTxMeta) {
   EXPECT_TRUE(tx_state_manager_->GetTx(mojom::kMainnetChainId, "3"));
 }
 
+TEST_F(TxStateManagerUnitTest, GetTransactionsByStatusAfterTxChanges) {
+  const std::string addr = "0x3535353535353535353535353535353535353535";
+  for (size_t i = 0; i < 100; ++i) {
+    EthTxMeta meta;
+    meta.set_id(base::NumberToString(i));
+    meta.set_chain_id(i % 2 == 0 ? mojom::kMainnetChainId
+                                 : mojom::kGoerliChainId);
+    meta.set_from(i % 10 == 0 ? addr : "0x3333");
+    meta.set_status(i % 20 == 0 ? mojom::TransactionStatus::Submitted
+                                : mojom::TransactionStatus::Approved);
+    tx_state_manager_->AddOrUpdateTx(meta);
+  }
+
+  EXPECT_EQ(tx_state_manager_
+                ->GetTransactionsByStatus(mojom::kMainnetChainId,
+                                          mojom::TransactionStatus::Submitted,
+                                          absl::nullopt)
+                .size(),
+            5u);
+  EXPECT_EQ(tx_state_manager_
+                ->GetTransactionsByStatus(absl::nullopt, absl::nullopt, addr)
+                .size(),
+            10u);
+
+  // Updates and deletes are reflected without reloading the transactions.
+  auto meta = tx_state_manager_->GetTx(mojom::kMainnetChainId, "0");
+  ASSERT_TRUE(meta);
+  meta->set_status(mojom::TransactionStatus::Approved);
+  tx_state_manager_->AddOrUpdateTx(*meta);
+  tx_state_manager_->DeleteTx(mojom::kMainnetChainId, "20");
+  auto submitted_txs = tx_state_manager_->GetTransactionsByStatus(
+      mojom::kMainnetChainId, mojom::TransactionStatus::Submitted, addr);
+  ASSERT_EQ(submitted_txs.size(), 3u);
+  for (const auto& submitted_tx : submitted_txs) {
+    EXPECT_NE(submitted_tx->id(), "0");
+    EXPECT_NE(submitted_tx->id(), "20");
+  }
+
+  tx_state_manager_->WipeTxs();
+  EXPECT_TRUE(tx_state_manager_
+                  ->GetTransactionsByStatus(absl::nullopt, absl::nullopt,
+                                            absl::nullopt)
+                  .empty());
+}
+
+TEST_F(TxStateManagerUnitTest, Reset) {
+  EthTxMeta meta;
+  meta.set_id("001");
+  meta.set_chain_id(mojom::kMainnetChainId);
+  meta.set_status(mojom::TransactionStatus::Submitted);
+  tx_state_manager_->AddOrUpdateTx(meta);
+  ASSERT_EQ(tx_state_manager_
+                ->GetTransactionsByStatus(mojom::kMainnetChainId,
+                                          mojom::TransactionStatus::Submitted,
+                                          absl::nullopt)
+                .size(),
+            1u);
+
+  // As TxService::Reset does.
+  tx_storage_->Clear();
+  tx_state_manager_->Reset();
+  EXPECT_TRUE(tx_state_manager_
+                  ->GetTransactionsByStatus(mojom::kMainnetChainId,
+                                            mojom::TransactionStatus::Submitted,
+                                            absl::nullopt)
+                  .empty());
+
+  // The index is rebuilt from the cleared transactions.
+  meta.set_id("002");
+  tx_state_manager_->AddOrUpdateTx(meta);
+  auto submitted_txs = tx_state_manager_->GetTransactionsByStatus(
+      mojom::kMainnetChainId, mojom::TransactionStatus::Submitted,
+      absl::nullopt);
+  ASSERT_EQ(submitted_txs.size(), 1u);
+  EXPECT_EQ(submitted_txs[0]->id(), "002");
+}
+
+TEST_F(TxStateManagerUnitTest, WaitsForStoredTransactions) {
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  EthTxMeta stored_meta;
+  stored_meta.set_id("001");
+  stored_meta.set_chain_id(mojom::kMainnetChainId);
+  stored_meta.set_status(mojom::TransactionStatus::Submitted);
+  ScopedDictPrefUpdate(&prefs_, kBraveWalletTransactions)
+      ->SetByDottedPath("ethereum.mainnet.001", stored_meta.ToValue());
+  {
+    auto tx_storage = std::make_unique<TxStorage>(
+        &prefs_, temp_dir.GetPath().AppendASCII("transactions.sqlite"));
+    auto tx_state_manager =
+        std::make_unique<EthTxStateManager>(&prefs_, tx_storage.get());
+    MockTxStateManagerObserver observer(tx_state_manager.get());
+    ASSERT_FALSE(tx_storage->IsLoaded());
+
+    // Neither the stored transaction nor whether a transaction is new are
+    // known yet.
+    EthTxMeta meta;
+    meta.set_id("001");
+    meta.set_chain_id(mojom::kMainnetChainId);
+    EXPECT_CALL(observer, OnNewUnapprovedTx(_)).Times(0);
+    EXPECT_FALSE(tx_state_manager->AddOrUpdateTx(meta));
+    EXPECT_FALSE(tx_state_manager->GetTx(mojom::kMainnetChainId, "001"));
+    EXPECT_TRUE(
+        tx_state_manager
+            ->GetTransactionsByStatus(mojom::kMainnetChainId,
+                                      mojom::TransactionStatus::Submitted,
+                                      absl::nullopt)
+            .empty());
+
+    task_environment_.RunUntilIdle();
+    ASSERT_TRUE(tx_storage->IsLoaded());
+    EXPECT_TRUE(tx_state_manager->GetTx(mojom::kMainnetChainId, "001"));
+    EXPECT_EQ(tx_state_manager
+                  ->GetTransactionsByStatus(mojom::kMainnetChainId,
+                                            mojom::TransactionStatus::Submitted,
+                                            absl::nullopt)
+                  .size(),
+              1u);
+  }
+  // Waits for the database to close before its directory is deleted.
+  task_environment_.RunUntilIdle();
+}
+
 TEST_F(TxStateManagerUnitTest, Observer) {
-  prefs_.ClearPref(kBraveWalletTransactions);
   MockTxStateManagerObserver observer(tx_state_manager_.get());
 
   EthTxMeta meta;
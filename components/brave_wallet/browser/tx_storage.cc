@@ -0,0 +1,159 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_wallet/browser/tx_storage.h"
+
+#include <utility>
+
+#include "base/functional/bind.h"
+#include "base/logging.h"
+#include "base/strings/string_util.h"
+#include "base/task/thread_pool.h"
+#include "brave/components/brave_wallet/browser/pref_names.h"
+#include "components/prefs/pref_service.h"
+
+namespace brave_wallet {
+
+namespace {
+
+// Splits "coin.network_id" at the first dot. Network ids may have dots, e.g.
+// the RPC URL of the localhost network.
+std::pair<std::string, std::string> SplitNetworkPath(
+    const std::string& network_path) {
+  const size_t dot = network_path.find('.');
+  DCHECK_NE(dot, std::string::npos) << network_path;
+  return {network_path.substr(0, dot), network_path.substr(dot + 1)};
+}
+
+}  // namespace
+
+TxStorage::TxStorage(PrefService* prefs, const base::FilePath& db_path)
+    : prefs_(prefs) {
+  DCHECK(prefs_);
+  if (db_path.empty()) {
+    loaded_ = true;
+    return;
+  }
+
+  database_ = base::SequenceBound<TxDatabase>(
+      base::ThreadPool::CreateSequencedTaskRunner(
+          {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+           base::TaskShutdownBehavior::BLOCK_SHUTDOWN}),
+      db_path);
+  base::Value::Dict txs_to_import;
+  if (!prefs_->GetBoolean(kBraveWalletTransactionsDBMigrated)) {
+    txs_to_import = prefs_->GetDict(kBraveWalletTransactions).Clone();
+  }
+  database_.AsyncCall(&TxDatabase::Init)
+      .WithArgs(std::move(txs_to_import))
+      .Then(base::BindOnce(&TxStorage::OnLoaded, weak_factory_.GetWeakPtr()));
+}
+
+TxStorage::~TxStorage() = default;
+
+bool TxStorage::IsLoaded() const {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  return loaded_;
+}
+
+const base::Value::Dict& TxStorage::txs() const {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  return txs_;
+}
+
+void TxStorage::SetTx(const std::string& network_path,
+                      const std::string& id,
+                      base::Value::Dict tx) {
+  if (database_) {
+    const auto [coin, network_id] = SplitNetworkPath(network_path);
+    database_.AsyncCall(&TxDatabase::SetTx)
+        .WithArgs(coin, network_id, id, tx.Clone());
+  }
+  ApplyChange(base::BindRepeating(
+      [](const std::string& path, const base::Value::Dict& tx,
+         base::Value::Dict& txs) { txs.SetByDottedPath(path, tx.Clone()); },
+      base::JoinString({network_path, id}, "."), std::move(tx)));
+}
+
+void TxStorage::DeleteTx(const std::string& network_path,
+                         const std::string& id) {
+  if (database_) {
+    const auto [coin, network_id] = SplitNetworkPath(network_path);
+    database_.AsyncCall(&TxDatabase::DeleteTx).WithArgs(coin, network_id, id);
+  }
+  ApplyChange(base::BindRepeating(
+      [](const std::string& path, base::Value::Dict& txs) {
+        txs.RemoveByDottedPath(path);
+      },
+      base::JoinString({network_path, id}, ".")));
+}
+
+void TxStorage::DeleteTxs(const std::string& coin) {
+  DCHECK(!coin.empty());
+  if (database_) {
+    database_.AsyncCall(&TxDatabase::DeleteTxs).WithArgs(coin);
+  }
+  ApplyChange(base::BindRepeating(
+      [](const std::string& coin, base::Value::Dict& txs) { txs.Remove(coin); },
+      coin));
+}
+
+void TxStorage::Clear() {
+  if (database_) {
+    database_.AsyncCall(&TxDatabase::DeleteTxs).WithArgs(std::string());
+  }
+  ApplyChange(
+      base::BindRepeating([](base::Value::Dict& txs) { txs.clear(); }));
+}
+
+void TxStorage::AddObserver(Observer* observer) {
+  observers_.AddObserver(observer);
+}
+
+void TxStorage::RemoveObserver(Observer* observer) {
+  observers_.RemoveObserver(observer);
+}
+
+void TxStorage::ApplyChange(Change change) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  change.Run(txs_);
+  // The database applies it after loading, so the loaded transactions need it
+  // as well.
+  if (!loaded_) {
+    changes_before_load_.push_back(std::move(change));
+  }
+}
+
+void TxStorage::OnLoaded(absl::optional<base::Value::Dict> txs) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  if (txs) {
+    // The pref is only dropped once its transactions are in the database.
+    if (!prefs_->GetBoolean(kBraveWalletTransactionsDBMigrated)) {
+      prefs_->SetBoolean(kBraveWalletTransactionsDBMigrated, true);
+      prefs_->ClearPref(kBraveWalletTransactions);
+    }
+  } else {
+    // Keep going in memory, with the transactions of the pref if they were
+    // never moved.
+    LOG(ERROR) << "Failed to open the wallet transactions database";
+    database_.Reset();
+    txs = prefs_->GetBoolean(kBraveWalletTransactionsDBMigrated)
+              ? base::Value::Dict()
+              : prefs_->GetDict(kBraveWalletTransactions).Clone();
+  }
+
+  for (auto& change : changes_before_load_) {
+    change.Run(*txs);
+  }
+  changes_before_load_.clear();
+  txs_ = std::move(*txs);
+  loaded_ = true;
+
+  for (auto& observer : observers_) {
+    observer.OnTxStorageLoaded();
+  }
+}
+
+}  // namespace brave_wallet
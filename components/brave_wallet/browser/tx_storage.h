@@ -0,0 +1,92 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_TX_STORAGE_H_
+#define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_TX_STORAGE_H_
+
+#include <string>
+#include <vector>
+
+#include "base/files/file_path.h"
+#include "base/functional/callback.h"
+#include "base/memory/raw_ptr.h"
+#include "base/memory/weak_ptr.h"
+#include "base/observer_list.h"
+#include "base/observer_list_types.h"
+#include "base/sequence_checker.h"
+#include "base/threading/sequence_bound.h"
+#include "base/values.h"
+#include "brave/components/brave_wallet/browser/tx_database.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+class PrefService;
+
+namespace brave_wallet {
+
+// Keeps the wallet transactions of every coin in memory and writes each
+// change to a TxDatabase on a background sequence. Shared by the
+// TxStateManagers of a profile.
+//
+// Transactions used to be stored in the kBraveWalletTransactions pref, which
+// is moved to the database once. The in-memory transactions use the layout
+// of that pref, see TxDatabase.
+class TxStorage {
+ public:
+  class Observer : public base::CheckedObserver {
+   public:
+    // Called once the stored transactions are loaded.
+    virtual void OnTxStorageLoaded() {}
+  };
+
+  // Transactions are kept in memory only if |db_path| is empty.
+  TxStorage(PrefService* prefs, const base::FilePath& db_path);
+  ~TxStorage();
+
+  TxStorage(const TxStorage&) = delete;
+  TxStorage& operator=(const TxStorage&) = delete;
+
+  // Until the stored transactions are loaded, txs() only has the changes
+  // made since startup.
+  bool IsLoaded() const;
+  const base::Value::Dict& txs() const;
+
+  // |network_path| is the "coin.network_id" path of the network, see
+  // TxStateManager::GetTxPrefPathPrefix.
+  void SetTx(const std::string& network_path,
+             const std::string& id,
+             base::Value::Dict tx);
+  void DeleteTx(const std::string& network_path, const std::string& id);
+  // Deletes the transactions of |coin|, e.g. "ethereum".
+  void DeleteTxs(const std::string& coin);
+  // Deletes the transactions of every coin.
+  void Clear();
+
+  void AddObserver(Observer* observer);
+  void RemoveObserver(Observer* observer);
+
+ private:
+  using Change = base::RepeatingCallback<void(base::Value::Dict&)>;
+
+  // Applies |change| to txs_, and again to the loaded transactions if they
+  // are not loaded yet.
+  void ApplyChange(Change change);
+  void OnLoaded(absl::optional<base::Value::Dict> txs);
+
+  raw_ptr<PrefService> prefs_ = nullptr;
+  base::SequenceBound<TxDatabase> database_;
+  base::Value::Dict txs_;
+  bool loaded_ = false;
+  // Changes made before the transactions were loaded.
+  std::vector<Change> changes_before_load_;
+  base::ObserverList<Observer> observers_;
+
+  SEQUENCE_CHECKER(sequence_checker_);
+
+  base::WeakPtrFactory<TxStorage> weak_factory_{this};
+};
+
+}  // namespace brave_wallet
+
+#endif  // BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_TX_STORAGE_H_
@@ -0,0 +1,151 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_wallet/browser/tx_storage.h"
+
+#include <memory>
+#include <utility>
+
+#include "base/files/file_path.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/test/task_environment.h"
+#include "base/test/values_test_util.h"
+#include "base/values.h"
+#include "brave/components/brave_wallet/browser/brave_wallet_prefs.h"
+#include "brave/components/brave_wallet/browser/pref_names.h"
+#include "components/sync_preferences/testing_pref_service_syncable.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave_wallet {
+
+class TxStorageUnitTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    RegisterProfilePrefs(prefs_.registry());
+    RegisterProfilePrefsForMigration(prefs_.registry());
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+  }
+
+  // Closes the databases of the tests before their directory is deleted.
+  void TearDown() override { task_environment_.RunUntilIdle(); }
+
+  base::FilePath db_path() const {
+    return temp_dir_.GetPath().AppendASCII("transactions.sqlite");
+  }
+
+  // Opens the database and waits for the stored transactions.
+  std::unique_ptr<TxStorage> LoadTxStorage() {
+    auto tx_storage = std::make_unique<TxStorage>(&prefs_, db_path());
+    task_environment_.RunUntilIdle();
+    EXPECT_TRUE(tx_storage->IsLoaded());
+    return tx_storage;
+  }
+
+  // Waits for the pending database writes of |tx_storage|.
+  void CloseTxStorage(std::unique_ptr<TxStorage> tx_storage) {
+    tx_storage.reset();
+    task_environment_.RunUntilIdle();
+  }
+
+  base::test::TaskEnvironment task_environment_;
+  sync_preferences::TestingPrefServiceSyncable prefs_;
+  base::ScopedTempDir temp_dir_;
+};
+
+TEST_F(TxStorageUnitTest, MemoryOnly) {
+  TxStorage tx_storage(&prefs_, base::FilePath());
+  EXPECT_TRUE(tx_storage.IsLoaded());
+
+  tx_storage.SetTx("ethereum.mainnet", "001",
+                   base::test::ParseJsonDict(R"({"id": "001"})"));
+  EXPECT_TRUE(tx_storage.txs().FindDictByDottedPath("ethereum.mainnet.001"));
+  tx_storage.DeleteTx("ethereum.mainnet", "001");
+  EXPECT_FALSE(tx_storage.txs().FindDictByDottedPath("ethereum.mainnet.001"));
+  EXPECT_FALSE(prefs_.HasPrefPath(kBraveWalletTransactions));
+}
+
+TEST_F(TxStorageUnitTest, MigrateFromPref) {
+  prefs_.SetDict(kBraveWalletTransactions, base::test::ParseJsonDict(R"({
+    "ethereum": {
+      "mainnet": {"001": {"id": "001"}, "002": {"id": "002"}},
+      "http://localhost:7545/": {"003": {"id": "003"}}
+    },
+    "solana": {"devnet": {"004": {"id": "004"}}}
+  })"));
+  const base::Value::Dict expected_txs =
+      prefs_.GetDict(kBraveWalletTransactions).Clone();
+
+  auto tx_storage = LoadTxStorage();
+  EXPECT_EQ(tx_storage->txs(), expected_txs);
+  EXPECT_TRUE(prefs_.GetBoolean(kBraveWalletTransactionsDBMigrated));
+  EXPECT_FALSE(prefs_.HasPrefPath(kBraveWalletTransactions));
+  CloseTxStorage(std::move(tx_storage));
+
+  // Transactions stay in the database without the pref.
+  EXPECT_EQ(LoadTxStorage()->txs(), expected_txs);
+}
+
+TEST_F(TxStorageUnitTest, MigratesOnce) {
+  CloseTxStorage(LoadTxStorage());
+  ASSERT_TRUE(prefs_.GetBoolean(kBraveWalletTransactionsDBMigrated));
+
+  prefs_.SetDict(
+      kBraveWalletTransactions,
+      base::test::ParseJsonDict(R"({"ethereum": {"mainnet": {"001": {}}}})"));
+  EXPECT_TRUE(LoadTxStorage()->txs().empty());
+}
+
+TEST_F(TxStorageUnitTest, WritesEachChange) {
+  auto tx_storage = LoadTxStorage();
+  tx_storage->SetTx("ethereum.mainnet", "001",
+                    base::test::ParseJsonDict(R"({"id": "001"})"));
+  tx_storage->SetTx("ethereum.mainnet", "002",
+                    base::test::ParseJsonDict(R"({"id": "002"})"));
+  tx_storage->SetTx("ethereum.mainnet", "001",
+                    base::test::ParseJsonDict(R"({"id": "001", "a": 1})"));
+  tx_storage->SetTx("solana.mainnet", "003",
+                    base::test::ParseJsonDict(R"({"id": "003"})"));
+  tx_storage->DeleteTx("ethereum.mainnet", "002");
+  const base::Value::Dict expected_txs = tx_storage->txs().Clone();
+  CloseTxStorage(std::move(tx_storage));
+
+  tx_storage = LoadTxStorage();
+  EXPECT_EQ(tx_storage->txs(), base::test::ParseJsonDict(R"({
+    "ethereum": {"mainnet": {"001": {"id": "001", "a": 1}}},
+    "solana": {"mainnet": {"003": {"id": "003"}}}
+  })"));
+  EXPECT_EQ(tx_storage->txs(), expected_txs);
+
+  tx_storage->DeleteTxs("ethereum");
+  CloseTxStorage(std::move(tx_storage));
+  tx_storage = LoadTxStorage();
+  EXPECT_EQ(tx_storage->txs(), base::test::ParseJsonDict(R"({
+    "solana": {"mainnet": {"003": {"id": "003"}}}
+  })"));
+
+  tx_storage->Clear();
+  CloseTxStorage(std::move(tx_storage));
+  EXPECT_TRUE(LoadTxStorage()->txs().empty());
+}
+
+TEST_F(TxStorageUnitTest, ChangesBeforeLoad) {
+  prefs_.SetDict(kBraveWalletTransactions, base::test::ParseJsonDict(R"({
+    "ethereum": {"mainnet": {"001": {"id": "001"}, "002": {"id": "002"}}}
+  })"));
+
+  TxStorage tx_storage(&prefs_, db_path());
+  EXPECT_FALSE(tx_storage.IsLoaded());
+  tx_storage.SetTx("ethereum.mainnet", "003",
+                   base::test::ParseJsonDict(R"({"id": "003"})"));
+  tx_storage.DeleteTx("ethereum.mainnet", "001");
+  task_environment_.RunUntilIdle();
+
+  ASSERT_TRUE(tx_storage.IsLoaded());
+  EXPECT_EQ(tx_storage.txs(), base::test::ParseJsonDict(R"({
+    "ethereum": {"mainnet": {"002": {"id": "002"}, "003": {"id": "003"}}}
+  })"));
+}
+
+}  // namespace brave_wallet
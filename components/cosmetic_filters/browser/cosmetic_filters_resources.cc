@@ -7,15 +7,31 @@
 
 #include <utility>
 
-#include "base/json/json_reader.h"
 #include "base/values.h"
 #include "brave/components/brave_shields/browser/ad_block_service.h"
-#include "brave/components/brave_shields/browser/brave_shields_util.h"
-#include "components/content_settings/core/browser/host_content_settings_map.h"
-#include "third_party/abseil-cpp/absl/types/optional.h"
 
 namespace cosmetic_filters {
 
+namespace {
+
+// Moves the string items of |list| out into a plain vector. Anything else
+// is skipped.
+std::vector<std::string> TakeStrings(base::Value::List* list) {
+  std::vector<std::string> strings;
+  if (!list) {
+    return strings;
+  }
+  strings.reserve(list->size());
+  for (auto& item : *list) {
+    if (item.is_string()) {
+      strings.push_back(std::move(item).TakeString());
+    }
+  }
+  return strings;
+}
+
+}  // namespace
+
 CosmeticFiltersResources::CosmeticFiltersResources(
     brave_shields::AdBlockService* ad_block_service)
     : ad_block_service_(ad_block_service) {}
@@ -23,47 +39,19 @@ CosmeticFiltersResources::CosmeticFiltersResources(
 CosmeticFiltersResources::~CosmeticFiltersResources() = default;
 
 void CosmeticFiltersResources::HiddenClassIdSelectors(
-    const std::string& input,
+    const std::vector<std::string>& classes,
+    const std::vector<std::string>& ids,
     const std::vector<std::string>& exceptions,
     HiddenClassIdSelectorsCallback callback) {
   DCHECK(ad_block_service_->GetTaskRunner()->RunsTasksInCurrentSequence());
-  absl::optional<base::Value> input_value = base::JSONReader::Read(input);
-  if (!input_value) {
-    // Nothing to work with
-    std::move(callback).Run(base::Value::Dict());
-
-    return;
-  }
-  base::Value::Dict* input_dict = input_value->GetIfDict();
-  if (!input_dict) {
-    std::move(callback).Run(base::Value::Dict());
-    return;
-  }
-  std::vector<std::string> classes;
-  base::Value::List* classes_list = input_dict->FindList("classes");
-  if (classes_list) {
-    for (const auto& class_item : *classes_list) {
-      if (!class_item.is_string()) {
-        continue;
-      }
-      classes.push_back(class_item.GetString());
-    }
-  }
-  std::vector<std::string> ids;
-  base::Value::List* ids_list = input_dict->FindList("ids");
-  if (ids_list) {
-    for (const auto& id_item : *ids_list) {
-      if (!id_item.is_string()) {
-        continue;
-      }
-      ids.push_back(id_item.GetString());
-    }
-  }
-
   auto selectors =
       ad_block_service_->HiddenClassIdSelectors(classes, ids, exceptions);
 
-  std::move(callback).Run(std::move(selectors));
+  auto result = mojom::HiddenClassIdSelectorsResult::New();
+  result->hide_selectors = TakeStrings(selectors.FindList("hide_selectors"));
+  result->force_hide_selectors =
+      TakeStrings(selectors.FindList("force_hide_selectors"));
+  std::move(callback).Run(std::move(result));
 }
 
 void CosmeticFiltersResources::UrlCosmeticResources(
@@ -73,7 +61,23 @@ void CosmeticFiltersResources::UrlCosmeticResources(
   DCHECK(ad_block_service_->GetTaskRunner()->RunsTasksInCurrentSequence());
   auto resources =
       ad_block_service_->UrlCosmeticResources(url, aggressive_blocking);
-  std::move(callback).Run(base::Value(std::move(resources)));
+
+  auto result = mojom::UrlCosmeticResourcesResult::New();
+  result->hide_selectors = TakeStrings(resources.FindList("hide_selectors"));
+  result->force_hide_selectors =
+      TakeStrings(resources.FindList("force_hide_selectors"));
+  result->exceptions = TakeStrings(resources.FindList("exceptions"));
+  if (auto* style_selectors = resources.FindDict("style_selectors")) {
+    for (auto [selector, styles] : *style_selectors) {
+      result->style_selectors.emplace(selector,
+                                      TakeStrings(styles.GetIfList()));
+    }
+  }
+  if (auto* injected_script = resources.FindString("injected_script")) {
+    result->injected_script = std::move(*injected_script);
+  }
+  result->generichide = resources.FindBool("generichide").value_or(false);
+  std::move(callback).Run(std::move(result));
 }
 
 }  // namespace cosmetic_filters
@@ -0,0 +1,57 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/cosmetic_filters/renderer/class_id_selectors_query_queue.h"
+
+#include <utility>
+
+#include "base/check.h"
+
+namespace cosmetic_filters {
+
+ClassIdSelectorsQueryQueue::Query::Query() = default;
+ClassIdSelectorsQueryQueue::Query::Query(Query&&) = default;
+ClassIdSelectorsQueryQueue::Query&
+ClassIdSelectorsQueryQueue::Query::operator=(Query&&) = default;
+ClassIdSelectorsQueryQueue::Query::~Query() = default;
+
+ClassIdSelectorsQueryQueue::ClassIdSelectorsQueryQueue() = default;
+
+ClassIdSelectorsQueryQueue::~ClassIdSelectorsQueryQueue() = default;
+
+void ClassIdSelectorsQueryQueue::Add(const std::vector<std::string>& classes,
+                                     const std::vector<std::string>& ids,
+                                     base::TimeTicks mutation_time) {
+  if (classes.empty() && ids.empty())
+    return;
+  pending_.classes.insert(pending_.classes.end(), classes.begin(),
+                          classes.end());
+  pending_.ids.insert(pending_.ids.end(), ids.begin(), ids.end());
+  if (!mutation_time.is_null() && (pending_.mutation_time.is_null() ||
+                                   mutation_time < pending_.mutation_time)) {
+    pending_.mutation_time = mutation_time;
+  }
+}
+
+bool ClassIdSelectorsQueryQueue::CanSend() const {
+  return !query_in_flight_ &&
+         (!pending_.classes.empty() || !pending_.ids.empty());
+}
+
+ClassIdSelectorsQueryQueue::Query ClassIdSelectorsQueryQueue::TakeQuery() {
+  DCHECK(CanSend());
+  query_in_flight_ = true;
+  return std::exchange(pending_, Query());
+}
+
+void ClassIdSelectorsQueryQueue::OnQueryFinished() {
+  query_in_flight_ = false;
+}
+
+void ClassIdSelectorsQueryQueue::ClearPending() {
+  pending_ = Query();
+}
+
+}  // namespace cosmetic_filters
@@ -0,0 +1,63 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_COSMETIC_FILTERS_RENDERER_CLASS_ID_SELECTORS_QUERY_QUEUE_H_
+#define BRAVE_COMPONENTS_COSMETIC_FILTERS_RENDERER_CLASS_ID_SELECTORS_QUERY_QUEUE_H_
+
+#include <string>
+#include <vector>
+
+#include "base/time/time.h"
+
+namespace cosmetic_filters {
+
+// Coalesces the classes and ids a frame asks hidden selectors for, so that at
+// most one query is in flight at a time. Everything added while waiting for
+// a reply is sent together once it arrives.
+class ClassIdSelectorsQueryQueue {
+ public:
+  struct Query {
+    Query();
+    Query(Query&&);
+    Query& operator=(Query&&);
+    ~Query();
+
+    std::vector<std::string> classes;
+    std::vector<std::string> ids;
+    // When the oldest mutation which added them happened, or null if none of
+    // them came from a mutation.
+    base::TimeTicks mutation_time;
+  };
+
+  ClassIdSelectorsQueryQueue();
+  ClassIdSelectorsQueryQueue(const ClassIdSelectorsQueryQueue&) = delete;
+  ClassIdSelectorsQueryQueue& operator=(const ClassIdSelectorsQueryQueue&) =
+      delete;
+  ~ClassIdSelectorsQueryQueue();
+
+  // |mutation_time| is null if the names didn't come from a mutation.
+  void Add(const std::vector<std::string>& classes,
+           const std::vector<std::string>& ids,
+           base::TimeTicks mutation_time);
+
+  // Whether there is something to send and no query in flight.
+  bool CanSend() const;
+  // Returns the pending names and marks a query as in flight.
+  Query TakeQuery();
+  // Called once the in-flight query is answered or dropped.
+  void OnQueryFinished();
+
+  // Drops the pending names, e.g. when the frame navigates. An in-flight
+  // query still has to finish.
+  void ClearPending();
+
+ private:
+  Query pending_;
+  bool query_in_flight_ = false;
+};
+
+}  // namespace cosmetic_filters
+
+#endif  // BRAVE_COMPONENTS_COSMETIC_FILTERS_RENDERER_CLASS_ID_SELECTORS_QUERY_QUEUE_H_
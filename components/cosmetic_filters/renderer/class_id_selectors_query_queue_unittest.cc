@@ -0,0 +1,73 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/cosmetic_filters/renderer/class_id_selectors_query_queue.h"
+
+#include "testing/gmock/include/gmock/gmock.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+using testing::ElementsAre;
+using testing::IsEmpty;
+
+namespace cosmetic_filters {
+
+TEST(ClassIdSelectorsQueryQueueTest, SendsRightAway) {
+  ClassIdSelectorsQueryQueue queue;
+  EXPECT_FALSE(queue.CanSend());
+
+  queue.Add({}, {}, base::TimeTicks());
+  EXPECT_FALSE(queue.CanSend());
+
+  queue.Add({"ad"}, {"banner"}, base::TimeTicks());
+  ASSERT_TRUE(queue.CanSend());
+  ClassIdSelectorsQueryQueue::Query query = queue.TakeQuery();
+  EXPECT_THAT(query.classes, ElementsAre("ad"));
+  EXPECT_THAT(query.ids, ElementsAre("banner"));
+  EXPECT_TRUE(query.mutation_time.is_null());
+  EXPECT_FALSE(queue.CanSend());
+}
+
+TEST(ClassIdSelectorsQueryQueueTest, CoalescesWhileQueryInFlight) {
+  const base::TimeTicks now = base::TimeTicks::Now();
+  ClassIdSelectorsQueryQueue queue;
+  queue.Add({"a"}, {}, now);
+  queue.TakeQuery();
+
+  queue.Add({"b"}, {}, now - base::Milliseconds(5));
+  queue.Add({}, {"c"}, base::TimeTicks());
+  queue.Add({"d"}, {"e"}, now - base::Milliseconds(10));
+  queue.Add({"f"}, {}, now);
+  EXPECT_FALSE(queue.CanSend());
+
+  queue.OnQueryFinished();
+  ASSERT_TRUE(queue.CanSend());
+  ClassIdSelectorsQueryQueue::Query query = queue.TakeQuery();
+  EXPECT_THAT(query.classes, ElementsAre("b", "d", "f"));
+  EXPECT_THAT(query.ids, ElementsAre("c", "e"));
+  // Timed from the oldest mutation of the batch.
+  EXPECT_EQ(now - base::Milliseconds(10), query.mutation_time);
+
+  queue.OnQueryFinished();
+  EXPECT_FALSE(queue.CanSend());
+}
+
+TEST(ClassIdSelectorsQueryQueueTest, ClearPending) {
+  ClassIdSelectorsQueryQueue queue;
+  queue.Add({"a"}, {}, base::TimeTicks());
+  queue.TakeQuery();
+  queue.Add({"b"}, {}, base::TimeTicks::Now());
+
+  queue.ClearPending();
+  queue.OnQueryFinished();
+  EXPECT_FALSE(queue.CanSend());
+
+  queue.Add({"c"}, {}, base::TimeTicks());
+  ClassIdSelectorsQueryQueue::Query query = queue.TakeQuery();
+  EXPECT_THAT(query.classes, ElementsAre("c"));
+  EXPECT_THAT(query.ids, IsEmpty());
+  EXPECT_TRUE(query.mutation_time.is_null());
+}
+
+}  // namespace cosmetic_filters
@@ -9,11 +9,12 @@
 
 #include "base/feature_list.h"
 #include "base/functional/bind.h"
-#include "base/json/json_writer.h"
+#include "base/json/string_escape.h"
 #include "base/metrics/histogram_macros.h"
 #include "base/no_destructor.h"
 #include "base/strings/stringprintf.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/time/time.h"
 #include "base/trace_event/trace_event.h"
 #include "brave/components/brave_shields/common/features.h"
 #include "brave/components/content_settings/renderer/brave_content_settings_agent_impl.h"
@@ -142,6 +143,26 @@ bool IsVettedSearchEngine(const GURL& url) {
   return false;
 }
 
+// Formats |selectors| as a JS array literal, for kHideSelectorsInjectScript.
+std::string SelectorsToJSArray(const std::vector<std::string>& selectors) {
+  std::string result = "[";
+  for (size_t i = 0; i < selectors.size(); ++i) {
+    if (i != 0)
+      result += ',';
+    base::EscapeJSONString(selectors[i], /*put_in_quotes=*/true, &result);
+  }
+  result += ']';
+  return result;
+}
+
+std::string SelectorsToStylesheet(const std::vector<std::string>& selectors) {
+  std::string stylesheet;
+  for (const auto& selector : selectors) {
+    stylesheet += selector + "{display:none !important}";
+  }
+  return stylesheet;
+}
+
 // ID is used in TRACE_ID_WITH_SCOPE(). Must be unique accoss the process.
 int MakeUniquePerfId() {
   static int counter = 0;
@@ -160,6 +181,8 @@ namespace cosmetic_filters {
 // brave://tracing & brave://histograms.
 class CosmeticFilterPerfTracker {
  public:
+  ~CosmeticFilterPerfTracker() { RecordClassIdSelectorsQueries(); }
+
   int OnHandleMutationsBegin() {
     const auto event_id = MakeUniquePerfId();
     TRACE_EVENT_NESTABLE_ASYNC_BEGIN0(
@@ -187,6 +210,68 @@ class CosmeticFilterPerfTracker {
         TRACE_CATEGORY, "QuerySelectors",
         TRACE_ID_WITH_SCOPE("QuerySelectors", event_id));
   }
+
+  // Starts measuring the time until the first selectors of a new document are
+  // hidden.
+  void OnProcessURL() {
+    RecordClassIdSelectorsQueries();
+    process_url_time_ = base::TimeTicks::Now();
+    first_hide_recorded_ = false;
+  }
+
+  void OnClassIdSelectorsQuerySent(size_t classes_and_ids) {
+    ++class_id_selectors_queries_;
+    UMA_HISTOGRAM_COUNTS_1000("Brave.CosmeticFilters.ClassIdSelectorsBatchSize",
+                              classes_and_ids);
+  }
+
+  // |mutation_time| is when the oldest mutation which added a class or id of
+  // the query happened, or null if none of them came from a mutation.
+  void OnClassIdSelectorsApplied(base::TimeTicks mutation_time) {
+    if (mutation_time.is_null())
+      return;
+    const base::TimeTicks now = base::TimeTicks::Now();
+    UMA_HISTOGRAM_TIMES("Brave.CosmeticFilters.MutationToHide",
+                        now - mutation_time);
+    const auto event_id = MakeUniquePerfId();
+    TRACE_EVENT_NESTABLE_ASYNC_BEGIN_WITH_TIMESTAMP0(
+        TRACE_CATEGORY, "MutationToHide",
+        TRACE_ID_WITH_SCOPE("MutationToHide", event_id), mutation_time);
+    TRACE_EVENT_NESTABLE_ASYNC_END_WITH_TIMESTAMP0(
+        TRACE_CATEGORY, "MutationToHide",
+        TRACE_ID_WITH_SCOPE("MutationToHide", event_id), now);
+  }
+
+  void OnSelectorsHidden() {
+    if (first_hide_recorded_ || process_url_time_.is_null())
+      return;
+    first_hide_recorded_ = true;
+
+    const base::TimeTicks now = base::TimeTicks::Now();
+    UMA_HISTOGRAM_TIMES("Brave.CosmeticFilters.TimeToFirstHide",
+                        now - process_url_time_);
+    const auto event_id = MakeUniquePerfId();
+    TRACE_EVENT_NESTABLE_ASYNC_BEGIN_WITH_TIMESTAMP0(
+        TRACE_CATEGORY, "TimeToFirstHide",
+        TRACE_ID_WITH_SCOPE("TimeToFirstHide", event_id), process_url_time_);
+    TRACE_EVENT_NESTABLE_ASYNC_END_WITH_TIMESTAMP0(
+        TRACE_CATEGORY, "TimeToFirstHide",
+        TRACE_ID_WITH_SCOPE("TimeToFirstHide", event_id), now);
+  }
+
+ private:
+  // Records how many HiddenClassIdSelectors IPCs the previous document sent.
+  void RecordClassIdSelectorsQueries() {
+    if (process_url_time_.is_null())
+      return;
+    UMA_HISTOGRAM_COUNTS_10000("Brave.CosmeticFilters.ClassIdSelectorsQueries",
+                               class_id_selectors_queries_);
+    class_id_selectors_queries_ = 0;
+  }
+
+  base::TimeTicks process_url_time_;
+  bool first_hide_recorded_ = false;
+  int class_id_selectors_queries_ = 0;
 };
 
 CosmeticFiltersJSHandler::CosmeticFiltersJSHandler(
@@ -207,14 +292,34 @@ CosmeticFiltersJSHandler::CosmeticFiltersJSHandler(
 CosmeticFiltersJSHandler::~CosmeticFiltersJSHandler() = default;
 
 void CosmeticFiltersJSHandler::HiddenClassIdSelectors(
-    const std::string& input) {
+    const std::vector<std::string>& classes,
+    const std::vector<std::string>& ids,
+    double ms_since_mutation) {
+  base::TimeTicks mutation_time;
+  if (ms_since_mutation >= 0) {
+    mutation_time =
+        base::TimeTicks::Now() - base::Milliseconds(ms_since_mutation);
+  }
+  class_id_queries_.Add(classes, ids, mutation_time);
+
+  if (class_id_queries_.CanSend())
+    SendPendingClassIdSelectorsQuery();
+}
+
+void CosmeticFiltersJSHandler::SendPendingClassIdSelectorsQuery() {
   if (!EnsureConnected())
     return;
 
+  ClassIdSelectorsQueryQueue::Query query = class_id_queries_.TakeQuery();
+  if (perf_tracker_) {
+    perf_tracker_->OnClassIdSelectorsQuerySent(query.classes.size() +
+                                               query.ids.size());
+  }
+
   cosmetic_filters_resources_->HiddenClassIdSelectors(
-      input, exceptions_,
+      query.classes, query.ids, exceptions_,
       base::BindOnce(&CosmeticFiltersJSHandler::OnHiddenClassIdSelectors,
-                     base::Unretained(this)));
+                     base::Unretained(this), query.mutation_time));
 }
 
 bool CosmeticFiltersJSHandler::OnIsFirstParty(const std::string& url_string) {
@@ -251,6 +356,24 @@ void CosmeticFiltersJSHandler::InjectStylesheet(const std::string& stylesheet) {
       blink::WebString::FromUTF8(stylesheet);
   web_frame->GetDocument().InsertStyleSheet(
       stylesheet_webstring, style_sheet_key, blink::WebCssOrigin::kUser);
+  if (perf_tracker_)
+    perf_tracker_->OnSelectorsHidden();
+}
+
+void CosmeticFiltersJSHandler::InjectHideSelectors(
+    const std::vector<std::string>& selectors) {
+  if (selectors.empty())
+    return;
+
+  // Building a script for stylesheet modifications
+  std::string new_selectors_script = base::StringPrintf(
+      kHideSelectorsInjectScript, SelectorsToJSArray(selectors).c_str());
+  render_frame_->GetWebFrame()->ExecuteScriptInIsolatedWorld(
+      isolated_world_id_,
+      blink::WebScriptSource(blink::WebString::FromUTF8(new_selectors_script)),
+      blink::BackForwardCacheAware::kAllow);
+  if (perf_tracker_)
+    perf_tracker_->OnSelectorsHidden();
 }
 
 void CosmeticFiltersJSHandler::CreateWorkerObject(
@@ -332,6 +455,8 @@ bool CosmeticFiltersJSHandler::EnsureConnected() {
 }
 
 void CosmeticFiltersJSHandler::OnRemoteDisconnect() {
+  // Pending replies are dropped along with the pipe.
+  class_id_queries_.OnQueryFinished();
   cosmetic_filters_resources_.reset();
   EnsureConnected();
 }
@@ -339,7 +464,8 @@ void CosmeticFiltersJSHandler::OnRemoteDisconnect() {
 bool CosmeticFiltersJSHandler::ProcessURL(
     const GURL& url,
     absl::optional<base::OnceClosure> callback) {
-  resources_dict_ = absl::nullopt;
+  resources_.reset();
+  class_id_queries_.ClearPending();
   url_ = url;
   enabled_1st_party_cf_ = false;
 
@@ -358,6 +484,9 @@ bool CosmeticFiltersJSHandler::ProcessURL(
     return false;
   }
 
+  if (perf_tracker_)
+    perf_tracker_->OnProcessURL();
+
   enabled_1st_party_cf_ =
       force_cosmetic_filtering ||
       render_frame_->GetWebFrame()->IsCrossOriginToOutermostMainFrame() ||
@@ -376,13 +505,8 @@ bool CosmeticFiltersJSHandler::ProcessURL(
                  url_.spec());
     SCOPED_UMA_HISTOGRAM_TIMER_MICROS(
         "Brave.CosmeticFilters.UrlCosmeticResourcesSync");
-    base::Value result;
     cosmetic_filters_resources_->UrlCosmeticResources(
-        url_.spec(), enabled_1st_party_cf_, &result);
-
-    auto* dict = result.GetIfDict();
-    if (dict)
-      resources_dict_ = std::move(*dict);
+        url_.spec(), enabled_1st_party_cf_, &resources_);
   }
 
   return true;
@@ -390,42 +514,33 @@ bool CosmeticFiltersJSHandler::ProcessURL(
 
 void CosmeticFiltersJSHandler::OnUrlCosmeticResources(
     base::OnceClosure callback,
-    base::Value result) {
+    mojom::UrlCosmeticResourcesResultPtr result) {
   if (!EnsureConnected())
     return;
 
-  auto* dict = result.GetIfDict();
-  if (dict)
-    resources_dict_ = std::move(*dict);
+  resources_ = std::move(result);
 
   std::move(callback).Run();
 }
 
 void CosmeticFiltersJSHandler::ApplyRules(bool de_amp_enabled) {
   blink::WebLocalFrame* web_frame = render_frame_->GetWebFrame();
-  if (!resources_dict_ || web_frame->IsProvisional())
+  if (!resources_ || web_frame->IsProvisional())
     return;
 
   SCOPED_UMA_HISTOGRAM_TIMER_MICROS("Brave.CosmeticFilters.ApplyRules");
   TRACE_EVENT1("brave.adblock", "ApplyRules", "url", url_.spec());
 
-  std::string scriptlet_script;
-  base::Value* injected_script = resources_dict_->Find("injected_script");
-  if (injected_script &&
-      base::JSONWriter::Write(*injected_script, &scriptlet_script)) {
-    scriptlet_script = base::StringPrintf(kScriptletInitScript,
-                                          de_amp_enabled ? "true" : "false",
-                                          scriptlet_script.c_str());
-  }
-  if (!scriptlet_script.empty()) {
-    web_frame->ExecuteScriptInIsolatedWorld(
-        isolated_world_id_,
-        blink::WebScriptSource(blink::WebString::FromUTF8(scriptlet_script)),
-        blink::BackForwardCacheAware::kAllow);
-  }
+  const std::string scriptlet_script = base::StringPrintf(
+      kScriptletInitScript, de_amp_enabled ? "true" : "false",
+      base::GetQuotedJSONString(resources_->injected_script).c_str());
+  web_frame->ExecuteScriptInIsolatedWorld(
+      isolated_world_id_,
+      blink::WebScriptSource(blink::WebString::FromUTF8(scriptlet_script)),
+      blink::BackForwardCacheAware::kAllow);
 
   // Working on css rules
-  generichide_ = resources_dict_->FindBool("generichide").value_or(false);
+  generichide_ = resources_->generichide;
   namespace bf = brave_shields::features;
   std::string cosmetic_filtering_init_script = base::StringPrintf(
       kCosmeticFilteringInitScript, enabled_1st_party_cf_ ? "true" : "false",
@@ -445,79 +560,39 @@ void CosmeticFiltersJSHandler::ApplyRules(bool de_amp_enabled) {
       blink::BackForwardCacheAware::kAllow);
   ExecuteObservingBundleEntryPoint();
 
-  CSSRulesRoutine(*resources_dict_);
+  CSSRulesRoutine(*resources_);
 }
 
 void CosmeticFiltersJSHandler::CSSRulesRoutine(
-    const base::Value::Dict& resources_dict) {
+    const mojom::UrlCosmeticResourcesResult& resources) {
   SCOPED_UMA_HISTOGRAM_TIMER_MICROS("Brave.CosmeticFilters.CSSRulesRoutine");
   TRACE_EVENT1("brave.adblock", "CSSRulesRoutine", "url", url_.spec());
 
-  blink::WebLocalFrame* web_frame = render_frame_->GetWebFrame();
-  const auto* cf_exceptions_list = resources_dict.FindList("exceptions");
-  if (cf_exceptions_list) {
-    for (const auto& item : *cf_exceptions_list) {
-      DCHECK(item.is_string());
-      exceptions_.push_back(item.GetString());
-    }
-  }
-  // If its a vetted engine AND we're not in aggressive mode, don't apply
-  // cosmetic filtering from the default engine.
-  const auto* hide_selectors_list =
-      (IsVettedSearchEngine(url_) && !enabled_1st_party_cf_)
-          ? nullptr
-          : resources_dict.FindList("hide_selectors");
+  exceptions_.insert(exceptions_.end(), resources.exceptions.begin(),
+                     resources.exceptions.end());
 
   std::string stylesheet = "";
 
-  if (hide_selectors_list && !hide_selectors_list->empty()) {
+  // If its a vetted engine AND we're not in aggressive mode, don't apply
+  // cosmetic filtering from the default engine.
+  if (enabled_1st_party_cf_ || !IsVettedSearchEngine(url_)) {
     // treat `hide_selectors` the same as `force_hide_selectors` if aggressive
     // mode is enabled.
     if (enabled_1st_party_cf_) {
-      for (auto& selector : *hide_selectors_list) {
-        DCHECK(selector.is_string());
-        stylesheet += selector.GetString() + "{display:none !important}";
-      }
+      stylesheet += SelectorsToStylesheet(resources.hide_selectors);
     } else {
-      std::string json_selectors;
-      base::JSONWriter::Write(*hide_selectors_list, &json_selectors);
-      if (json_selectors.empty()) {
-        json_selectors = "[]";
-      }
-      // Building a script for stylesheet modifications
-      std::string new_selectors_script = base::StringPrintf(
-          kHideSelectorsInjectScript, json_selectors.c_str());
-      web_frame->ExecuteScriptInIsolatedWorld(
-          isolated_world_id_,
-          blink::WebScriptSource(
-              blink::WebString::FromUTF8(new_selectors_script)),
-          blink::BackForwardCacheAware::kAllow);
+      InjectHideSelectors(resources.hide_selectors);
     }
   }
 
-  const auto* force_hide_selectors_list =
-      resources_dict.FindList("force_hide_selectors");
-  if (force_hide_selectors_list) {
-    for (auto& selector : *force_hide_selectors_list) {
-      DCHECK(selector.is_string());
-      stylesheet += selector.GetString() + "{display:none !important}";
-    }
-  }
+  stylesheet += SelectorsToStylesheet(resources.force_hide_selectors);
 
-  const auto* style_selectors_dictionary =
-      resources_dict.FindDict("style_selectors");
-  if (style_selectors_dictionary) {
-    for (const auto kv : *style_selectors_dictionary) {
-      DCHECK(kv.second.is_list());
-      std::string selector = kv.first;
-      const auto& styles = kv.second.GetList();
-      stylesheet += selector + '{';
-      for (auto& style : styles) {
-        DCHECK(style.is_string());
-        stylesheet += style.GetString() + ';';
-      }
-      stylesheet += '}';
+  for (const auto& [selector, styles] : resources.style_selectors) {
+    stylesheet += selector + '{';
+    for (const auto& style : styles) {
+      stylesheet += style + ';';
     }
+    stylesheet += '}';
   }
 
   if (!stylesheet.empty()) {
@@ -529,7 +604,21 @@ void CosmeticFiltersJSHandler::CSSRulesRoutine(
 }
 
 void CosmeticFiltersJSHandler::OnHiddenClassIdSelectors(
-    base::Value::Dict result) {
+    base::TimeTicks mutation_time,
+    mojom::HiddenClassIdSelectorsResultPtr result) {
+  class_id_queries_.OnQueryFinished();
+
+  ApplyHiddenClassIdSelectors(*result);
+  if (perf_tracker_)
+    perf_tracker_->OnClassIdSelectorsApplied(mutation_time);
+
+  // Send whatever was coalesced while waiting for this reply.
+  if (class_id_queries_.CanSend())
+    SendPendingClassIdSelectorsQuery();
+}
+
+void CosmeticFiltersJSHandler::ApplyHiddenClassIdSelectors(
+    const mojom::HiddenClassIdSelectorsResult& result) {
   if (generichide_) {
     return;
   }
@@ -538,20 +627,8 @@ void CosmeticFiltersJSHandler::OnHiddenClassIdSelectors(
       "Brave.CosmeticFilters.OnHiddenClassIdSelectors");
   TRACE_EVENT1("brave.adblock", "OnHiddenClassIdSelectors", "url", url_.spec());
 
-  base::Value::List* hide_selectors = result.FindList("hide_selectors");
-  DCHECK(hide_selectors);
-
-  base::Value::List* force_hide_selectors =
-      result.FindList("force_hide_selectors");
-  DCHECK(force_hide_selectors);
-
-  if (force_hide_selectors->size() != 0) {
-    std::string stylesheet = "";
-    for (auto& selector : *force_hide_selectors) {
-      DCHECK(selector.is_string());
-      stylesheet += selector.GetString() + "{display:none !important}";
-    }
-    InjectStylesheet(stylesheet);
+  if (!result.force_hide_selectors.empty()) {
+    InjectStylesheet(SelectorsToStylesheet(result.force_hide_selectors));
   }
 
   // If its a vetted engine AND we're not in aggressive
@@ -560,32 +637,11 @@ void CosmeticFiltersJSHandler::OnHiddenClassIdSelectors(
     return;
 
   if (enabled_1st_party_cf_) {
-    std::string stylesheet = "";
-    for (auto& selector : *hide_selectors) {
-      DCHECK(selector.is_string());
-      stylesheet += selector.GetString() + "{display:none !important}";
-    }
-    InjectStylesheet(stylesheet);
+    if (!result.hide_selectors.empty())
+      InjectStylesheet(SelectorsToStylesheet(result.hide_selectors));
   } else {
-    blink::WebLocalFrame* web_frame = render_frame_->GetWebFrame();
-    std::string json_selectors;
-    if (!base::JSONWriter::Write(*hide_selectors, &json_selectors) ||
-        json_selectors.empty()) {
-      json_selectors = "[]";
-    }
-    // Building a script for stylesheet modifications
-    std::string new_selectors_script =
-        base::StringPrintf(kHideSelectorsInjectScript, json_selectors.c_str());
-    if (hide_selectors->size() != 0) {
-      web_frame->ExecuteScriptInIsolatedWorld(
-          isolated_world_id_,
-          blink::WebScriptSource(
-              blink::WebString::FromUTF8(new_selectors_script)),
-          blink::BackForwardCacheAware::kAllow);
-    }
-
-    if (!enabled_1st_party_cf_)
-      ExecuteObservingBundleEntryPoint();
+    InjectHideSelectors(result.hide_selectors);
+    ExecuteObservingBundleEntryPoint();
   }
 }
 
@@ -12,7 +12,9 @@
 
 #include "base/memory/raw_ptr.h"
 #include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
 #include "brave/components/cosmetic_filters/common/cosmetic_filters.mojom.h"
+#include "brave/components/cosmetic_filters/renderer/class_id_selectors_query_queue.h"
 #include "content/public/renderer/render_frame.h"
 #include "content/public/renderer/render_frame_observer.h"
 #include "mojo/public/cpp/bindings/remote.h"
@@ -59,13 +61,26 @@ class CosmeticFiltersJSHandler {
 
   void CreateWorkerObject(v8::Isolate* isolate, v8::Local<v8::Context> context);
 
-  // A function to be called from JS
-  void HiddenClassIdSelectors(const std::string& input);
+  // A function to be called from JS, which only passes classes and ids it
+  // hasn't queried yet for the current document. Everything that arrives
+  // while a query is in flight is coalesced into the next one.
+  // |ms_since_mutation| is how long ago the oldest mutation which added them
+  // happened, or negative if they didn't come from a mutation.
+  void HiddenClassIdSelectors(const std::vector<std::string>& classes,
+                              const std::vector<std::string>& ids,
+                              double ms_since_mutation);
+  void SendPendingClassIdSelectorsQuery();
 
   void OnUrlCosmeticResources(base::OnceClosure callback,
-                              base::Value result);
-  void CSSRulesRoutine(const base::Value::Dict& resources_dict);
-  void OnHiddenClassIdSelectors(base::Value::Dict result);
+                              mojom::UrlCosmeticResourcesResultPtr result);
+  void CSSRulesRoutine(const mojom::UrlCosmeticResourcesResult& resources);
+  void OnHiddenClassIdSelectors(base::TimeTicks mutation_time,
+                                mojom::HiddenClassIdSelectorsResultPtr result);
+  void ApplyHiddenClassIdSelectors(
+      const mojom::HiddenClassIdSelectorsResult& result);
+  // Hides |selectors| through the content_cosmetic stylesheet, which lets
+  // first-party elements be unhidden later.
+  void InjectHideSelectors(const std::vector<std::string>& selectors);
   bool OnIsFirstParty(const std::string& url_string);
   int OnEventBegin(const std::string& event_name);
   void OnEventEnd(const std::string& event_name, int);
@@ -81,7 +96,9 @@ class CosmeticFiltersJSHandler {
   bool enabled_1st_party_cf_;
   std::vector<std::string> exceptions_;
   GURL url_;
-  absl::optional<base::Value::Dict> resources_dict_;
+  mojom::UrlCosmeticResourcesResultPtr resources_;
+
+  ClassIdSelectorsQueryQueue class_id_queries_;
 
   // True if the content_cosmetic.bundle.js has injected in the current frame.
   bool bundle_injected_ = false;
@@ -39,6 +39,8 @@ let fetchNewClassIdRulesTimeoutId: number | undefined
 
 const queriedIds = new Set<string>()
 const queriedClasses = new Set<string>()
+// When the oldest mutation whose elements are not yet queried happened.
+let oldestNotYetQueriedMutationTime: number | undefined
 
 const notYetQueriedElements: Array<(Element[] | NodeListOf<Element>)> = []
 
@@ -167,16 +169,19 @@ const fetchNewClassIdRules = () => {
     }
   }
   notYetQueriedElements.length = 0
+  // Negative if the elements didn't come from a mutation.
+  const msSinceMutation = oldestNotYetQueriedMutationTime === undefined
+    ? -1
+    : performance.now() - oldestNotYetQueriedMutationTime
+  oldestNotYetQueriedMutationTime = undefined
   if ((!notYetQueriedClasses || notYetQueriedClasses.length === 0) &&
     (!notYetQueriedIds || notYetQueriedIds.length === 0)) {
     return
   }
   // Callback to c++ renderer process
   // @ts-expect-error
-  cf_worker.hiddenClassIdSelectors(
-      JSON.stringify({
-        classes: notYetQueriedClasses, ids: notYetQueriedIds
-      }))
+  cf_worker.hiddenClassIdSelectors(notYetQueriedClasses, notYetQueriedIds,
+    msSinceMutation)
   notYetQueriedClasses = []
   notYetQueriedIds = []
 }
@@ -200,6 +205,7 @@ const usePolling = (observer?: MutationObserver) => {
   if (observer) {
     observer.disconnect()
     notYetQueriedElements.length = 0
+    oldestNotYetQueriedMutationTime = undefined
   }
 
   const futureTimeMs = window.Date.now() + returnToMutationObserverIntervalMs
@@ -260,6 +266,9 @@ const onMutations = (mutations: MutationRecord[], observer: MutationObserver) =>
   // Callback to c++ renderer process
   // @ts-expect-error
   const eventId: number | undefined = cf_worker.onHandleMutationsBegin?.()
+  if (oldestNotYetQueriedMutationTime === undefined) {
+    oldestNotYetQueriedMutationTime = performance.now()
+  }
   const mutationScore = queueAttrsFromMutations(mutations)
 
   // Check the conditions to switch to the alternative strategy
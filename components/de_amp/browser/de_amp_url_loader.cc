@@ -76,10 +76,12 @@ void DeAmpURLLoader::OnBodyReadable(MojoResult) {
     Abort();
     return;
   }
-  // If we were not redirected and we didn't find AMP, or
-  // if we did find AMP previously and we've already read more bytes than
-  // max, complete the load.
-  if (!found_amp_ || read_bytes_ >= kMaxBytesToCheck) {
+  // If we were not redirected and we didn't find AMP and the <html> tag can't
+  // come anymore, or if we've already read more bytes than max, complete the
+  // load.
+  if (!de_amp_throttle_ ||
+      !(found_amp_ || amp_page_scanner_.is_html_tag_pending()) ||
+      read_bytes_ >= kMaxBytesToCheck) {
     found_amp_ = false;  // reset
     CompleteLoading(std::move(buffered_body_));
     return;
@@ -92,21 +94,28 @@ bool DeAmpURLLoader::MaybeRedirectToCanonicalLink() {
     return false;
   }
 
-  // If we are not already on an AMP page, check if this chunk has the AMP HTML
-  if (!found_amp_ && !CheckIfAmpPage(buffered_body_)) {
+  // Only the bytes received since the previous chunk are scanned.
+  amp_page_scanner_.Scan(buffered_body_);
+  if (!amp_page_scanner_.is_amp_page()) {
     return false;
   }
 
   found_amp_ = true;  // If we get to this point, we know we have an AMP page
 
-  auto canonical_link = FindCanonicalAmpUrl(buffered_body_);
-  if (!canonical_link.has_value()) {
-    VLOG(2) << __func__ << canonical_link.error();
+  const auto& canonical_link = amp_page_scanner_.canonical_url();
+  if (!canonical_link) {
+    VLOG(2) << __func__ << " Couldn't find link tag";
+    return false;
+  }
+  if (!canonical_link->has_value()) {
+    VLOG(2) << __func__ << canonical_link->error();
+    // The link tag won't change with more bytes, so stop trying
+    found_amp_ = false;
     return false;
   }
 
   bool redirected = false;
-  const GURL canonical_url(canonical_link.value());
+  const GURL canonical_url(canonical_link->value());
   // Validate the found canonical AMP URL
   if (VerifyCanonicalAmpUrl(canonical_url, response_url_)) {
     // Attempt to go to the canonical URL
@@ -8,7 +8,9 @@
 #include <utility>
 
 #include "base/feature_list.h"
+#include "base/check_op.h"
 #include "base/no_destructor.h"
+#include "base/strings/string_util.h"
 #include "brave/components/de_amp/common/features.h"
 #include "brave/components/de_amp/common/pref_names.h"
 #include "components/prefs/pref_service.h"
@@ -39,6 +41,65 @@ RE2::Options InitRegexOptions() {
   return opt;
 }
 
+const re2::RE2& GetHtmlTagRegex() {
+  static const base::NoDestructor<re2::RE2> kGetHtmlTagRegex(
+      kGetHtmlTagPattern, InitRegexOptions());
+  return *kGetHtmlTagRegex;
+}
+
+const re2::RE2& GetDetectAmpRegex() {
+  static const base::NoDestructor<re2::RE2> kDetectAmpRegex(
+      kDetectAmpPattern, InitRegexOptions());
+  return *kDetectAmpRegex;
+}
+
+const re2::RE2& GetFindCanonicalLinkTagRegex() {
+  static const base::NoDestructor<re2::RE2> kFindCanonicalLinkTagRegex(
+      kFindCanonicalLinkTagPattern, InitRegexOptions());
+  return *kFindCanonicalLinkTagRegex;
+}
+
+const re2::RE2& GetFindCanonicalHrefInTagRegex() {
+  static const base::NoDestructor<re2::RE2> kFindCanonicalHrefInTagRegex(
+      kFindCanonicalHrefInTagPattern, InitRegexOptions());
+  return *kFindCanonicalHrefInTagRegex;
+}
+
+// Looks for the first tag matching |regex| in |body| from |*offset|. The tags
+// we look for can't contain '>' before their end, so when there is no match,
+// |*offset| is moved past the last '>' and the next search only looks at the
+// tag that may still be incomplete and the bytes received after it.
+bool FindTag(const re2::RE2& regex,
+             base::StringPiece body,
+             size_t* offset,
+             std::string* tag) {
+  DCHECK_LE(*offset, body.size());
+  const re2::StringPiece remaining(body.data() + *offset,
+                                   body.size() - *offset);
+  if (RE2::PartialMatch(remaining, regex, tag)) {
+    return true;
+  }
+
+  const size_t last_tag_end = remaining.rfind('>');
+  if (last_tag_end != re2::StringPiece::npos) {
+    *offset += last_tag_end + 1;
+  }
+  return false;
+}
+
+base::expected<std::string, std::string> FindCanonicalUrlInLinkTag(
+    const std::string& link_tag) {
+  std::string canonical_url;
+  // Find href in canonical link tag
+  // Check there is only 1 href captured, else fail
+  if (!RE2::PartialMatch(link_tag, GetFindCanonicalHrefInTagRegex(),
+                         &canonical_url)) {
+    // Didn't find canonical link, potentially try again
+    return base::unexpected("Couldn't find canonical URL in link tag");
+  }
+  return base::ok(std::move(canonical_url));
+}
+
 }  // namespace
 
 bool IsDeAmpEnabled(PrefService* prefs) {
@@ -55,20 +116,15 @@ bool VerifyCanonicalAmpUrl(const GURL& canonical_link,
 }
 
 bool CheckIfAmpPage(const std::string& body) {
-  auto opt = InitRegexOptions();
   // The order of running these regexes is important:
   // we first get the relevant HTML tag and then find the info.
-  static const base::NoDestructor<re2::RE2> kGetHtmlTagRegex(kGetHtmlTagPattern,
-                                                             opt);
-  static const base::NoDestructor<re2::RE2> kDetectAmpRegex(kDetectAmpPattern,
-                                                            opt);
-
   std::string html_tag;
-  if (!RE2::PartialMatch(body, *kGetHtmlTagRegex, &html_tag)) {
+  size_t offset = 0;
+  if (!FindTag(GetHtmlTagRegex(), body, &offset, &html_tag)) {
     // Early exit if we can't find HTML tag - malformed document (or error)
     return false;
   }
-  if (!RE2::PartialMatch(html_tag, *kDetectAmpRegex)) {
+  if (!RE2::PartialMatch(html_tag, GetDetectAmpRegex())) {
     // Not AMP
     return false;
   }
@@ -77,27 +133,85 @@ bool CheckIfAmpPage(const std::string& body) {
 
 base::expected<std::string, std::string> FindCanonicalAmpUrl(
     const std::string& body) {
-  auto opt = InitRegexOptions();
   // The order of running these regexes is important
-  static const base::NoDestructor<re2::RE2> kFindCanonicalLinkTagRegex(
-      kFindCanonicalLinkTagPattern, opt);
-  static const base::NoDestructor<re2::RE2> kFindCanonicalHrefInTagRegex(
-      kFindCanonicalHrefInTagPattern, opt);
-
   std::string link_tag;
-  if (!RE2::PartialMatch(body, *kFindCanonicalLinkTagRegex, &link_tag)) {
+  size_t offset = 0;
+  if (!FindTag(GetFindCanonicalLinkTagRegex(), body, &offset, &link_tag)) {
     // Can't find link tag, exit
     return base::unexpected("Couldn't find link tag");
   }
-  std::string canonical_url;
-  // Find href in canonical link tag
-  // Check there is only 1 href captured, else fail
-  if (!RE2::PartialMatch(link_tag, *kFindCanonicalHrefInTagRegex,
-                         &canonical_url)) {
-    // Didn't find canonical link, potentially try again
-    return base::unexpected("Couldn't find canonical URL in link tag");
+  return FindCanonicalUrlInLinkTag(link_tag);
+}
+
+AmpPageScanner::AmpPageScanner() = default;
+
+AmpPageScanner::~AmpPageScanner() = default;
+
+void AmpPageScanner::Scan(base::StringPiece body) {
+  DCHECK_GE(body.size(), scanned_size_);
+  scanned_size_ = body.size();
+
+  if (!html_tag_found_) {
+    std::string html_tag;
+    regex_scanned_bytes_ += body.size() - html_tag_offset_;
+    if (!FindTag(GetHtmlTagRegex(), body, &html_tag_offset_, &html_tag)) {
+      UpdateHtmlTagPending(body);
+      return;
+    }
+
+    html_tag_found_ = true;
+    html_tag_pending_ = false;
+    is_amp_page_ = RE2::PartialMatch(html_tag, GetDetectAmpRegex());
+  }
+
+  if (!is_amp_page_ || canonical_url_) {
+    return;
+  }
+
+  // Until the link tag shows up, it may still be in the bytes to come.
+  std::string link_tag;
+  regex_scanned_bytes_ += body.size() - link_tag_offset_;
+  if (FindTag(GetFindCanonicalLinkTagRegex(), body, &link_tag_offset_,
+              &link_tag)) {
+    canonical_url_ = FindCanonicalUrlInLinkTag(link_tag);
+  }
+}
+
+void AmpPageScanner::UpdateHtmlTagPending(base::StringPiece body) {
+  constexpr base::StringPiece kUtf8ByteOrderMark = "\xEF\xBB\xBF";
+  if (element_scan_offset_ == 0 &&
+      base::StartsWith(body, kUtf8ByteOrderMark)) {
+    element_scan_offset_ = kUtf8ByteOrderMark.size();
+  }
+
+  // The <html> tag can only come after whitespace, comments and the doctype,
+  // so anything else means that the page doesn't start with one.
+  while (element_scan_offset_ < body.size()) {
+    const char c = body[element_scan_offset_];
+    if (base::IsAsciiWhitespace(c)) {
+      ++element_scan_offset_;
+      continue;
+    }
+
+    if (c != '<') {
+      html_tag_pending_ = false;
+      return;
+    }
+
+    // Wait for the rest of a tag that ends the received bytes.
+    const size_t tag_end = body.find('>', element_scan_offset_);
+    if (tag_end == base::StringPiece::npos) {
+      return;
+    }
+
+    const char next = body[element_scan_offset_ + 1];
+    if (next != '!' && next != '?') {
+      html_tag_pending_ = false;
+      return;
+    }
+
+    element_scan_offset_ = tag_end + 1;
   }
-  return base::ok(std::move(canonical_url));
 }
 
 }  // namespace de_amp
@@ -8,8 +8,10 @@
 
 #include <string>
 
+#include "base/strings/string_piece.h"
 #include "base/types/expected.h"
 #include "components/prefs/pref_service.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 #include "url/gurl.h"
 
 namespace de_amp {
@@ -26,6 +28,54 @@ base::expected<std::string, std::string> FindCanonicalAmpUrl(
 
 // Validation check for canonical URL
 bool VerifyCanonicalAmpUrl(const GURL& canonical_url, const GURL& original_url);
+
+// Does the same as CheckIfAmpPage and FindCanonicalAmpUrl on a body that is
+// received in chunks. Scanning keeps its position across calls, so that each
+// call only looks at the newly received bytes and the tag they may complete.
+class AmpPageScanner {
+ public:
+  AmpPageScanner();
+  ~AmpPageScanner();
+
+  AmpPageScanner(const AmpPageScanner&) = delete;
+  AmpPageScanner& operator=(const AmpPageScanner&) = delete;
+
+  // |body| is all of the body received so far, so it starts with the body
+  // passed to the previous call.
+  void Scan(base::StringPiece body);
+
+  // Whether the <html> tag may still be in the bytes to come. It is no longer
+  // pending once it has been found, or once anything other than whitespace,
+  // comments or the doctype comes first.
+  bool is_html_tag_pending() const { return html_tag_pending_; }
+  bool is_amp_page() const { return is_amp_page_; }
+
+  // Set once the canonical link tag of an AMP page has been found, to its href
+  // or to an error if it has none.
+  const absl::optional<base::expected<std::string, std::string>>&
+  canonical_url() const {
+    return canonical_url_;
+  }
+
+  // The number of bytes the tag regexes have been run on, across calls.
+  size_t regex_scanned_bytes_for_testing() const {
+    return regex_scanned_bytes_;
+  }
+
+ private:
+  void UpdateHtmlTagPending(base::StringPiece body);
+
+  size_t scanned_size_ = 0;
+  size_t html_tag_offset_ = 0;
+  size_t element_scan_offset_ = 0;
+  size_t link_tag_offset_ = 0;
+  size_t regex_scanned_bytes_ = 0;
+
+  bool html_tag_found_ = false;
+  bool html_tag_pending_ = true;
+  bool is_amp_page_ = false;
+  absl::optional<base::expected<std::string, std::string>> canonical_url_;
+};
 }  // namespace de_amp
 
 #endif  // BRAVE_COMPONENTS_DE_AMP_BROWSER_DE_AMP_UTIL_H_
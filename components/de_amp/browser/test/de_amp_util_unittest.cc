@@ -4,6 +4,8 @@
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
 #include "brave/components/de_amp/browser/de_amp_util.h"
+
+#include "base/strings/string_piece.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
 namespace de_amp {
@@ -23,6 +25,21 @@ void CheckFindCanonicalLinkResult(const std::string& expected_link,
       EXPECT_EQ(expected_link, canonical_link.value());
     }
   }
+
+  // Scanning the body as it arrives, a byte at a time, gives the same result
+  AmpPageScanner scanner;
+  for (size_t size = 1; size <= body.size(); ++size) {
+    scanner.Scan(base::StringPiece(body).substr(0, size));
+  }
+  EXPECT_EQ(expected_detect_amp, scanner.is_amp_page());
+  if (expected_detect_amp) {
+    const auto& canonical_link = scanner.canonical_url();
+    EXPECT_EQ(expected_find_canonical,
+              canonical_link && canonical_link->has_value());
+    if (expected_find_canonical) {
+      EXPECT_EQ(expected_link, canonical_link->value());
+    }
+  }
 }
 void CheckCheckCanonicalLinkResult(const std::string& canonical_link,
                                    const std::string& original,
@@ -272,4 +289,66 @@ TEST(DeAmpUtilUnitTest, CanonicalLinkIsRelative) {
   CheckCheckCanonicalLinkResult("abc", "https://amp.xyz.com", false);
 }
 
+TEST(DeAmpUtilUnitTest, ScannerWaitsForHtmlTag) {
+  AmpPageScanner scanner;
+  std::string body = "\xEF\xBB\xBF<!DOCTYPE html>\n<!-- comment -->\n";
+  scanner.Scan(body);
+  EXPECT_TRUE(scanner.is_html_tag_pending());
+
+  body += "<html lang=\"en\" ";
+  scanner.Scan(body);
+  EXPECT_TRUE(scanner.is_html_tag_pending());
+
+  body += "amp>";
+  scanner.Scan(body);
+  EXPECT_FALSE(scanner.is_html_tag_pending());
+  EXPECT_TRUE(scanner.is_amp_page());
+  EXPECT_FALSE(scanner.canonical_url());
+
+  body += "<head><link rel=\"canonical\" href=\"https://abc.com\"";
+  scanner.Scan(body);
+  EXPECT_FALSE(scanner.canonical_url());
+
+  body += "/>";
+  scanner.Scan(body);
+  ASSERT_TRUE(scanner.canonical_url());
+  EXPECT_EQ("https://abc.com", scanner.canonical_url()->value());
+}
+
+TEST(DeAmpUtilUnitTest, ScannerResolvesNonAmpPagesEarly) {
+  // Non-AMP pages are forwarded as soon as the start of the body tells.
+  for (const char* body :
+       {"<!DOCTYPE html><html>", "<html lang=\"en\">", "<!doctype html><head>",
+        "%PDF-1.7", "{\"a\": 1}"}) {
+    SCOPED_TRACE(body);
+    AmpPageScanner scanner;
+    scanner.Scan(body);
+    EXPECT_FALSE(scanner.is_html_tag_pending());
+    EXPECT_FALSE(scanner.is_amp_page());
+  }
+}
+
+TEST(DeAmpUtilUnitTest, ScannerOnlyScansNewBytes) {
+  // A large AMP page without a canonical link, received in small chunks.
+  std::string body = "<html amp><head>";
+  for (int i = 0; i < 10000; ++i) {
+    body += "<meta name=\"x\" content=\"y\">";
+  }
+  body += "<link rel=\"canonical\" href=\"https://abc.com\">";
+
+  AmpPageScanner scanner;
+  for (size_t size = 64; size < body.size(); size += 64) {
+    scanner.Scan(base::StringPiece(body).substr(0, size));
+    ASSERT_FALSE(scanner.canonical_url());
+  }
+  scanner.Scan(body);
+
+  // Each call only rescans the tag that the previous chunk cut off, rather
+  // than the whole body received so far.
+  EXPECT_LT(scanner.regex_scanned_bytes_for_testing(), 2 * body.size());
+  EXPECT_TRUE(scanner.is_amp_page());
+  ASSERT_TRUE(scanner.canonical_url());
+  EXPECT_EQ("https://abc.com", scanner.canonical_url()->value());
+}
+
 }  // namespace de_amp
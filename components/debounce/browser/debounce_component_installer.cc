@@ -6,14 +6,17 @@
 #include "brave/components/debounce/browser/debounce_component_installer.h"
 
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "base/base_paths.h"
 #include "base/command_line.h"
-#include "base/containers/flat_set.h"
+#include "base/files/memory_mapped_file.h"
 #include "base/functional/bind.h"
 #include "base/json/json_reader.h"
 #include "base/logging.h"
+#include "base/strings/string_piece.h"
 #include "base/task/thread_pool.h"
 #include "base/types/expected.h"
 #include "brave/components/brave_component_updater/browser/dat_file_util.h"
@@ -25,6 +28,26 @@ using brave_component_updater::LocalDataFilesService;
 
 namespace debounce {
 
+namespace {
+
+// Parses the rules straight from the mapped configuration file, so that the
+// JSON text is never copied onto the heap.
+base::expected<std::pair<std::vector<std::unique_ptr<DebounceRule>>,
+                         DebounceRuleIndex>,
+               std::string>
+ParseRulesFromFile(const base::FilePath& dat_file_path) {
+  std::unique_ptr<base::MemoryMappedFile> mapped_file =
+      brave_component_updater::MapDATFile(dat_file_path);
+  if (!mapped_file) {
+    return base::unexpected("Could not obtain debounce configuration");
+  }
+  return DebounceRule::ParseRules(
+      base::StringPiece(reinterpret_cast<const char*>(mapped_file->data()),
+                        mapped_file->length()));
+}
+
+}  // namespace
+
 const char kDebounceConfigFile[] = "debounce.json";
 const char kDebounceConfigFileVersion[] = "1";
 
@@ -38,23 +61,21 @@ void DebounceComponentInstaller::LoadDirectlyFromResourcePath() {
   base::FilePath dat_file_path = resource_dir_.AppendASCII(kDebounceConfigFile);
   base::ThreadPool::PostTaskAndReplyWithResult(
       FROM_HERE, {base::MayBlock()},
-      base::BindOnce(&brave_component_updater::GetDATFileAsString,
-                     dat_file_path),
-      base::BindOnce(&DebounceComponentInstaller::OnDATFileDataReady,
+      base::BindOnce(&ParseRulesFromFile, dat_file_path),
+      base::BindOnce(&DebounceComponentInstaller::OnRulesParsed,
                      weak_factory_.GetWeakPtr()));
 }
 
-void DebounceComponentInstaller::OnDATFileDataReady(
-    const std::string& contents) {
-  auto parsed_rules = DebounceRule::ParseRules(contents);
+void DebounceComponentInstaller::OnRulesParsed(
+    base::expected<std::pair<std::vector<std::unique_ptr<DebounceRule>>,
+                             DebounceRuleIndex>,
+                   std::string> parsed_rules) {
   if (!parsed_rules.has_value()) {
     LOG(WARNING) << parsed_rules.error();
     return;
   }
-  rules_.clear();
-  host_cache_.clear();
   rules_ = std::move(parsed_rules.value().first);
-  host_cache_ = parsed_rules.value().second;
+  rule_index_ = std::move(parsed_rules.value().second);
   for (Observer& observer : observers_)
     observer.OnRulesReady(this);
 }
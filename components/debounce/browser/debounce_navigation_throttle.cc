@@ -13,6 +13,7 @@
 #include "base/containers/contains.h"
 #include "base/functional/bind.h"
 #include "base/memory/weak_ptr.h"
+#include "base/metrics/histogram_macros.h"
 #include "base/task/sequenced_task_runner.h"
 #include "brave/components/debounce/browser/debounce_service.h"
 #include "brave/components/debounce/common/pref_names.h"
@@ -121,6 +122,7 @@ DebounceNavigationThrottle::WillRedirectRequest() {
 
 NavigationThrottle::ThrottleCheckResult
 DebounceNavigationThrottle::MaybeRedirect() {
+  SCOPED_UMA_HISTOGRAM_TIMER_MICROS("Brave.Debounce.ThrottleLatency");
   WebContents* web_contents = navigation_handle()->GetWebContents();
   if (!web_contents || !navigation_handle()->IsInMainFrame())
     return NavigationThrottle::PROCEED;
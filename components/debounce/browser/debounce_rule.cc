@@ -5,6 +5,9 @@
 
 #include "brave/components/debounce/browser/debounce_rule.h"
 
+#include <algorithm>
+#include <iterator>
+#include <map>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -129,9 +132,9 @@ bool DebounceRule::IsSameETLDForDebounce(const GURL& url1, const GURL& url2) {
 
 // static
 base::expected<std::pair<std::vector<std::unique_ptr<DebounceRule>>,
-                         base::flat_set<std::string>>,
+                         DebounceRuleIndex>,
                std::string>
-DebounceRule::ParseRules(const std::string& contents) {
+DebounceRule::ParseRules(base::StringPiece contents) {
   if (contents.empty()) {
     return base::unexpected("Could not obtain debounce configuration");
   }
@@ -139,25 +142,50 @@ DebounceRule::ParseRules(const std::string& contents) {
   if (!root) {
     return base::unexpected("Failed to parse debounce configuration");
   }
-  std::vector<std::string> hosts;
+  std::map<std::string, std::vector<size_t>> rules_by_host;
+  std::vector<size_t> any_host_rules;
   std::vector<std::unique_ptr<DebounceRule>> rules;
   base::JSONValueConverter<DebounceRule> converter;
   for (base::Value& it : root->GetList()) {
     std::unique_ptr<DebounceRule> rule = std::make_unique<DebounceRule>();
     if (!converter.Convert(it, rule.get()))
       continue;
+    const size_t rule_index = rules.size();
+    bool matches_any_host = false;
     for (const URLPattern& pattern : rule->include_pattern_set()) {
-      if (!pattern.host().empty()) {
-        const std::string etldp1 =
-            DebounceRule::GetETLDForDebounce(pattern.host());
-        if (!etldp1.empty())
-          hosts.push_back(std::move(etldp1));
+      const std::string etldp1 =
+          pattern.host().empty()
+              ? std::string()
+              : DebounceRule::GetETLDForDebounce(pattern.host());
+      if (etldp1.empty()) {
+        matches_any_host = true;
+        continue;
       }
+      std::vector<size_t>& host_rules = rules_by_host[etldp1];
+      if (host_rules.empty() || host_rules.back() != rule_index)
+        host_rules.push_back(rule_index);
     }
+    if (matches_any_host)
+      any_host_rules.push_back(rule_index);
     rules.push_back(std::move(rule));
   }
+
+  // Only hosts named by some rule are debounced at all, so rules matching any
+  // host are folded into each entry rather than checked separately.
+  std::vector<std::pair<std::string, std::vector<size_t>>> index;
+  index.reserve(rules_by_host.size());
+  for (auto& [host, host_rules] : rules_by_host) {
+    std::vector<size_t> merged;
+    merged.reserve(host_rules.size() + any_host_rules.size());
+    std::set_union(host_rules.begin(), host_rules.end(),
+                   any_host_rules.begin(), any_host_rules.end(),
+                   std::back_inserter(merged));
+    index.emplace_back(host, std::move(merged));
+  }
   return std::pair<std::vector<std::unique_ptr<DebounceRule>>,
-                   base::flat_set<std::string>>(std::move(rules), hosts);
+                   DebounceRuleIndex>(
+      std::move(rules),
+      DebounceRuleIndex(base::sorted_unique, std::move(index)));
 }
 
 bool DebounceRule::CheckPrefForRule(const PrefService* prefs) const {
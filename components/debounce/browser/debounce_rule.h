@@ -11,9 +11,10 @@
 #include <utility>
 #include <vector>
 
-#include "base/containers/flat_set.h"
+#include "base/containers/flat_map.h"
 #include "base/json/json_value_converter.h"
 #include "base/strings/escape.h"
+#include "base/strings/string_piece.h"
 #include "base/types/expected.h"
 #include "base/values.h"
 #include "components/prefs/pref_service.h"
@@ -36,6 +37,13 @@ enum DebouncePrependScheme {
   kDebounceSchemePrependHttps
 };
 
+class DebounceRule;
+
+// Indices into the parsed rule list, in rule order, keyed by the eTLD+1s
+// those rules can match. Rules whose include patterns match any host are
+// listed under every key.
+using DebounceRuleIndex = base::flat_map<std::string, std::vector<size_t>>;
+
 class DebounceRule {
  public:
   DebounceRule();
@@ -50,9 +58,9 @@ class DebounceRule {
   static bool ParsePrependScheme(base::StringPiece value,
                                  DebouncePrependScheme* field);
   static base::expected<std::pair<std::vector<std::unique_ptr<DebounceRule>>,
-                                  base::flat_set<std::string>>,
+                                  DebounceRuleIndex>,
                         std::string>
-  ParseRules(const std::string& contents);
+  ParseRules(base::StringPiece contents);
   static const std::string GetETLDForDebounce(const std::string& host);
   static bool IsSameETLDForDebounce(const GURL& url1, const GURL& url2);
   static bool GetURLPatternSetFromValue(const base::Value* value,
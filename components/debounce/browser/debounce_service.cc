@@ -9,8 +9,6 @@
 #include <string>
 #include <vector>
 
-#include "base/containers/contains.h"
-#include "base/containers/flat_set.h"
 #include "base/logging.h"
 #include "brave/components/debounce/browser/debounce_component_installer.h"
 #include "brave/components/debounce/common/pref_names.h"
@@ -29,20 +27,18 @@ DebounceService::~DebounceService() = default;
 
 bool DebounceService::Debounce(const GURL& original_url,
                                GURL* final_url) const {
-  // Check host cache to see if this URL needs to have any debounce rules
-  // applied.
-  const base::flat_set<std::string>& host_cache =
-      component_installer_->host_cache();
-  const std::string etldp1 =
-      DebounceRule::GetETLDForDebounce(original_url.host());
-  if (!base::Contains(host_cache, etldp1))
+  // Look up the rules that can apply to this URL's eTLD+1, if any.
+  const DebounceRuleIndex& rule_index = component_installer_->rule_index();
+  const auto it = rule_index.find(
+      DebounceRule::GetETLDForDebounce(original_url.host()));
+  if (it == rule_index.end())
     return false;
 
   const std::vector<std::unique_ptr<DebounceRule>>& rules =
       component_installer_->rules();
 
-  for (const std::unique_ptr<DebounceRule>& rule : rules) {
-    if (rule->Apply(original_url, final_url, prefs_)) {
+  for (size_t i : it->second) {
+    if (rules[i]->Apply(original_url, final_url, prefs_)) {
       if (original_url != *final_url) {
         return true;
       }
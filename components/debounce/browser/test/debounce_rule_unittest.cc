@@ -445,4 +445,45 @@ TEST(DebounceRuleUnitTest, CatchMultiplePathsForSameInclude) {
   }
 }
 
+TEST(DebounceRuleUnitTest, RuleIndex) {
+  const std::string contents = R"json(
+      [{
+          "include": [
+              "*://a.com/*",
+              "*://*.b.com/*"
+          ],
+          "exclude": [
+          ],
+          "action": "redirect",
+          "param": "url"
+      }, {
+          "include": [
+              "<all_urls>"
+          ],
+          "exclude": [
+          ],
+          "action": "redirect",
+          "param": "dest"
+      }, {
+          "include": [
+              "*://sub.b.com/*",
+              "*://sub2.b.com/*"
+          ],
+          "exclude": [
+          ],
+          "action": "redirect",
+          "param": "u"
+      }]
+      )json";
+  auto parsed = DebounceRule::ParseRules(contents);
+  ASSERT_TRUE(parsed.has_value());
+  ASSERT_EQ(3u, parsed.value().first.size());
+
+  const DebounceRuleIndex& index = parsed.value().second;
+  ASSERT_EQ(2u, index.size());
+  EXPECT_EQ(std::vector<size_t>({0, 1}), index.at("a.com"));
+  EXPECT_EQ(std::vector<size_t>({0, 1, 2}), index.at("b.com"));
+  EXPECT_FALSE(index.contains("c.com"));
+}
+
 }  // namespace debounce
@@ -8,15 +8,16 @@
 #include <memory>
 #include <set>
 #include <string>
-#include <utility>
-#include <vector>
 
 #include "base/containers/contains.h"
 #include "base/files/file_path.h"
+#include "base/files/memory_mapped_file.h"
+#include "base/strings/string_piece.h"
 #include "base/strings/string_split.h"
 #include "base/task/thread_pool.h"
 #include "brave/components/brave_component_updater/browser/dat_file_util.h"
 #include "brave/components/brave_component_updater/browser/local_data_files_observer.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 
 #define HTTPS_UPGRADE_EXCEPTIONS_TXT_FILE "https-upgrade-exceptions-list.txt"
 #define HTTPS_UPGRADE_EXCEPTIONS_TXT_FILE_VERSION "1"
@@ -26,6 +27,31 @@ namespace https_upgrade_exceptions {
 using brave_component_updater::LocalDataFilesObserver;
 using brave_component_updater::LocalDataFilesService;
 
+namespace {
+
+// Splits the exceptions straight from the mapped list file, so that the text
+// is never copied onto the heap. Returns absl::nullopt if there is no list
+// yet.
+absl::optional<std::set<std::string>> LoadExceptionsFromFile(
+    const base::FilePath& txt_file_path) {
+  std::unique_ptr<base::MemoryMappedFile> mapped_file =
+      brave_component_updater::MapDATFile(txt_file_path);
+  if (!mapped_file) {
+    return absl::nullopt;
+  }
+  const base::StringPiece contents(
+      reinterpret_cast<const char*>(mapped_file->data()),
+      mapped_file->length());
+  std::set<std::string> exceptional_domains;
+  for (base::StringPiece line : base::SplitStringPiece(
+           contents, "\n", base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY)) {
+    exceptional_domains.emplace(line);
+  }
+  return exceptional_domains;
+}
+
+}  // namespace
+
 HttpsUpgradeExceptionsService::HttpsUpgradeExceptionsService(
     LocalDataFilesService* local_data_files_service)
     : LocalDataFilesObserver(local_data_files_service) {}
@@ -37,25 +63,19 @@ void HttpsUpgradeExceptionsService::LoadHTTPSUpgradeExceptions(
           .AppendASCII(HTTPS_UPGRADE_EXCEPTIONS_TXT_FILE);
   base::ThreadPool::PostTaskAndReplyWithResult(
       FROM_HERE, {base::MayBlock()},
-      base::BindOnce(&brave_component_updater::GetDATFileAsString,
-                     txt_file_path),
-      base::BindOnce(&HttpsUpgradeExceptionsService::OnDATFileDataReady,
+      base::BindOnce(&LoadExceptionsFromFile, txt_file_path),
+      base::BindOnce(&HttpsUpgradeExceptionsService::OnExceptionsLoaded,
                      weak_factory_.GetWeakPtr()));
 }
 
-void HttpsUpgradeExceptionsService::OnDATFileDataReady(
-    const std::string& contents) {
-  if (contents.empty()) {
+void HttpsUpgradeExceptionsService::OnExceptionsLoaded(
+    absl::optional<std::set<std::string>> exceptional_domains) {
+  if (!exceptional_domains) {
     // We don't have the file yet.
     return;
   }
-  std::vector<std::string> lines = base::SplitString(
-      contents, "\n", base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY);
-  for (const auto& line : lines) {
-    exceptional_domains_.insert(std::move(line));
-  }
+  exceptional_domains_.merge(*exceptional_domains);
   is_ready_ = true;
-  return;
 }
 
 bool HttpsUpgradeExceptionsService::CanUpgradeToHTTPS(const GURL& url) {
@@ -14,6 +14,7 @@
 #include "base/strings/string_piece.h"
 #include "brave/components/brave_component_updater/browser/local_data_files_observer.h"
 #include "brave/components/brave_component_updater/browser/local_data_files_service.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 
 namespace https_upgrade_exceptions {
 
@@ -31,7 +32,8 @@ class HttpsUpgradeExceptionsService
   bool CanUpgradeToHTTPS(const GURL& url);
   ~HttpsUpgradeExceptionsService() override;
   void SetIsReadyForTesting() { is_ready_ = true; }
-  void OnDATFileDataReady(const std::string& contents);
+  void OnExceptionsLoaded(
+      absl::optional<std::set<std::string>> exceptional_domains);
 
  private:
   void LoadHTTPSUpgradeExceptions(const base::FilePath& install_dir);
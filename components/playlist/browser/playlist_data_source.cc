@@ -10,10 +10,13 @@
 
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
+#include "base/files/memory_mapped_file.h"
 #include "base/functional/bind.h"
 #include "base/location.h"
+#include "base/logging.h"
 #include "base/memory/ref_counted_memory.h"
 #include "base/memory/scoped_refptr.h"
+#include "base/task/sequenced_task_runner.h"
 #include "base/task/thread_pool.h"
 #include "base/task/thread_pool/thread_pool_instance.h"
 #include "brave/components/playlist/browser/playlist_service.h"
@@ -23,23 +26,58 @@ namespace playlist {
 
 namespace {
 
-scoped_refptr<base::RefCountedMemory> ReadFileToString(
+// Exposes a memory mapped data file without copying it onto the heap.
+class RefCountedMappedFile : public base::RefCountedMemory {
+ public:
+  RefCountedMappedFile(std::unique_ptr<base::MemoryMappedFile> mapped_file,
+                       scoped_refptr<base::SequencedTaskRunner> task_runner)
+      : mapped_file_(std::move(mapped_file)),
+        task_runner_(std::move(task_runner)) {
+    DCHECK(mapped_file_ && mapped_file_->IsValid());
+  }
+  RefCountedMappedFile(const RefCountedMappedFile&) = delete;
+  RefCountedMappedFile& operator=(const RefCountedMappedFile&) = delete;
+
+  // base::RefCountedMemory:
+  const unsigned char* front() const override { return mapped_file_->data(); }
+  size_t size() const override { return mapped_file_->length(); }
+
+ private:
+  ~RefCountedMappedFile() override {
+    // Unmapping and closing the file may block, and the last reference is
+    // usually released on the UI thread.
+    task_runner_->DeleteSoon(FROM_HERE, std::move(mapped_file_));
+  }
+
+  std::unique_ptr<base::MemoryMappedFile> mapped_file_;
+  scoped_refptr<base::SequencedTaskRunner> task_runner_;
+};
+
+scoped_refptr<base::RefCountedMemory> MapDataFile(
+    scoped_refptr<base::SequencedTaskRunner> task_runner,
     const base::FilePath& path) {
-  std::string contents;
-  if (!base::ReadFileToString(path, &contents)) {
-    VLOG(2) << __FUNCTION__ << " Failed to read " << path;
+  // Empty files can't be mapped on every platform.
+  int64_t file_size = 0;
+  if (base::GetFileSize(path, &file_size) && file_size == 0) {
+    return base::MakeRefCounted<base::RefCountedBytes>();
+  }
+
+  auto mapped_file = std::make_unique<base::MemoryMappedFile>();
+  if (!mapped_file->Initialize(path)) {
+    VLOG(2) << __FUNCTION__ << " Failed to map " << path;
     return nullptr;
   }
 
-  return base::MakeRefCounted<base::RefCountedBytes>(
-      reinterpret_cast<const unsigned char*>(contents.c_str()),
-      contents.length());
+  return base::MakeRefCounted<RefCountedMappedFile>(std::move(mapped_file),
+                                                    std::move(task_runner));
 }
 
 }  // namespace
 
 PlaylistDataSource::PlaylistDataSource(PlaylistService* service)
-    : service_(service) {}
+    : service_(service),
+      file_task_runner_(
+          base::ThreadPool::CreateSequencedTaskRunner({base::MayBlock()})) {}
 
 PlaylistDataSource::~PlaylistDataSource() = default;
 
@@ -92,8 +130,8 @@ void PlaylistDataSource::StartDataRequest(
 
 void PlaylistDataSource::GetDataFile(const base::FilePath& data_path,
                                      GotDataCallback got_data_callback) {
-  base::ThreadPool::PostTaskAndReplyWithResult(
-      FROM_HERE, base::MayBlock(), base::BindOnce(&ReadFileToString, data_path),
+  file_task_runner_->PostTaskAndReplyWithResult(
+      FROM_HERE, base::BindOnce(&MapDataFile, file_task_runner_, data_path),
       base::BindOnce(&PlaylistDataSource::OnGotDataFile,
                      weak_factory_.GetWeakPtr(), std::move(got_data_callback)));
 }
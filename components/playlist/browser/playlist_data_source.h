@@ -8,7 +8,9 @@
 
 #include <string>
 
+#include "base/memory/scoped_refptr.h"
 #include "base/memory/weak_ptr.h"
+#include "base/task/sequenced_task_runner.h"
 #include "content/public/browser/url_data_source.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
 
@@ -24,7 +26,10 @@ class PlaylistService;
 
 // A URL data source for
 // chrome-untrusted://playlist-data/<playlist-id>/{thumbnail,media}/ resources,
-// for use in webui pages that want to get thumbnails or media data.
+// for use in webui pages that want to get thumbnails or media data. The
+// Playlist pages load media through PlaylistMediaURLLoaderFactory instead,
+// which streams it and answers Range requests, so media is only served from
+// here for other frames.
 class PlaylistDataSource : public content::URLDataSource {
  public:
   explicit PlaylistDataSource(PlaylistService* service);
@@ -41,6 +46,9 @@ class PlaylistDataSource : public content::URLDataSource {
   bool AllowCaching() override;
 
  private:
+  // Maps |data_path| into memory on |file_task_runner_| rather than reading it
+  // onto the heap. Note that the WebUI loader still copies the requested range
+  // out of the mapping, so a request for a whole media file copies all of it.
   void GetDataFile(const base::FilePath& data_path,
                    GotDataCallback got_data_callback);
   void OnGotDataFile(GotDataCallback got_data_callback,
@@ -48,6 +56,9 @@ class PlaylistDataSource : public content::URLDataSource {
 
   raw_ptr<PlaylistService> service_;
 
+  // Maps data files and releases the mappings, which may block.
+  scoped_refptr<base::SequencedTaskRunner> file_task_runner_;
+
   base::WeakPtrFactory<PlaylistDataSource> weak_factory_{this};
 };
 
@@ -8,6 +8,7 @@
 #include <utility>
 
 #include "base/files/file_path.h"
+#include "base/functional/bind.h"
 #include "base/logging.h"
 #include "base/task/sequenced_task_runner.h"
 #include "base/values.h"
@@ -32,8 +33,10 @@ PlaylistMediaFileDownloadManager::PlaylistMediaFileDownloadManager(
     Delegate* delegate)
     : delegate_(delegate) {
   DCHECK(delegate_) << "We don't consider where |delegate| is null";
-  media_file_downloader_ =
-      std::make_unique<PlaylistMediaFileDownloader>(this, context);
+  for (size_t i = 0; i < kMaxConcurrentDownloads; ++i) {
+    media_file_downloaders_.push_back(
+        std::make_unique<PlaylistMediaFileDownloader>(this, context));
+  }
 }
 
 PlaylistMediaFileDownloadManager::~PlaylistMediaFileDownloadManager() = default;
@@ -43,87 +46,139 @@ void PlaylistMediaFileDownloadManager::DownloadMediaFile(
   DCHECK(request);
   DCHECK(request->item);
 
-  pending_media_file_creation_jobs_.push(std::move(request));
+  pending_media_file_creation_jobs_.push_back(std::move(request));
 
-  // If either media file controller is generating a playlist media file,
-  // delay the next playlist generation. It will be triggered when the current
-  // one is finished.
-  if (!IsCurrentDownloadingInProgress())
-    TryStartingDownloadTask();
+  // If all media file downloaders are busy, delay the next playlist
+  // generation. It will be triggered when one of them is finished.
+  TryStartingDownloadTasks();
 }
 
 void PlaylistMediaFileDownloadManager::CancelDownloadRequest(
     const std::string& id) {
   VLOG(2) << __func__ << " " << id;
 
-  // Cancel if currently downloading item is id.
-  // Otherwise, GetNextPlaylistItemTarget() will drop canceled one.
-  if (GetCurrentDownloadingPlaylistItemID() == id) {
-    CancelCurrentDownloadingPlaylistItem();
-    TryStartingDownloadTask();
+  // Cancel if the item is being downloaded.
+  // Otherwise, PopNextJob() will drop canceled one.
+  if (current_jobs_.contains(id)) {
+    CancelDownloadingPlaylistItem(id);
+    TryStartingDownloadTasks();
     return;
   }
 }
 
 void PlaylistMediaFileDownloadManager::CancelAllDownloadRequests() {
-  CancelCurrentDownloadingPlaylistItem();
-  pending_media_file_creation_jobs_ = {};
+  for (auto& downloader : media_file_downloaders_) {
+    downloader->RequestCancelCurrentPlaylistGeneration();
+  }
+  current_jobs_.clear();
+  pending_media_file_creation_jobs_.clear();
 }
 
-void PlaylistMediaFileDownloadManager::TryStartingDownloadTask() {
-  if (IsCurrentDownloadingInProgress())
-    return;
-
-  if (pending_media_file_creation_jobs_.empty())
-    return;
+void PlaylistMediaFileDownloadManager::TryStartingDownloadTasks() {
+  while (current_jobs_.size() < kMaxConcurrentDownloads) {
+    auto* downloader = GetIdleMediaFileDownloader();
+    if (!downloader && !pause_download_for_testing_) {
+      return;
+    }
 
-  current_job_ = PopNextJob();
-  if (!current_job_) {
-    return;
-  }
+    auto job = PopNextJob();
+    if (!job) {
+      return;
+    }
 
-  DCHECK(current_job_->item);
+    DCHECK(job->item);
+    mojom::PlaylistItemPtr item = job->item.Clone();
+    current_jobs_.emplace(item->id, std::move(job));
 
-  if (!pause_download_for_testing_) {
-    VLOG(2) << __func__ << ": " << current_job_->item->name;
-    media_file_downloader_->DownloadMediaFileForPlaylistItem(
-        current_job_->item,
-        delegate_->GetMediaPathForPlaylistItemItem(current_job_->item->id));
+    if (!pause_download_for_testing_) {
+      VLOG(2) << __func__ << ": " << item->name;
+      // This could finish synchronously, so |item| is a copy that outlives the
+      // job.
+      downloader->DownloadMediaFileForPlaylistItem(
+          item, delegate_->GetMediaPathForPlaylistItemItem(item->id));
+    }
   }
 }
 
 std::unique_ptr<PlaylistMediaFileDownloadManager::DownloadJob>
 PlaylistMediaFileDownloadManager::PopNextJob() {
-  while (!pending_media_file_creation_jobs_.empty()) {
-    auto request = std::move(pending_media_file_creation_jobs_.front());
-    DCHECK(request);
-    DCHECK(request->item);
+  auto iter = pending_media_file_creation_jobs_.begin();
+  while (iter != pending_media_file_creation_jobs_.end()) {
+    DCHECK(*iter);
+    DCHECK((*iter)->item);
+
+    // Both downloads would write to the same file, so the job waits until the
+    // ongoing one is finished. The jobs behind it can still start.
+    if (current_jobs_.contains((*iter)->item->id)) {
+      ++iter;
+      continue;
+    }
 
-    pending_media_file_creation_jobs_.pop();
+    auto next_request = std::move(*iter);
+    iter = pending_media_file_creation_jobs_.erase(iter);
 
-    if (delegate_->IsValidPlaylistItem(request->item->id)) {
-      return request;
+    if (delegate_->IsValidPlaylistItem(next_request->item->id)) {
+      return next_request;
     }
   }
 
   return {};
 }
 
-std::string
-PlaylistMediaFileDownloadManager::GetCurrentDownloadingPlaylistItemID() const {
-  if (IsCurrentDownloadingInProgress())
-    return media_file_downloader_->current_playlist_id();
+PlaylistMediaFileDownloader*
+PlaylistMediaFileDownloadManager::GetIdleMediaFileDownloader() {
+  for (auto& downloader : media_file_downloaders_) {
+    if (!downloader->in_progress()) {
+      return downloader.get();
+    }
+  }
 
-  return {};
+  return nullptr;
 }
 
-void PlaylistMediaFileDownloadManager::CancelCurrentDownloadingPlaylistItem() {
-  media_file_downloader_->RequestCancelCurrentPlaylistGeneration();
-  current_job_.reset();
+PlaylistMediaFileDownloader*
+PlaylistMediaFileDownloadManager::GetMediaFileDownloaderForItem(
+    const std::string& id) {
+  for (auto& downloader : media_file_downloaders_) {
+    if (downloader->in_progress() && downloader->current_playlist_id() == id) {
+      return downloader.get();
+    }
+  }
+
+  return nullptr;
 }
 
-bool PlaylistMediaFileDownloadManager::IsCurrentDownloadingInProgress() const {
-  return media_file_downloader_->in_progress();
+void PlaylistMediaFileDownloadManager::CancelDownloadingPlaylistItem(
+    const std::string& id) {
+  if (auto* downloader = GetMediaFileDownloaderForItem(id)) {
+    downloader->RequestCancelCurrentPlaylistGeneration();
+  }
+  current_jobs_.erase(id);
+}
+
+void PlaylistMediaFileDownloadManager::OnDownloadJobFinished(
+    const std::string& id,
+    const std::string& media_file_path) {
+  auto iter = current_jobs_.find(id);
+  if (iter == current_jobs_.end()) {
+    return;
+  }
+
+  auto job = std::move(iter->second);
+  current_jobs_.erase(iter);
+  DCHECK(job->item);
+
+  if (job->on_finish_callback) {
+    std::move(job->on_finish_callback)
+        .Run(std::move(job->item), media_file_path);
+  }
+
+  // The downloader that finished is still busy until this returns.
+  base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
+      FROM_HERE,
+      base::BindOnce(
+          &PlaylistMediaFileDownloadManager::TryStartingDownloadTasks,
+          weak_factory_.GetWeakPtr()));
 }
 
 void PlaylistMediaFileDownloadManager::OnMediaFileDownloadProgressed(
@@ -132,18 +187,15 @@ void PlaylistMediaFileDownloadManager::OnMediaFileDownloadProgressed(
     int64_t received_bytes,
     int percent_complete,
     base::TimeDelta time_remaining) {
-  if (!current_job_ || !current_job_->item) {
-    return;
-  }
-
-  if (current_job_->item->id != id) {
+  auto iter = current_jobs_.find(id);
+  if (iter == current_jobs_.end() || !iter->second->item) {
     return;
   }
 
-  if (current_job_->on_progress_callback) {
-    current_job_->on_progress_callback.Run(current_job_->item, total_bytes,
-                                           received_bytes, percent_complete,
-                                           time_remaining);
+  const auto& job = iter->second;
+  if (job->on_progress_callback) {
+    job->on_progress_callback.Run(job->item, total_bytes, received_bytes,
+                                  percent_complete, time_remaining);
   }
 }
 
@@ -151,48 +203,13 @@ void PlaylistMediaFileDownloadManager::OnMediaFileReady(
     const std::string& id,
     const std::string& media_file_path) {
   VLOG(2) << __func__ << ": " << id << " is ready.";
-  if (!current_job_ || !current_job_->item) {
-    return;
-  }
-
-  if (current_job_->item->id != id) {
-    return;
-  }
-
-  if (current_job_->on_finish_callback) {
-    std::move(current_job_->on_finish_callback)
-        .Run(std::move(current_job_->item), media_file_path);
-  }
-  current_job_.reset();
-
-  base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
-      FROM_HERE,
-      base::BindOnce(&PlaylistMediaFileDownloadManager::TryStartingDownloadTask,
-                     weak_factory_.GetWeakPtr()));
+  OnDownloadJobFinished(id, media_file_path);
 }
 
 void PlaylistMediaFileDownloadManager::OnMediaFileGenerationFailed(
     const std::string& id) {
   VLOG(2) << __func__ << ": " << id;
-  if (!current_job_ || !current_job_->item) {
-    return;
-  }
-
-  if (current_job_->item && current_job_->item->id != id) {
-    return;
-  }
-
-  if (current_job_->on_finish_callback) {
-    std::move(current_job_->on_finish_callback)
-        .Run(std::move(current_job_->item), {});
-  }
-  current_job_.reset();
-  CancelCurrentDownloadingPlaylistItem();
-
-  base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
-      FROM_HERE,
-      base::BindOnce(&PlaylistMediaFileDownloadManager::TryStartingDownloadTask,
-                     weak_factory_.GetWeakPtr()));
+  OnDownloadJobFinished(id, {});
 }
 
 base::SequencedTaskRunner* PlaylistMediaFileDownloadManager::GetTaskRunner() {
@@ -8,8 +8,10 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
-#include "base/containers/queue.h"
+#include "base/containers/flat_map.h"
+#include "base/containers/circular_deque.h"
 #include "base/gtest_prod_util.h"
 #include "brave/components/playlist/browser/playlist_media_file_downloader.h"
 #include "brave/components/playlist/common/mojom/playlist.mojom.h"
@@ -21,12 +23,14 @@ class BrowserContext;
 namespace playlist {
 
 // Download youtube playlist item's audio/video media files.
-// This handles one request at once. So, it has pending queue.
-// And PlaylistMediaFileDownloader does file download task.
-// TODO(simonhong): Download multiple media files simultaneously.
+// This handles up to |kMaxConcurrentDownloads| requests at once and keeps the
+// others in a pending queue. Each PlaylistMediaFileDownloader does one file
+// download task at a time.
 class PlaylistMediaFileDownloadManager
     : public PlaylistMediaFileDownloader::Delegate {
  public:
+  static constexpr size_t kMaxConcurrentDownloads = 3;
+
   struct DownloadJob {
     // This struct is move-only type.
     DownloadJob();
@@ -76,10 +80,14 @@ class PlaylistMediaFileDownloadManager
   void CancelDownloadRequest(const std::string& id);
   void CancelAllDownloadRequests();
 
-  bool has_download_requests() const { return !!current_job_; }
+  bool has_download_requests() const { return !current_jobs_.empty(); }
 
  private:
   FRIEND_TEST_ALL_PREFIXES(PlaylistServiceUnitTest, ResetAll);
+  FRIEND_TEST_ALL_PREFIXES(PlaylistServiceUnitTest,
+                           DownloadMediaFilesConcurrently);
+  FRIEND_TEST_ALL_PREFIXES(PlaylistServiceUnitTest,
+                           DownloadQueueSkipsItemsInFlight);
 
   // PlaylistMediaFileDownloader::Delegate overrides:
   void OnMediaFileDownloadProgressed(const std::string& id,
@@ -92,18 +100,24 @@ class PlaylistMediaFileDownloadManager
   void OnMediaFileGenerationFailed(const std::string& id) override;
   base::SequencedTaskRunner* GetTaskRunner() override;
 
-  void TryStartingDownloadTask();
+  void TryStartingDownloadTasks();
   std::unique_ptr<DownloadJob> PopNextJob();
-  std::string GetCurrentDownloadingPlaylistItemID() const;
-  void CancelCurrentDownloadingPlaylistItem();
-  bool IsCurrentDownloadingInProgress() const;
+  PlaylistMediaFileDownloader* GetIdleMediaFileDownloader();
+  PlaylistMediaFileDownloader* GetMediaFileDownloaderForItem(
+      const std::string& id);
+  void CancelDownloadingPlaylistItem(const std::string& id);
+  void OnDownloadJobFinished(const std::string& id,
+                             const std::string& media_file_path);
 
   raw_ptr<Delegate> delegate_;
-  base::queue<std::unique_ptr<DownloadJob>> pending_media_file_creation_jobs_;
+  base::circular_deque<std::unique_ptr<DownloadJob>>
+      pending_media_file_creation_jobs_;
 
-  std::unique_ptr<DownloadJob> current_job_;
+  // Jobs being downloaded, keyed by playlist item id.
+  base::flat_map<std::string, std::unique_ptr<DownloadJob>> current_jobs_;
 
-  std::unique_ptr<PlaylistMediaFileDownloader> media_file_downloader_;
+  std::vector<std::unique_ptr<PlaylistMediaFileDownloader>>
+      media_file_downloaders_;
 
   bool pause_download_for_testing_ = false;
 
@@ -14,8 +14,10 @@
 #include "base/functional/bind.h"
 #include "base/json/json_reader.h"
 #include "base/json/json_writer.h"
+#include "base/ranges/algorithm.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/task/sequenced_task_runner.h"
 #include "base/task/thread_pool.h"
 #include "brave/components/playlist/browser/playlist_constants.h"
 #include "build/build_config.h"
@@ -72,6 +74,10 @@ constexpr auto kMimeTypeToExtension =
 
 namespace {
 
+// How many times an interrupted download is continued from the bytes already
+// on disk before the item is considered failed.
+constexpr int kMaxResumeAttempts = 5;
+
 net::NetworkTrafficAnnotationTag GetNetworkTrafficAnnotationTagForURLLoad() {
   return net::DefineNetworkTrafficAnnotation("playlist_service", R"(
       semantics {
@@ -177,7 +183,7 @@ void PlaylistMediaFileDownloader::DownloadMediaFileForPlaylistItem(
 
   if (item->cached) {
     DVLOG(2) << __func__ << ": media file is already downloaded";
-    NotifySucceed(current_item_->id, current_item_->media_path.spec());
+    NotifySucceed(item->id, item->media_path.spec());
     return;
   }
 
@@ -223,18 +229,19 @@ void PlaylistMediaFileDownloader::OnDownloadCreated(
 
 void PlaylistMediaFileDownloader::OnDownloadUpdated(
     download::DownloadItem* item) {
-  if (!current_item_) {
-    // Download could be already finished. This seems to be late async callback.
+  if (!current_item_ || current_item_->id != item->GetGuid()) {
+    // Download could be already finished or canceled. This seems to be late
+    // async callback.
     return;
   }
 
-  if (item->GetLastReason() !=
-      download::DownloadInterruptReason::DOWNLOAD_INTERRUPT_REASON_NONE) {
-    LOG(ERROR) << __func__ << ": Download interrupted - reason: "
-               << download::DownloadInterruptReasonToString(
-                      item->GetLastReason());
-    ScheduleToDetachCachedFile(item);
-    OnMediaFileDownloaded({}, {});
+  if (item->GetState() == download::DownloadItem::INTERRUPTED) {
+    // The download system continues or restarts some interrupted downloads by
+    // itself right after notifying observers, so decide once that's done.
+    base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
+        FROM_HERE,
+        base::BindOnce(&PlaylistMediaFileDownloader::OnDownloadInterrupted,
+                       weak_factory_.GetWeakPtr(), item->GetGuid()));
     return;
   }
 
@@ -257,6 +264,36 @@ void PlaylistMediaFileDownloader::OnDownloadUpdated(
   }
 }
 
+void PlaylistMediaFileDownloader::OnDownloadInterrupted(
+    const std::string& guid) {
+  if (!current_item_ || current_item_->id != guid) {
+    return;
+  }
+
+  auto* item = download_manager_->GetDownloadByGuid(guid);
+  if (!item || item->GetState() != download::DownloadItem::INTERRUPTED) {
+    return;
+  }
+
+  // Resuming sends a range request for the rest of the file when the server
+  // supports it, and restarts the download otherwise.
+  if (item->CanResume() && resume_attempts_ < kMaxResumeAttempts) {
+    ++resume_attempts_;
+    VLOG(2) << __func__ << ": Resuming " << guid << " after "
+            << item->GetReceivedBytes() << " bytes - reason: "
+            << download::DownloadInterruptReasonToString(
+                   item->GetLastReason());
+    item->Resume(/*user_resume=*/false);
+    return;
+  }
+
+  LOG(ERROR) << __func__ << ": Download interrupted - reason: "
+             << download::DownloadInterruptReasonToString(
+                    item->GetLastReason());
+  ScheduleToDetachCachedFile(item);
+  OnMediaFileDownloaded({}, {});
+}
+
 void PlaylistMediaFileDownloader::OnRenameFile(const base::FilePath& new_path,
                                                bool result) {
   if (result) {
@@ -326,7 +363,31 @@ void PlaylistMediaFileDownloader::OnMediaFileDownloaded(
 }
 
 void PlaylistMediaFileDownloader::RequestCancelCurrentPlaylistGeneration() {
+  if (!current_item_ || !download_manager_) {
+    ResetDownloadStatus();
+    return;
+  }
+
+  auto* item = download_manager_->GetDownloadByGuid(current_item_->id);
+  // Reset first, so that the updates caused by canceling the item below are
+  // ignored.
   ResetDownloadStatus();
+  if (!item || base::ranges::any_of(download_items_to_be_detached_,
+                                    [item](const auto& download) {
+                                      return download.get() == item;
+                                    })) {
+    // Either not created yet or already scheduled to be detached.
+    return;
+  }
+
+  // Interrupted downloads that can't be resumed are done already, and the
+  // pending OnDownloadInterrupted() ignores them after the reset above, so
+  // they're detached here as well.
+  if (!item->IsDone()) {
+    // Stops the transfer and drops the partially written file.
+    item->Cancel(/*user_cancel=*/true);
+  }
+  ScheduleToDetachCachedFile(item);
 }
 
 base::SequencedTaskRunner* PlaylistMediaFileDownloader::task_runner() {
@@ -340,6 +401,7 @@ base::SequencedTaskRunner* PlaylistMediaFileDownloader::task_runner() {
 
 void PlaylistMediaFileDownloader::ResetDownloadStatus() {
   in_progress_ = false;
+  resume_attempts_ = 0;
   current_item_.reset();
   destination_path_.clear();
 }
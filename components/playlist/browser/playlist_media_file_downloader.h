@@ -42,7 +42,8 @@ class GURL;
 
 namespace playlist {
 
-// Handle one Playlist at once.
+// Downloads one playlist item's media file at a time. Interrupted downloads are
+// resumed from the bytes already written a few times before giving up.
 class PlaylistMediaFileDownloader
     : public download::SimpleDownloadManager::Observer,
       public download::DownloadItem::Observer {
@@ -95,6 +96,7 @@ class PlaylistMediaFileDownloader
  private:
   void ResetDownloadStatus();
   void DownloadMediaFile(const GURL& url);
+  void OnDownloadInterrupted(const std::string& guid);
   void OnMediaFileDownloaded(const std::string& mime_type, base::FilePath path);
   void OnRenameFile(const base::FilePath& new_path, bool result);
 
@@ -127,6 +129,9 @@ class PlaylistMediaFileDownloader
   // true when this class is working for playlist now.
   bool in_progress_ = false;
 
+  // How many times the current download was resumed after an interruption.
+  int resume_attempts_ = 0;
+
   scoped_refptr<base::SequencedTaskRunner> task_runner_;
 
   base::WeakPtrFactory<PlaylistMediaFileDownloader> weak_factory_{this};
@@ -0,0 +1,304 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/playlist/browser/playlist_media_url_loader_factory.h"
+
+#include <inttypes.h>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "base/files/file.h"
+#include "base/files/file_path.h"
+#include "base/functional/bind.h"
+#include "base/location.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_split.h"
+#include "base/strings/stringprintf.h"
+#include "base/task/thread_pool.h"
+#include "brave/components/playlist/browser/playlist_service.h"
+#include "content/public/common/url_constants.h"
+#include "mojo/public/cpp/bindings/receiver.h"
+#include "mojo/public/cpp/system/data_pipe.h"
+#include "mojo/public/cpp/system/data_pipe_producer.h"
+#include "mojo/public/cpp/system/file_data_source.h"
+#include "net/base/net_errors.h"
+#include "net/http/http_byte_range.h"
+#include "net/http/http_request_headers.h"
+#include "net/http/http_response_headers.h"
+#include "net/http/http_util.h"
+#include "services/network/public/cpp/resource_request.h"
+#include "services/network/public/cpp/url_loader_completion_status.h"
+#include "services/network/public/mojom/url_loader.mojom.h"
+#include "services/network/public/mojom/url_response_head.mojom.h"
+#include "url/gurl.h"
+
+namespace playlist {
+
+namespace {
+
+constexpr char kPlaylistDataHost[] = "playlist-data";
+
+// TODO(sko) Decide mime type based on the file extension.
+constexpr char kMediaMimeType[] = "video/mp4";
+
+struct MediaFile {
+  base::File file;
+  int64_t length = -1;
+};
+
+MediaFile OpenMediaFile(const base::FilePath& path) {
+  MediaFile media_file;
+  media_file.file =
+      base::File(path, base::File::FLAG_OPEN | base::File::FLAG_READ);
+  if (media_file.file.IsValid()) {
+    media_file.length = media_file.file.GetLength();
+  }
+  return media_file;
+}
+
+// Writes the requested bytes of a media file to the response body. Owns
+// itself until the body is written and the loader is released.
+class MediaURLLoader : public network::mojom::URLLoader {
+ public:
+  static void CreateAndStart(
+      const net::HttpRequestHeaders& request_headers,
+      mojo::PendingReceiver<network::mojom::URLLoader> loader,
+      mojo::PendingRemote<network::mojom::URLLoaderClient> client,
+      MediaFile media_file) {
+    auto* media_loader =
+        new MediaURLLoader(std::move(loader), std::move(client));
+    media_loader->Start(request_headers, std::move(media_file));
+  }
+
+  MediaURLLoader(const MediaURLLoader&) = delete;
+  MediaURLLoader& operator=(const MediaURLLoader&) = delete;
+
+  // network::mojom::URLLoader:
+  void FollowRedirect(
+      const std::vector<std::string>& removed_headers,
+      const net::HttpRequestHeaders& modified_headers,
+      const net::HttpRequestHeaders& modified_cors_exempt_headers,
+      const absl::optional<GURL>& new_url) override {}
+  void SetPriority(net::RequestPriority priority,
+                   int32_t intra_priority_value) override {}
+  void PauseReadingBodyFromNet() override {}
+  void ResumeReadingBodyFromNet() override {}
+
+ private:
+  MediaURLLoader(mojo::PendingReceiver<network::mojom::URLLoader> loader,
+                 mojo::PendingRemote<network::mojom::URLLoaderClient> client)
+      : receiver_(this, std::move(loader)), client_(std::move(client)) {
+    receiver_.set_disconnect_handler(base::BindOnce(
+        &MediaURLLoader::OnMojoDisconnect, base::Unretained(this)));
+  }
+  ~MediaURLLoader() override = default;
+
+  void Start(const net::HttpRequestHeaders& request_headers,
+             MediaFile media_file) {
+    if (!media_file.file.IsValid() || media_file.length < 0) {
+      Complete(net::ERR_FILE_NOT_FOUND);
+      return;
+    }
+
+    const int64_t length = media_file.length;
+    int64_t first_byte = 0;
+    int64_t last_byte = length - 1;
+    bool partial = false;
+    std::string range_header;
+    if (request_headers.GetHeader(net::HttpRequestHeaders::kRange,
+                                  &range_header)) {
+      // Multiple ranges would need a multipart response, which media elements
+      // don't ask for.
+      std::vector<net::HttpByteRange> ranges;
+      if (!net::HttpUtil::ParseRangeHeader(range_header, &ranges) ||
+          ranges.size() != 1 || !ranges[0].ComputeBounds(length)) {
+        Complete(net::ERR_REQUEST_RANGE_NOT_SATISFIABLE);
+        return;
+      }
+      first_byte = ranges[0].first_byte_position();
+      last_byte = ranges[0].last_byte_position();
+      partial = true;
+    }
+    const int64_t body_length = last_byte - first_byte + 1;
+
+    auto head = network::mojom::URLResponseHead::New();
+    head->headers = base::MakeRefCounted<net::HttpResponseHeaders>(
+        net::HttpUtil::AssembleRawHeaders(partial
+                                              ? "HTTP/1.1 206 Partial Content"
+                                              : "HTTP/1.1 200 OK"));
+    head->headers->AddHeader(net::HttpRequestHeaders::kContentType,
+                             kMediaMimeType);
+    head->headers->AddHeader("Accept-Ranges", "bytes");
+    head->headers->AddHeader(net::HttpRequestHeaders::kContentLength,
+                             base::NumberToString(body_length));
+    if (partial) {
+      head->headers->AddHeader(
+          "Content-Range",
+          base::StringPrintf("bytes %" PRId64 "-%" PRId64 "/%" PRId64,
+                             first_byte, last_byte, length));
+    }
+    head->mime_type = kMediaMimeType;
+    head->content_length = body_length;
+
+    mojo::ScopedDataPipeProducerHandle producer;
+    mojo::ScopedDataPipeConsumerHandle consumer;
+    if (mojo::CreateDataPipe(PlaylistMediaURLLoaderFactory::kMediaChunkSize,
+                             producer, consumer) != MOJO_RESULT_OK) {
+      Complete(net::ERR_INSUFFICIENT_RESOURCES);
+      return;
+    }
+    client_->OnReceiveResponse(std::move(head), std::move(consumer),
+                               absl::nullopt);
+
+    if (!body_length) {
+      OnFileWritten(body_length, MOJO_RESULT_OK);
+      return;
+    }
+
+    // The file is read on a blocking sequence of the producer, no more than
+    // the free space of the data pipe at a time, so only |kMediaChunkSize|
+    // bytes are in memory however large the requested range is.
+    auto source = std::make_unique<mojo::FileDataSource>(
+        std::move(media_file.file));
+    source->SetRange(first_byte, last_byte + 1);
+    data_producer_ =
+        std::make_unique<mojo::DataPipeProducer>(std::move(producer));
+    data_producer_->Write(
+        std::move(source),
+        base::BindOnce(&MediaURLLoader::OnFileWritten,
+                       weak_factory_.GetWeakPtr(), body_length));
+  }
+
+  void OnFileWritten(int64_t body_length, MojoResult result) {
+    data_producer_.reset();
+    if (result != MOJO_RESULT_OK) {
+      // The body consumer went away, e.g. when the media element seeks.
+      Complete(net::ERR_FAILED);
+      return;
+    }
+
+    network::URLLoaderCompletionStatus status(net::OK);
+    status.encoded_data_length = body_length;
+    status.encoded_body_length = body_length;
+    status.decoded_body_length = body_length;
+    client_->OnComplete(status);
+    client_.reset();
+    MaybeDeleteSelf();
+  }
+
+  void Complete(net::Error error) {
+    client_->OnComplete(network::URLLoaderCompletionStatus(error));
+    client_.reset();
+    MaybeDeleteSelf();
+  }
+
+  void OnMojoDisconnect() {
+    receiver_.reset();
+    MaybeDeleteSelf();
+  }
+
+  void MaybeDeleteSelf() {
+    if (!receiver_.is_bound() && !client_.is_bound()) {
+      delete this;
+    }
+  }
+
+  mojo::Receiver<network::mojom::URLLoader> receiver_;
+  mojo::Remote<network::mojom::URLLoaderClient> client_;
+  std::unique_ptr<mojo::DataPipeProducer> data_producer_;
+
+  base::WeakPtrFactory<MediaURLLoader> weak_factory_{this};
+};
+
+}  // namespace
+
+// static
+mojo::PendingRemote<network::mojom::URLLoaderFactory>
+PlaylistMediaURLLoaderFactory::Create(
+    base::WeakPtr<PlaylistService> service,
+    mojo::PendingRemote<network::mojom::URLLoaderFactory> fallback_factory) {
+  mojo::PendingRemote<network::mojom::URLLoaderFactory> pending_remote;
+
+  // The factory deletes itself when it has no receivers left.
+  new PlaylistMediaURLLoaderFactory(
+      std::move(service), std::move(fallback_factory),
+      pending_remote.InitWithNewPipeAndPassReceiver());
+
+  return pending_remote;
+}
+
+// static
+bool PlaylistMediaURLLoaderFactory::GetMediaItemId(const GURL& url,
+                                                   std::string* id) {
+  DCHECK(id);
+  if (!url.SchemeIs(content::kChromeUIUntrustedScheme) ||
+      url.host_piece() != kPlaylistDataHost) {
+    return false;
+  }
+
+  // "/<id>/media", with or without a trailing slash.
+  const auto components = base::SplitStringPiece(
+      url.path_piece(), "/", base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY);
+  if (components.size() != 2 || components[1] != "media") {
+    return false;
+  }
+
+  *id = std::string(components[0]);
+  return true;
+}
+
+PlaylistMediaURLLoaderFactory::PlaylistMediaURLLoaderFactory(
+    base::WeakPtr<PlaylistService> service,
+    mojo::PendingRemote<network::mojom::URLLoaderFactory> fallback_factory,
+    mojo::PendingReceiver<network::mojom::URLLoaderFactory> factory_receiver)
+    : network::SelfDeletingURLLoaderFactory(std::move(factory_receiver)),
+      service_(std::move(service)) {
+  if (fallback_factory) {
+    fallback_factory_.Bind(std::move(fallback_factory));
+  }
+}
+
+PlaylistMediaURLLoaderFactory::~PlaylistMediaURLLoaderFactory() = default;
+
+void PlaylistMediaURLLoaderFactory::CreateLoaderAndStart(
+    mojo::PendingReceiver<network::mojom::URLLoader> loader,
+    int32_t request_id,
+    uint32_t options,
+    const network::ResourceRequest& request,
+    mojo::PendingRemote<network::mojom::URLLoaderClient> client,
+    const net::MutableNetworkTrafficAnnotationTag& traffic_annotation) {
+  std::string id;
+  if (!GetMediaItemId(request.url, &id)) {
+    if (fallback_factory_) {
+      fallback_factory_->CreateLoaderAndStart(
+          std::move(loader), request_id, options, request, std::move(client),
+          traffic_annotation);
+      return;
+    }
+    mojo::Remote<network::mojom::URLLoaderClient>(std::move(client))
+        ->OnComplete(network::URLLoaderCompletionStatus(net::ERR_FAILED));
+    return;
+  }
+
+  base::FilePath media_path;
+  if (!service_ || !service_->GetMediaPath(id, &media_path)) {
+    mojo::Remote<network::mojom::URLLoaderClient>(std::move(client))
+        ->OnComplete(
+            network::URLLoaderCompletionStatus(net::ERR_FILE_NOT_FOUND));
+    return;
+  }
+
+  // Opening the file may block.
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_BLOCKING},
+      base::BindOnce(&OpenMediaFile, media_path),
+      base::BindOnce(&MediaURLLoader::CreateAndStart, request.headers,
+                     std::move(loader), std::move(client)));
+}
+
+}  // namespace playlist
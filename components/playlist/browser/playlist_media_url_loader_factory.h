@@ -0,0 +1,77 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_PLAYLIST_BROWSER_PLAYLIST_MEDIA_URL_LOADER_FACTORY_H_
+#define BRAVE_COMPONENTS_PLAYLIST_BROWSER_PLAYLIST_MEDIA_URL_LOADER_FACTORY_H_
+
+#include <stdint.h>
+
+#include <string>
+
+#include "base/memory/weak_ptr.h"
+#include "mojo/public/cpp/bindings/pending_receiver.h"
+#include "mojo/public/cpp/bindings/pending_remote.h"
+#include "mojo/public/cpp/bindings/remote.h"
+#include "services/network/public/cpp/self_deleting_url_loader_factory.h"
+#include "services/network/public/mojom/url_loader_factory.mojom.h"
+
+class GURL;
+
+namespace playlist {
+
+class PlaylistService;
+
+// Serves chrome-untrusted://playlist-data/<id>/media by streaming the media
+// file of the item into the response body, |kMediaChunkSize| bytes at a time,
+// and answers Range requests with only the requested bytes. Media elements
+// seek with Range requests, which PlaylistDataSource can't answer without
+// loading the whole file first.
+//
+// Every other request, e.g. for thumbnails, is passed on to the factory that
+// was registered for chrome-untrusted:// before.
+class PlaylistMediaURLLoaderFactory
+    : public network::SelfDeletingURLLoaderFactory {
+ public:
+  // The capacity of the data pipe of a response, which bounds how much of a
+  // media file is read into memory at once.
+  static constexpr uint32_t kMediaChunkSize = 512 * 1024;
+
+  static mojo::PendingRemote<network::mojom::URLLoaderFactory> Create(
+      base::WeakPtr<PlaylistService> service,
+      mojo::PendingRemote<network::mojom::URLLoaderFactory> fallback_factory);
+
+  // Returns the id of the item if |url| is the media of a playlist item.
+  static bool GetMediaItemId(const GURL& url, std::string* id);
+
+  PlaylistMediaURLLoaderFactory(const PlaylistMediaURLLoaderFactory&) =
+      delete;
+  PlaylistMediaURLLoaderFactory& operator=(
+      const PlaylistMediaURLLoaderFactory&) = delete;
+
+ private:
+  PlaylistMediaURLLoaderFactory(
+      base::WeakPtr<PlaylistService> service,
+      mojo::PendingRemote<network::mojom::URLLoaderFactory> fallback_factory,
+      mojo::PendingReceiver<network::mojom::URLLoaderFactory>
+          factory_receiver);
+  ~PlaylistMediaURLLoaderFactory() override;
+
+  // network::mojom::URLLoaderFactory:
+  void CreateLoaderAndStart(
+      mojo::PendingReceiver<network::mojom::URLLoader> loader,
+      int32_t request_id,
+      uint32_t options,
+      const network::ResourceRequest& request,
+      mojo::PendingRemote<network::mojom::URLLoaderClient> client,
+      const net::MutableNetworkTrafficAnnotationTag& traffic_annotation)
+      override;
+
+  base::WeakPtr<PlaylistService> service_;
+  mojo::Remote<network::mojom::URLLoaderFactory> fallback_factory_;
+};
+
+}  // namespace playlist
+
+#endif  // BRAVE_COMPONENTS_PLAYLIST_BROWSER_PLAYLIST_MEDIA_URL_LOADER_FACTORY_H_
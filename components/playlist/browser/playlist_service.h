@@ -215,6 +215,10 @@ class PlaylistService : public KeyedService,
   FRIEND_TEST_ALL_PREFIXES(PlaylistServiceUnitTest,
                            CleanUpOrphanedPlaylistItemDirs);
   FRIEND_TEST_ALL_PREFIXES(PlaylistServiceUnitTest, MediaFileExtension);
+  FRIEND_TEST_ALL_PREFIXES(PlaylistServiceUnitTest,
+                           DownloadMediaFilesConcurrently);
+  FRIEND_TEST_ALL_PREFIXES(PlaylistServiceUnitTest,
+                           DownloadQueueSkipsItemsInFlight);
   FRIEND_TEST_ALL_PREFIXES(PlaylistServiceWithFakeUAUnitTest,
                            ShouldAlwaysGetMediaFromBackgroundWebContents);
 
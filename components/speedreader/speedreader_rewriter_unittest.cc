@@ -3,6 +3,7 @@
  * License, v. 2.0. If a copy of the MPL was not distributed with this file,
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
+#include <algorithm>
 #include <string>
 
 #include "base/files/file_enumerator.h"
@@ -55,6 +56,22 @@ class SpeedreaderRewriterTestBase : public ::testing::Test {
     return rewriter->GetOutput();
   }
 
+  // Writes the page the way it arrives from the network, a chunk at a time.
+  std::string ProcessPageInChunks(const std::string& file_name,
+                                  size_t chunk_size) {
+    auto rewriter = speedreader_.MakeRewriter("https://test.com");
+    rewriter->SetMinOutLength(100);
+    const auto file_content = GetFileContent(file_name);
+    for (size_t offset = 0; offset < file_content.size();
+         offset += chunk_size) {
+      const size_t length =
+          std::min(chunk_size, file_content.size() - offset);
+      rewriter->Write(file_content.data() + offset, length);
+    }
+    rewriter->End();
+    return rewriter->GetOutput();
+  }
+
   void CheckContent(const std::string& expected_content,
                     const std::string& filename) {
     EXPECT_EQ(GetFileContent(filename), expected_content) << expected_content;
@@ -99,6 +116,17 @@ TEST_P(SpeedreaderRewriterTest, Check) {
   CheckContent(out, expected_file);
 }
 
+TEST_P(SpeedreaderRewriterTest, CheckChunked) {
+  base::ScopedAllowBlockingForTesting allow_blocking;
+
+  const std::string input_file = std::string(GetParam()).append(".html");
+  const std::string expected_file =
+      std::string(GetParam()).append(".expected.html");
+
+  const auto out = ProcessPageInChunks(input_file, 64);
+  CheckContent(out, expected_file);
+}
+
 class SpeedreaderRewriterThemeTest : public SpeedreaderRewriterTestBase {};
 
 TEST_F(SpeedreaderRewriterThemeTest, SetTheme) {
@@ -97,21 +97,28 @@ SpeedReaderURLLoader::SpeedReaderURLLoader(
       response_url_(response_url),
       rewriter_service_(rewriter_service),
       speedreader_service_(speedreader_service),
-      distillation_result_(DistillationResult::kNone) {}
+      distillation_result_(DistillationResult::kNone) {
+  if (rewriter_service_ && speedreader_service_) {
+    distiller_ = std::make_unique<StreamingDistiller>(
+        response_url_, speedreader_service_, rewriter_service_);
+  }
+}
 
 SpeedReaderURLLoader::~SpeedReaderURLLoader() = default;
 
 void SpeedReaderURLLoader::OnBodyReadable(MojoResult) {
   DCHECK_EQ(State::kLoading, state_);
 
+  const size_t start_size = buffered_body_.size();
   if (!BodySnifferURLLoader::CheckBufferedBody(kReadBufferSize)) {
     return;
   }
 
-  // TODO(iefremov): We actually can partially |pumpContent| to speedreader,
-  // but skipping it for now to simplify things. Pumping is not free in terms
-  // of CPU ticks, so we will have to keep alive speedreader instance on another
-  // thread.
+  // Pump the new bytes to the rewriter while the rest of the body loads. The
+  // body is still buffered in case the page can't be distilled.
+  if (distiller_) {
+    distiller_->Write(buffered_body_.substr(start_size));
+  }
 
   body_consumer_watcher_.ArmOrNotify();
 }
@@ -127,7 +134,7 @@ void SpeedReaderURLLoader::OnBodyWritable(MojoResult r) {
 
 void SpeedReaderURLLoader::CompleteLoading(std::string body) {
   DCHECK_EQ(State::kLoading, state_);
-  if (!throttle_ || !rewriter_service_) {
+  if (!throttle_ || !distiller_) {
     Abort();
     return;
   }
@@ -136,8 +143,8 @@ void SpeedReaderURLLoader::CompleteLoading(std::string body) {
   bytes_remaining_in_buffer_ = body.size();
 
   if (bytes_remaining_in_buffer_ > 0) {
-    speedreader::DistillPage(
-        response_url_, std::move(body), speedreader_service_, rewriter_service_,
+    distiller_->Finish(
+        std::move(body),
         base::BindOnce(
             [](base::WeakPtr<SpeedReaderURLLoader> self, const GURL& url,
                const std::string& stylesheet,
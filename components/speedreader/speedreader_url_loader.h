@@ -6,6 +6,7 @@
 #ifndef BRAVE_COMPONENTS_SPEEDREADER_SPEEDREADER_URL_LOADER_H_
 #define BRAVE_COMPONENTS_SPEEDREADER_SPEEDREADER_URL_LOADER_H_
 
+#include <memory>
 #include <string>
 #include <tuple>
 
@@ -31,6 +32,7 @@ class SpeedreaderRewriterService;
 class SpeedreaderService;
 class SpeedReaderThrottle;
 class SpeedreaderThrottleDelegate;
+class StreamingDistiller;
 
 // Loads the whole response body and tries to Speedreader-distill it.
 // Cargoculted from |`SniffingURLLoader|.
@@ -44,11 +46,12 @@ class SpeedreaderThrottleDelegate;
 //               state is changed to kLoading. Otherwise the state goes to
 //               kCompleted.
 // kLoading: Receives the body from the source loader and distills the page.
-//            The received body is kept in this loader until distilling
-//            is finished. When all body has been received and distilling is
-//            done, this loader will dispatch queued messages like
-//            OnStartLoadingResponseBody() to the destination
-//            loader client, and then the state is changed to kSending.
+//           Each received chunk is pumped to the rewriter on a worker
+//           sequence right away, and the body is also kept in this loader
+//           until distilling is finished. When all body has been received
+//           and distilling is done, this loader will dispatch queued
+//           messages like OnStartLoadingResponseBody() to the destination
+//           loader client, and then the state is changed to kSending.
 // kSending: Receives the body and sends it to the destination loader client.
 //           The state changes to kCompleted after all data is sent.
 // kCompleted: All data has been sent to the destination loader.
@@ -97,6 +100,8 @@ class SpeedReaderURLLoader : public body_sniffer::BodySnifferURLLoader {
 
   DistillationResult distillation_result_;
 
+  std::unique_ptr<StreamingDistiller> distiller_;
+
   base::WeakPtrFactory<SpeedReaderURLLoader> weak_factory_{this};
 };
 
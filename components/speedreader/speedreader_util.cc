@@ -11,8 +11,10 @@
 
 #include "base/feature_list.h"
 #include "base/metrics/histogram_macros.h"
+#include "base/task/sequenced_task_runner.h"
 #include "base/task/task_traits.h"
 #include "base/task/thread_pool.h"
+#include "base/time/time.h"
 #include "brave/components/speedreader/common/features.h"
 #include "brave/components/speedreader/rust/ffi/speedreader.h"
 #include "brave/components/speedreader/speedreader_rewriter_service.h"
@@ -72,17 +74,50 @@ bool IsSpeedreaderPanelV2Enabled() {
   return base::FeatureList::IsEnabled(speedreader::kSpeedreaderPanelV2);
 }
 
+namespace {
+
+struct Result {
+  DistillationResult result;
+  std::string body;
+  std::string transformed;
+};
+
+// Finishes distilling |data| once all of it has been written to |rewriter|.
+Result EndDistill(Rewriter* rewriter, std::string data) {
+  rewriter->End();
+  const std::string& transformed = rewriter->GetOutput();
+
+  // If the distillation failed, the rewriter returns an empty string. Also,
+  // if the output is too small, we assume that the content of the distilled
+  // page does not contain enough text to read.
+  if (transformed.length() < 1024) {
+    return {DistillationResult::kFail, std::move(data), std::string()};
+  }
+  return {DistillationResult::kSuccess, std::move(data), transformed};
+}
+
+void ReturnResult(DistillationResultCallback callback, Result r) {
+  std::move(callback).Run(r.result, r.body, r.transformed);
+}
+
+std::unique_ptr<Rewriter> MakeRewriter(
+    const GURL& url,
+    SpeedreaderService* speedreader_service,
+    SpeedreaderRewriterService* rewriter_service) {
+  return rewriter_service->MakeRewriter(
+      url, speedreader_service->GetThemeName(),
+      speedreader_service->GetFontFamilyName(),
+      speedreader_service->GetFontSizeName(),
+      speedreader_service->GetContentStyleName());
+}
+
+}  // namespace
+
 void DistillPage(const GURL& url,
                  std::string body,
                  SpeedreaderService* speedreader_service,
                  SpeedreaderRewriterService* rewriter_service,
                  DistillationResultCallback callback) {
-  struct Result {
-    DistillationResult result;
-    std::string body;
-    std::string transformed;
-  };
-
   auto distill = [](const GURL& url, std::string data,
                     std::unique_ptr<Rewriter> rewriter) -> Result {
     SCOPED_UMA_HISTOGRAM_TIMER("Brave.Speedreader.Distill");
@@ -92,32 +127,87 @@ void DistillPage(const GURL& url,
       return {DistillationResult::kFail, std::move(data), std::string()};
     }
 
-    rewriter->End();
-    const std::string& transformed = rewriter->GetOutput();
-
-    // If the distillation failed, the rewriter returns an empty string. Also,
-    // if the output is too small, we assume that the content of the distilled
-    // page does not contain enough text to read.
-    if (transformed.length() < 1024) {
-      return {DistillationResult::kFail, std::move(data), std::string()};
-    }
-    return {DistillationResult::kSuccess, std::move(data), transformed};
-  };
-
-  auto return_result = [](DistillationResultCallback callback, Result r) {
-    std::move(callback).Run(r.result, r.body, r.transformed);
+    return EndDistill(rewriter.get(), std::move(data));
   };
 
-  auto rewriter = rewriter_service->MakeRewriter(
-      url, speedreader_service->GetThemeName(),
-      speedreader_service->GetFontFamilyName(),
-      speedreader_service->GetFontSizeName(),
-      speedreader_service->GetContentStyleName());
+  auto rewriter = MakeRewriter(url, speedreader_service, rewriter_service);
 
   base::ThreadPool::PostTaskAndReplyWithResult(
       FROM_HERE, {base::TaskPriority::USER_BLOCKING, base::MayBlock()},
       base::BindOnce(distill, url, std::move(body), std::move(rewriter)),
-      base::BindOnce(return_result, std::move(callback)));
+      base::BindOnce(&ReturnResult, std::move(callback)));
+}
+
+// Lives on the worker sequence of a StreamingDistiller.
+struct StreamingDistiller::State {
+  std::unique_ptr<Rewriter> rewriter;
+  bool failed = false;
+  // Time spent writing chunks while the body was still loading.
+  base::TimeDelta overlap;
+};
+
+StreamingDistiller::StreamingDistiller(
+    const GURL& url,
+    SpeedreaderService* speedreader_service,
+    SpeedreaderRewriterService* rewriter_service)
+    : task_runner_(base::ThreadPool::CreateSequencedTaskRunner(
+          {base::TaskPriority::USER_BLOCKING, base::MayBlock()})),
+      state_(new State, base::OnTaskRunnerDeleter(task_runner_)) {
+  state_->rewriter = MakeRewriter(url, speedreader_service, rewriter_service);
+}
+
+StreamingDistiller::~StreamingDistiller() = default;
+
+void StreamingDistiller::Write(std::string chunk) {
+  DCHECK(!finished_);
+  if (chunk.empty()) {
+    return;
+  }
+
+  auto write = [](State* state, std::string chunk) {
+    if (state->failed) {
+      return;
+    }
+
+    const base::TimeTicks start = base::TimeTicks::Now();
+    state->failed = state->rewriter->Write(chunk.c_str(), chunk.length()) != 0;
+    state->overlap += base::TimeTicks::Now() - start;
+  };
+
+  // |state_| is deleted on |task_runner_| after any task posted here.
+  task_runner_->PostTask(FROM_HERE, base::BindOnce(write, state_.get(),
+                                                   std::move(chunk)));
+}
+
+void StreamingDistiller::Finish(std::string body,
+                                DistillationResultCallback callback) {
+  DCHECK(!finished_);
+  finished_ = true;
+
+  auto finish = [](State* state, std::string data,
+                   base::TimeTicks finish_requested) -> Result {
+    const base::TimeTicks start = base::TimeTicks::Now();
+    Result result =
+        state->failed
+            ? Result{DistillationResult::kFail, std::move(data), std::string()}
+            : EndDistill(state->rewriter.get(), std::move(data));
+    const base::TimeTicks end = base::TimeTicks::Now();
+
+    // Distill is the time spent in the rewriter, as for DistillPage(). Tail is
+    // what the reader view waits for after the body has been received.
+    UMA_HISTOGRAM_TIMES("Brave.Speedreader.Distill",
+                        state->overlap + (end - start));
+    UMA_HISTOGRAM_TIMES("Brave.Speedreader.Distill.Overlap", state->overlap);
+    UMA_HISTOGRAM_TIMES("Brave.Speedreader.Distill.Tail",
+                        end - finish_requested);
+    return result;
+  };
+
+  task_runner_->PostTaskAndReplyWithResult(
+      FROM_HERE,
+      base::BindOnce(finish, state_.get(), std::move(body),
+                     base::TimeTicks::Now()),
+      base::BindOnce(&ReturnResult, std::move(callback)));
 }
 
 }  // namespace speedreader
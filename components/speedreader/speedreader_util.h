@@ -6,9 +6,12 @@
 #ifndef BRAVE_COMPONENTS_SPEEDREADER_SPEEDREADER_UTIL_H_
 #define BRAVE_COMPONENTS_SPEEDREADER_SPEEDREADER_UTIL_H_
 
+#include <memory>
 #include <string>
 
 #include "base/functional/callback_forward.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/task/sequenced_task_runner.h"
 
 class GURL;
 class HostContentSettingsMap;
@@ -95,6 +98,36 @@ void DistillPage(const GURL& url,
                  SpeedreaderRewriterService* rewriter_service,
                  DistillationResultCallback callback);
 
+// Distills a page while its body is being received. Each chunk is written to
+// the rewriter on a worker sequence as soon as it arrives, so that parsing
+// overlaps with loading the body and only the end of the distillation is left
+// once the whole body has been received.
+class StreamingDistiller {
+ public:
+  StreamingDistiller(const GURL& url,
+                     SpeedreaderService* speedreader_service,
+                     SpeedreaderRewriterService* rewriter_service);
+  ~StreamingDistiller();
+
+  StreamingDistiller(const StreamingDistiller&) = delete;
+  StreamingDistiller& operator=(const StreamingDistiller&) = delete;
+
+  // Writes the next chunk of the body.
+  void Write(std::string chunk);
+
+  // Finishes distilling once the body has been received. |body| is the
+  // concatenation of all the written chunks and is passed back to |callback|
+  // as the original data.
+  void Finish(std::string body, DistillationResultCallback callback);
+
+ private:
+  struct State;
+
+  scoped_refptr<base::SequencedTaskRunner> task_runner_;
+  std::unique_ptr<State, base::OnTaskRunnerDeleter> state_;
+  bool finished_ = false;
+};
+
 }  // namespace speedreader
 
 #endif  // BRAVE_COMPONENTS_SPEEDREADER_SPEEDREADER_UTIL_H_
@@ -5,11 +5,14 @@
 
 #include "brave/components/url_sanitizer/browser/url_sanitizer_service.h"
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
+#include "base/functional/function_ref.h"
 #include "base/json/json_reader.h"
 #include "base/logging.h"
+#include "base/ranges/algorithm.h"
 #include "base/strings/string_split.h"
 #include "base/strings/string_util.h"
 #include "base/task/thread_pool.h"
@@ -17,6 +20,7 @@
 #include "extensions/common/url_pattern.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
 #include "url/gurl.h"
+#include "url/url_constants.h"
 
 namespace brave {
 
@@ -49,8 +53,80 @@ absl::optional<base::flat_set<std::string>> CreateParamsList(
   return result;
 }
 
-base::flat_set<std::unique_ptr<URLSanitizerService::MatchItem>> ParseFromJson(
-    const std::string& json) {
+// Whether |pattern| matches every http and https URL.
+bool MatchesAllHttpURLs(const URLPattern& pattern) {
+  if (pattern.match_all_urls()) {
+    return true;
+  }
+  return pattern.host().empty() && pattern.match_subdomains() &&
+         pattern.port() == "*" && pattern.path() == "/*" &&
+         pattern.MatchesScheme(url::kHttpScheme) &&
+         pattern.MatchesScheme(url::kHttpsScheme);
+}
+
+URLSanitizerService::Matchers CompileMatchers(
+    std::vector<std::unique_ptr<URLSanitizerService::MatchItem>> items) {
+  URLSanitizerService::Matchers matchers;
+  for (auto& item : items) {
+    if (item->exclude.is_empty() &&
+        base::ranges::any_of(item->include, &MatchesAllHttpURLs)) {
+      matchers.global_params.insert(item->params.begin(), item->params.end());
+      continue;
+    }
+
+    const size_t index = matchers.items.size();
+    const bool any_host =
+        base::ranges::any_of(item->include, [](const URLPattern& pattern) {
+          return pattern.host().empty();
+        });
+    if (any_host) {
+      matchers.any_host_items.push_back(index);
+    } else {
+      for (const auto& pattern : item->include) {
+        auto& bucket = matchers.items_by_host[pattern.host()];
+        if (bucket.empty() || bucket.back() != index) {
+          bucket.push_back(index);
+        }
+      }
+    }
+    matchers.items.push_back(std::move(item));
+  }
+  return matchers;
+}
+
+// Splits |query| by ampersands and drops the key=value pairs for which
+// |is_tracker| returns true. Everything else is left untouched.
+std::string StripQuery(const std::string& query,
+                       base::FunctionRef<bool(const std::string&)> is_tracker) {
+  // We are using custom query string parsing code here. See
+  // https://github.com/brave/brave-core/pull/13726#discussion_r897712350
+  // for more information on why this approach was selected.
+  //
+  // Split query string by ampersands, remove tracking parameters,
+  // then join the remaining query parameters, untouched, back into
+  // a single query string.
+  const std::vector<std::string> input_kv_strings =
+      SplitString(query, "&", base::KEEP_WHITESPACE, base::SPLIT_WANT_ALL);
+  std::vector<std::string> output_kv_strings;
+  int disallowed_count = 0;
+  for (const std::string& kv_string : input_kv_strings) {
+    const std::vector<std::string> pieces = SplitString(
+        kv_string, "=", base::KEEP_WHITESPACE, base::SPLIT_WANT_NONEMPTY);
+    const std::string& key = pieces.empty() ? std::string() : pieces[0];
+    if (pieces.size() >= 2 && is_tracker(key)) {
+      ++disallowed_count;
+    } else {
+      output_kv_strings.push_back(kv_string);
+    }
+  }
+  if (disallowed_count > 0) {
+    return base::JoinString(output_kv_strings, "&");
+  } else {
+    return query;
+  }
+}
+
+URLSanitizerService::Matchers ParseFromJson(const std::string& json) {
   auto parsed_json = base::JSONReader::ReadAndReturnValueWithError(json);
   if (!parsed_json.has_value()) {
     VLOG(1) << "Error parsing feature JSON: " << parsed_json.error().message;
@@ -60,7 +136,7 @@ base::flat_set<std::unique_ptr<URLSanitizerService::MatchItem>> ParseFromJson(
   if (!list) {
     return {};
   }
-  base::flat_set<std::unique_ptr<URLSanitizerService::MatchItem>> matchers;
+  std::vector<std::unique_ptr<URLSanitizerService::MatchItem>> matchers;
   for (const auto& it : *list) {
     const base::Value::Dict* items = it.GetIfDict();
     if (!items)
@@ -85,10 +161,10 @@ base::flat_set<std::unique_ptr<URLSanitizerService::MatchItem>> ParseFromJson(
         std::move(include_matcher), std::move(exclude_matcher),
         std::move(*params));
 
-    matchers.insert(std::move(item));
+    matchers.push_back(std::move(item));
   }
 
-  return matchers;
+  return CompileMatchers(std::move(matchers));
 }
 
 }  // namespace
@@ -105,6 +181,12 @@ URLSanitizerService::MatchItem::MatchItem(extensions::URLPatternSet in,
                                           base::flat_set<std::string> prm)
     : include(std::move(in)), exclude(std::move(ex)), params(std::move(prm)) {}
 
+URLSanitizerService::Matchers::Matchers() = default;
+URLSanitizerService::Matchers::Matchers(Matchers&&) = default;
+URLSanitizerService::Matchers& URLSanitizerService::Matchers::operator=(
+    Matchers&&) = default;
+URLSanitizerService::Matchers::~Matchers() = default;
+
 void URLSanitizerService::Initialize(const std::string& json) {
   base::ThreadPool::PostTaskAndReplyWithResult(
       FROM_HERE, {base::MayBlock()}, base::BindOnce(&ParseFromJson, json),
@@ -112,30 +194,62 @@ void URLSanitizerService::Initialize(const std::string& json) {
                      weak_factory_.GetWeakPtr()));
 }
 
-void URLSanitizerService::UpdateMatchers(
-    base::flat_set<std::unique_ptr<URLSanitizerService::MatchItem>> mappings) {
-  matchers_ = std::move(mappings);
+void URLSanitizerService::UpdateMatchers(Matchers matchers) {
+  matchers_ = std::move(matchers);
   if (initialization_callback_for_testing_)
     std::move(initialization_callback_for_testing_).Run();
 }
 
 GURL URLSanitizerService::SanitizeURL(const GURL& initial_url) {
-  if (matchers_.empty() || !initial_url.SchemeIsHTTPOrHTTPS())
+  if (matchers_.empty() || !initial_url.SchemeIsHTTPOrHTTPS() ||
+      !initial_url.has_query())
     return initial_url;
-  GURL url = initial_url;
-  for (const auto& it : matchers_) {
-    if (!it->include.MatchesURL(url) || it->exclude.MatchesURL(url))
-      continue;
-    auto sanitized_query = StripQueryParameter(url.query(), it->params);
-    GURL::Replacements replacements;
-    if (!sanitized_query.empty()) {
-      replacements.SetQueryStr(sanitized_query);
-    } else {
-      replacements.ClearQuery();
+
+  // Candidate rules are those bucketed under the URL's host or one of its
+  // parent domains, plus those that apply to any host.
+  std::vector<size_t> candidates = matchers_.any_host_items;
+  base::StringPiece host = initial_url.host_piece();
+  while (!host.empty()) {
+    auto it = matchers_.items_by_host.find(host);
+    if (it != matchers_.items_by_host.end()) {
+      candidates.insert(candidates.end(), it->second.begin(),
+                        it->second.end());
     }
-    url = url.ReplaceComponents(replacements);
+    const size_t dot = host.find('.');
+    if (dot == base::StringPiece::npos)
+      break;
+    host.remove_prefix(dot + 1);
   }
-  return url;
+  base::ranges::sort(candidates);
+  candidates.erase(base::ranges::unique(candidates), candidates.end());
+
+  // Every rule is evaluated against the original URL, and all of their
+  // params are stripped in a single pass.
+  std::vector<const base::flat_set<std::string>*> params;
+  for (size_t index : candidates) {
+    const MatchItem& item = *matchers_.items[index];
+    if (item.include.MatchesURL(initial_url) &&
+        !item.exclude.MatchesURL(initial_url)) {
+      params.push_back(&item.params);
+    }
+  }
+  if (params.empty() && matchers_.global_params.empty())
+    return initial_url;
+
+  const std::string sanitized_query =
+      StripQuery(initial_url.query(), [&](const std::string& key) {
+        return matchers_.global_params.contains(key) ||
+               base::ranges::any_of(params, [&key](const auto* item_params) {
+                 return item_params->contains(key);
+               });
+      });
+  GURL::Replacements replacements;
+  if (!sanitized_query.empty()) {
+    replacements.SetQueryStr(sanitized_query);
+  } else {
+    replacements.ClearQuery();
+  }
+  return initial_url.ReplaceComponents(replacements);
 }
 
 void URLSanitizerService::OnRulesReady(const std::string& json_content) {
@@ -149,32 +263,9 @@ void URLSanitizerService::OnRulesReady(const std::string& json_content) {
 std::string URLSanitizerService::StripQueryParameter(
     const std::string& query,
     const base::flat_set<std::string>& trackers) {
-  // We are using custom query string parsing code here. See
-  // https://github.com/brave/brave-core/pull/13726#discussion_r897712350
-  // for more information on why this approach was selected.
-  //
-  // Split query string by ampersands, remove tracking parameters,
-  // then join the remaining query parameters, untouched, back into
-  // a single query string.
-  const std::vector<std::string> input_kv_strings =
-      SplitString(query, "&", base::KEEP_WHITESPACE, base::SPLIT_WANT_ALL);
-  std::vector<std::string> output_kv_strings;
-  int disallowed_count = 0;
-  for (const std::string& kv_string : input_kv_strings) {
-    const std::vector<std::string> pieces = SplitString(
-        kv_string, "=", base::KEEP_WHITESPACE, base::SPLIT_WANT_NONEMPTY);
-    const std::string& key = pieces.empty() ? std::string() : pieces[0];
-    if (pieces.size() >= 2 && trackers.count(key) == 1) {
-      ++disallowed_count;
-    } else {
-      output_kv_strings.push_back(kv_string);
-    }
-  }
-  if (disallowed_count > 0) {
-    return base::JoinString(output_kv_strings, "&");
-  } else {
-    return query;
-  }
+  return StripQuery(query, [&trackers](const std::string& key) {
+    return trackers.contains(key);
+  });
 }
 
 }  // namespace brave
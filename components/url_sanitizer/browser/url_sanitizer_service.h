@@ -9,6 +9,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "base/containers/flat_map.h"
 #include "base/containers/flat_set.h"
@@ -41,6 +42,27 @@ class URLSanitizerService : public KeyedService,
     base::flat_set<std::string> params;
   };
 
+  // MatchItems compiled for lookup. Items are bucketed by the hosts of their
+  // include patterns, so a URL is only checked against rules that can apply
+  // to it. Items that apply to every http(s) URL don't need to be checked at
+  // all, and their params are merged into |global_params|.
+  struct Matchers {
+    Matchers();
+    Matchers(Matchers&&);
+    Matchers& operator=(Matchers&&);
+    ~Matchers();
+
+    bool empty() const { return items.empty() && global_params.empty(); }
+
+    std::vector<std::unique_ptr<MatchItem>> items;
+    // Indices into |items|, keyed by pattern host. Patterns which match
+    // subdomains are looked up through every parent domain of a URL's host.
+    base::flat_map<std::string, std::vector<size_t>> items_by_host;
+    // Indices into |items| with a wildcard host but some other restriction.
+    std::vector<size_t> any_host_items;
+    base::flat_set<std::string> global_params;
+  };
+
   GURL SanitizeURL(const GURL& url);
 
   void SetInitializationCallbackForTesting(base::OnceClosure callback) {
@@ -52,14 +74,13 @@ class URLSanitizerService : public KeyedService,
  protected:
   friend class URLSanitizerServiceUnitTest;
 
-  void UpdateMatchers(
-      base::flat_set<std::unique_ptr<URLSanitizerService::MatchItem>>);
+  void UpdateMatchers(Matchers matchers);
 
   std::string StripQueryParameter(const std::string& query,
                                   const base::flat_set<std::string>& trackers);
 
  private:
-  base::flat_set<std::unique_ptr<URLSanitizerService::MatchItem>> matchers_;
+  Matchers matchers_;
   base::OnceClosure initialization_callback_for_testing_;
   base::WeakPtrFactory<URLSanitizerService> weak_factory_{this};
 };
@@ -154,4 +154,48 @@ TEST_F(URLSanitizerServiceUnitTest, ClearURLS) {
             GURL("ws://localhost:8080/?utm_source=web"));
 }
 
+TEST_F(URLSanitizerServiceUnitTest, HostIndex) {
+  WaitInitialization(R"([
+    { "include": [ "*://*/*"], "params": ["global"] },
+    { "include": [ "*://*.example.com/*"], "params": ["subdomains"] },
+    { "include": [ "https://exact.example.org/*"], "params": ["exact"] },
+    { "include": [ "*://*/path/*"], "params": ["path"] },
+    {
+      "include": [ "*://*/*"],
+      "exclude": [ "*://excluded.com/*"],
+      "params": ["not_excluded"]
+    }
+  ])");
+
+  EXPECT_EQ(matchers_.global_params,
+            base::flat_set<std::string>({"global"}));
+  EXPECT_EQ(matchers_.items.size(), 4u);
+  EXPECT_EQ(matchers_.any_host_items.size(), 2u);
+
+  // Rules for a parent domain apply, and every matching rule is applied in a
+  // single pass.
+  EXPECT_EQ(SanitizeURL(GURL("https://a.b.example.com/path/"
+                             "?global=1&subdomains=2&exact=3&path=4&"
+                             "not_excluded=5&keep=6")),
+            GURL("https://a.b.example.com/path/?exact=3&keep=6"));
+  EXPECT_EQ(SanitizeURL(GURL("https://example.com/?subdomains=1&keep=2")),
+            GURL("https://example.com/?keep=2"));
+  EXPECT_EQ(SanitizeURL(GURL("https://notexample.com/?subdomains=1")),
+            GURL("https://notexample.com/?subdomains=1"));
+
+  // Exact hosts don't apply to subdomains, or to other schemes.
+  EXPECT_EQ(SanitizeURL(GURL("https://exact.example.org/?exact=1&keep=2")),
+            GURL("https://exact.example.org/?keep=2"));
+  EXPECT_EQ(SanitizeURL(GURL("https://sub.exact.example.org/?exact=1")),
+            GURL("https://sub.exact.example.org/?exact=1"));
+  EXPECT_EQ(SanitizeURL(GURL("http://exact.example.org/?exact=1")),
+            GURL("http://exact.example.org/?exact=1"));
+
+  // Exclusions still apply to rules without a host.
+  EXPECT_EQ(SanitizeURL(GURL("https://excluded.com/?not_excluded=1&global=2")),
+            GURL("https://excluded.com/?not_excluded=1"));
+  EXPECT_EQ(SanitizeURL(GURL("https://brave.com/?not_excluded=1&global=2")),
+            GURL("https://brave.com/"));
+}
+
 }  // namespace brave
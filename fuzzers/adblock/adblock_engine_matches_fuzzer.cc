@@ -6,6 +6,7 @@
 #include <fuzzer/FuzzedDataProvider.h>
 
 #include <iostream>
+#include <memory>
 #include <string>
 
 #include "base/files/file_path.h"
@@ -70,7 +71,7 @@ struct Environment {
     CHECK(base::i18n::InitializeICU());
   }
 
-  brave_component_updater::LoadDATFileDataResult<adblock::Engine> engine;
+  std::unique_ptr<adblock::Engine> engine;
 };
 
 // Make sure 'rs-ABPFilterParserData.dat' file exists in the working directory
@@ -87,7 +88,7 @@ DEFINE_PROTO_FUZZER(const adblock_fuzzer::EngineMatches& input) {
     std::cout << url << std::endl;
   }
 
-  env.engine.first->matches(
+  env.engine->matches(
       url, (input.url().has_host() ? input.url().host() : url),
       url_proto::Convert(input.tab_host()), input.is_third_party(),
       ResourceTypeToString(input.resource_type()), &did_match_rule,
@@ -77,9 +77,9 @@ std::unique_ptr<KeyedService> TxServiceFactory::BuildServiceInstanceFor(
   auto* keyring_service =
       KeyringServiceFactory::GetServiceForState(browser_state);
   // TODO(apaymyshev): support bitcoin for ios.
-  std::unique_ptr<TxService> tx_service(
-      new TxService(json_rpc_service, /*bitcoin_wallet_service=*/nullptr,
-                    keyring_service, browser_state->GetPrefs()));
+  std::unique_ptr<TxService> tx_service(new TxService(
+      json_rpc_service, /*bitcoin_wallet_service=*/nullptr, keyring_service,
+      browser_state->GetPrefs(), browser_state->GetStatePath()));
   return tx_service;
 }
 
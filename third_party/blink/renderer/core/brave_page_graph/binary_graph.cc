@@ -0,0 +1,387 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/third_party/blink/renderer/core/brave_page_graph/binary_graph.h"
+
+#include <iterator>
+#include <limits>
+#include <string>
+#include <utility>
+
+#include "base/check.h"
+#include "base/containers/flat_set.h"
+#include "base/no_destructor.h"
+#include "base/notreached.h"
+#include "base/ranges/algorithm.h"
+#include "base/strings/string_number_conversions.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/edge/graph_edge.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/node/graph_node.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/types.h"
+
+namespace brave_page_graph {
+
+namespace {
+
+constexpr size_t kFlushSize = 64 * 1024;
+
+void AppendVarint(uint64_t value, std::string& payload) {
+  while (value >= 0x80) {
+    payload.push_back(static_cast<char>((value & 0x7f) | 0x80));
+    value >>= 7;
+  }
+  payload.push_back(static_cast<char>(value));
+}
+
+void AppendValueHeader(BinaryGraphValueType type,
+                       uint64_t size_or_index,
+                       std::string& payload) {
+  AppendVarint((size_or_index << 2) | static_cast<uint64_t>(type), payload);
+}
+
+// Attributes whose values repeat across graph items, so that interning them
+// takes less space than writing them inline.
+bool HasRepeatingValues(const GraphMLAttr& attr) {
+  static const base::NoDestructor<base::flat_set<const GraphMLAttr*>> attrs({
+      GraphMLAttrDefForType(kGraphMLAttrDefEdgeType),
+      GraphMLAttrDefForType(kGraphMLAttrDefMethodName),
+      GraphMLAttrDefForType(kGraphMLAttrDefNodeType),
+      GraphMLAttrDefForType(kGraphMLAttrDefURL),
+  });
+  return attrs->contains(&attr);
+}
+
+class BinaryGraphReader {
+ public:
+  explicit BinaryGraphReader(base::span<const uint8_t> data) : data_(data) {}
+
+  bool IsAtEnd() const { return offset_ == data_.size(); }
+
+  bool ReadByte(uint8_t* value) {
+    if (IsAtEnd()) {
+      return false;
+    }
+    *value = data_[offset_++];
+    return true;
+  }
+
+  bool ReadVarint(uint64_t* value) {
+    *value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      uint8_t byte = 0;
+      if (!ReadByte(&byte)) {
+        return false;
+      }
+      *value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      if (!(byte & 0x80)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool ReadBytes(uint64_t size, base::span<const uint8_t>* value) {
+    if (size > data_.size() - offset_) {
+      return false;
+    }
+    *value = data_.subspan(offset_, static_cast<size_t>(size));
+    offset_ += static_cast<size_t>(size);
+    return true;
+  }
+
+  bool ReadStringRef(const std::vector<std::string>& strings,
+                     std::string* value) {
+    uint64_t index = 0;
+    if (!ReadVarint(&index) || index >= strings.size()) {
+      return false;
+    }
+    *value = strings[index];
+    return true;
+  }
+
+  bool ReadValue(const std::vector<std::string>& strings, std::string* value) {
+    uint64_t header = 0;
+    if (!ReadVarint(&header)) {
+      return false;
+    }
+    const uint64_t size_or_index = header >> 2;
+    switch (static_cast<BinaryGraphValueType>(header & 3)) {
+      case BinaryGraphValueType::kInline: {
+        base::span<const uint8_t> bytes;
+        if (!ReadBytes(size_or_index, &bytes)) {
+          return false;
+        }
+        value->assign(bytes.begin(), bytes.end());
+        return true;
+      }
+      case BinaryGraphValueType::kInterned:
+        if (size_or_index >= strings.size()) {
+          return false;
+        }
+        *value = strings[size_or_index];
+        return true;
+      case BinaryGraphValueType::kUint: {
+        uint64_t number = 0;
+        if (size_or_index || !ReadVarint(&number)) {
+          return false;
+        }
+        *value = base::NumberToString(number);
+        return true;
+      }
+      case BinaryGraphValueType::kNegative: {
+        uint64_t number = 0;
+        if (size_or_index || !ReadVarint(&number) ||
+            number > std::numeric_limits<int64_t>::max()) {
+          return false;
+        }
+        *value = base::NumberToString(-1 - static_cast<int64_t>(number));
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool ReadAttributes(const std::vector<std::string>& strings,
+                      BinaryGraph::Attributes* attributes) {
+    uint64_t count = 0;
+    // Every pair takes at least two bytes.
+    if (!ReadVarint(&count) || count > (data_.size() - offset_) / 2) {
+      return false;
+    }
+    attributes->resize(static_cast<size_t>(count));
+    for (auto& [key, value] : *attributes) {
+      if (!ReadStringRef(strings, &key) || !ReadValue(strings, &value)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+ private:
+  base::span<const uint8_t> data_;
+  size_t offset_ = 0;
+};
+
+bool ReadRecord(BinaryGraphRecordType type,
+                BinaryGraphReader& reader,
+                std::vector<std::string>& strings,
+                BinaryGraph& graph) {
+  switch (type) {
+    case BinaryGraphRecordType::kString:
+      // The whole payload is the string, so ReadBinaryGraph() handles it.
+      NOTREACHED();
+      return false;
+    case BinaryGraphRecordType::kDesc:
+      return reader.ReadAttributes(strings, &graph.desc);
+    case BinaryGraphRecordType::kKey: {
+      BinaryGraph::Key& key = graph.keys.emplace_back();
+      return reader.ReadStringRef(strings, &key.id) &&
+             reader.ReadStringRef(strings, &key.for_type) &&
+             reader.ReadStringRef(strings, &key.name) &&
+             reader.ReadStringRef(strings, &key.type);
+    }
+    case BinaryGraphRecordType::kNode: {
+      BinaryGraph::Node& node = graph.nodes.emplace_back();
+      return reader.ReadVarint(&node.id) &&
+             reader.ReadAttributes(strings, &node.attributes);
+    }
+    case BinaryGraphRecordType::kEdge: {
+      BinaryGraph::Edge& edge = graph.edges.emplace_back();
+      return reader.ReadVarint(&edge.id) && reader.ReadVarint(&edge.source) &&
+             reader.ReadVarint(&edge.target) &&
+             reader.ReadAttributes(strings, &edge.attributes);
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+BinaryGraphWriter::BinaryGraphWriter(GraphSink& sink) : sink_(sink) {
+  buffer_.append(std::begin(kBinaryGraphMagic), std::end(kBinaryGraphMagic));
+}
+
+BinaryGraphWriter::~BinaryGraphWriter() {
+  DCHECK(!current_type_);
+  DCHECK(finished_) << "Finish() was not called";
+}
+
+void BinaryGraphWriter::WriteDesc(const DescEntries& entries) {
+  std::string payload;
+  AppendVarint(entries.size(), payload);
+  for (const auto& [name, value] : entries) {
+    AppendStringRef(name, payload);
+    AppendValue(value, /*intern=*/false, payload);
+  }
+  WriteRecord(BinaryGraphRecordType::kDesc, payload);
+}
+
+void BinaryGraphWriter::WriteKey(const GraphMLAttr& attr) {
+  std::string payload;
+  AppendStringRef(attr.GetGraphMLId(), payload);
+  AppendStringRef(GraphMLForTypeToString(attr.GetFor()), payload);
+  AppendStringRef(attr.GetName().Utf8(), payload);
+  AppendStringRef(GraphMLAttrTypeToString(attr.GetType()), payload);
+  WriteRecord(BinaryGraphRecordType::kKey, payload);
+}
+
+void BinaryGraphWriter::StartGraph() {
+  // Records are self-describing, so there is nothing between the key
+  // definitions and the graph items.
+}
+
+void BinaryGraphWriter::StartNode(const GraphNode& node) {
+  DCHECK(!current_type_);
+  current_type_ = BinaryGraphRecordType::kNode;
+  AppendVarint(node.GetId(), current_ids_);
+}
+
+void BinaryGraphWriter::StartEdge(const GraphEdge& edge) {
+  DCHECK(!current_type_);
+  current_type_ = BinaryGraphRecordType::kEdge;
+  AppendVarint(edge.GetId(), current_ids_);
+  AppendVarint(edge.GetOutNode()->GetId(), current_ids_);
+  AppendVarint(edge.GetInNode()->GetId(), current_ids_);
+}
+
+void BinaryGraphWriter::AddData(const GraphMLAttr& attr,
+                                base::StringPiece value) {
+  AppendAttributeKey(attr);
+  AppendValue(value, HasRepeatingValues(attr), current_attributes_);
+}
+
+void BinaryGraphWriter::AddIntData(const GraphMLAttr& attr, int64_t value) {
+  if (value >= 0) {
+    AddUintData(attr, static_cast<uint64_t>(value));
+    return;
+  }
+  AppendAttributeKey(attr);
+  AppendValueHeader(BinaryGraphValueType::kNegative, 0, current_attributes_);
+  // -1 - value, which can't overflow unlike -value.
+  AppendVarint(~static_cast<uint64_t>(value), current_attributes_);
+}
+
+void BinaryGraphWriter::AddUintData(const GraphMLAttr& attr, uint64_t value) {
+  AppendAttributeKey(attr);
+  AppendValueHeader(BinaryGraphValueType::kUint, 0, current_attributes_);
+  AppendVarint(value, current_attributes_);
+}
+
+void BinaryGraphWriter::EndElement() {
+  DCHECK(current_type_);
+  // The attribute count comes first but is only known now, so the payload is
+  // assembled here. Any strings interned by AddData() are already written.
+  AppendVarint(current_attribute_count_, current_ids_);
+  current_ids_.append(current_attributes_);
+  WriteRecord(*current_type_, current_ids_);
+
+  current_type_.reset();
+  current_ids_.clear();
+  current_attributes_.clear();
+  current_attribute_count_ = 0;
+
+  if (buffer_.size() >= kFlushSize) {
+    Flush();
+  }
+}
+
+void BinaryGraphWriter::Finish() {
+  Flush();
+  finished_ = true;
+}
+
+void BinaryGraphWriter::AppendAttributeKey(const GraphMLAttr& attr) {
+  DCHECK(current_type_);
+  AppendStringRef(attr.GetGraphMLId(), current_attributes_);
+  ++current_attribute_count_;
+}
+
+void BinaryGraphWriter::AppendStringRef(base::StringPiece value,
+                                        std::string& payload) {
+  AppendVarint(InternString(value), payload);
+}
+
+void BinaryGraphWriter::AppendValue(base::StringPiece value,
+                                    bool intern,
+                                    std::string& payload) {
+  if (!intern || value.empty() || value.size() > kMaxInternedValueSize) {
+    AppendValueHeader(BinaryGraphValueType::kInline, value.size(), payload);
+    payload.append(value.data(), value.size());
+    return;
+  }
+  AppendValueHeader(BinaryGraphValueType::kInterned, InternString(value),
+                    payload);
+}
+
+uint64_t BinaryGraphWriter::InternString(base::StringPiece value) {
+  const auto it = string_refs_.find(value);
+  if (it != string_refs_.end()) {
+    return it->second;
+  }
+  const uint64_t index = string_refs_.size();
+  string_refs_.emplace(value, index);
+  // Written before the record which refers to it.
+  WriteRecord(BinaryGraphRecordType::kString, value);
+  return index;
+}
+
+void BinaryGraphWriter::WriteRecord(BinaryGraphRecordType type,
+                                    base::StringPiece payload) {
+  buffer_.push_back(static_cast<char>(type));
+  AppendVarint(payload.size(), buffer_);
+  buffer_.append(payload.data(), payload.size());
+}
+
+void BinaryGraphWriter::Flush() {
+  if (!buffer_.empty()) {
+    sink_->Write(buffer_);
+    buffer_.clear();
+  }
+}
+
+BinaryGraph::BinaryGraph() = default;
+
+BinaryGraph::BinaryGraph(BinaryGraph&&) = default;
+
+BinaryGraph& BinaryGraph::operator=(BinaryGraph&&) = default;
+
+BinaryGraph::~BinaryGraph() = default;
+
+absl::optional<BinaryGraph> ReadBinaryGraph(base::span<const uint8_t> data) {
+  BinaryGraphReader reader(data);
+  base::span<const uint8_t> magic;
+  if (!reader.ReadBytes(std::size(kBinaryGraphMagic), &magic) ||
+      !base::ranges::equal(magic, kBinaryGraphMagic)) {
+    return absl::nullopt;
+  }
+
+  BinaryGraph graph;
+  std::vector<std::string> strings;
+  while (!reader.IsAtEnd()) {
+    uint8_t type = 0;
+    uint64_t size = 0;
+    base::span<const uint8_t> payload;
+    if (!reader.ReadByte(&type) || !reader.ReadVarint(&size) ||
+        !reader.ReadBytes(size, &payload) ||
+        type > static_cast<uint8_t>(BinaryGraphRecordType::kEdge)) {
+      return absl::nullopt;
+    }
+
+    const auto record_type = static_cast<BinaryGraphRecordType>(type);
+    if (record_type == BinaryGraphRecordType::kString) {
+      strings.emplace_back(payload.begin(), payload.end());
+      continue;
+    }
+
+    BinaryGraphReader record_reader(payload);
+    if (!ReadRecord(record_type, record_reader, strings, graph) ||
+        !record_reader.IsAtEnd()) {
+      return absl::nullopt;
+    }
+  }
+
+  return graph;
+}
+
+}  // namespace brave_page_graph
@@ -0,0 +1,149 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_BINARY_GRAPH_H_
+#define BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_BINARY_GRAPH_H_
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/containers/span.h"
+#include "base/memory/raw_ref.h"
+#include "base/strings/string_piece.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graphml.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+#include "third_party/blink/renderer/core/core_export.h"
+
+namespace brave_page_graph {
+
+// Compact binary form of the GraphML elements of a graph, which is a fraction
+// of the size of GraphML and can be loaded without an XML parser.
+//
+// The data starts with kBinaryGraphMagic and is followed by records. A record
+// is a BinaryGraphRecordType byte, the size of its payload as a varint and the
+// payload:
+//   kString: the UTF-8 bytes of the next interned string, numbered from 0.
+//   kDesc:   a count, then (name, value) pairs of the desc entries. Nested
+//            entries are named "parent/child".
+//   kKey:    the id, for, attr.name and attr.type of a key definition.
+//   kNode:   the node id, a count, then (key id, value) pairs.
+//   kEdge:   the edge id, the source and target node ids, a count, then
+//            (key id, value) pairs.
+// Varints are unsigned LEB128. Ids are the GraphItem ids, which the GraphML
+// ids are made of.
+// Names, key ids and key definitions are varint indexes of interned strings.
+// A value is a varint v whose low two bits tell its BinaryGraphValueType:
+//   kInline:   v >> 2 bytes of UTF-8 follow.
+//   kInterned: it is the interned string v >> 2.
+//   kUint:     it is the varint which follows.
+//   kNegative: it is -1 minus the varint which follows.
+// Only the values of attributes which repeat across graph items, like urls
+// and node types, are interned, and only up to kMaxInternedValueSize bytes.
+inline constexpr uint8_t kBinaryGraphMagic[] = {'P', 'G', 'B', 2};
+inline constexpr size_t kMaxInternedValueSize = 4096;
+
+enum class BinaryGraphRecordType : uint8_t {
+  kString = 0,
+  kDesc = 1,
+  kKey = 2,
+  kNode = 3,
+  kEdge = 4,
+};
+
+enum class BinaryGraphValueType : uint8_t {
+  kInline = 0,
+  kInterned = 1,
+  kUint = 2,
+  kNegative = 3,
+};
+
+// Writes the graph in the format described above.
+class CORE_EXPORT BinaryGraphWriter : public GraphElementsWriter {
+ public:
+  explicit BinaryGraphWriter(GraphSink& sink);
+  ~BinaryGraphWriter() override;
+
+  BinaryGraphWriter(const BinaryGraphWriter&) = delete;
+  BinaryGraphWriter& operator=(const BinaryGraphWriter&) = delete;
+
+  // GraphElementsWriter:
+  void WriteDesc(const DescEntries& entries) override;
+  void WriteKey(const GraphMLAttr& attr) override;
+  void StartGraph() override;
+  void StartNode(const GraphNode& node) override;
+  void StartEdge(const GraphEdge& edge) override;
+  void AddData(const GraphMLAttr& attr, base::StringPiece value) override;
+  void AddIntData(const GraphMLAttr& attr, int64_t value) override;
+  void AddUintData(const GraphMLAttr& attr, uint64_t value) override;
+  void EndElement() override;
+  void Finish() override;
+
+ private:
+  // Starts the next attribute of the current element.
+  void AppendAttributeKey(const GraphMLAttr& attr);
+  void AppendStringRef(base::StringPiece value, std::string& payload);
+  void AppendValue(base::StringPiece value, bool intern, std::string& payload);
+  uint64_t InternString(base::StringPiece value);
+  void WriteRecord(BinaryGraphRecordType type, base::StringPiece payload);
+  void Flush();
+
+  const raw_ref<GraphSink> sink_;
+  std::map<std::string, uint64_t, std::less<>> string_refs_;
+  std::string buffer_;
+  // The element of the graph item being written: its record type, the ids
+  // which start its payload, and its attributes.
+  absl::optional<BinaryGraphRecordType> current_type_;
+  std::string current_ids_;
+  std::string current_attributes_;
+  uint64_t current_attribute_count_ = 0;
+  bool finished_ = false;
+};
+
+// A graph loaded from the binary format, mostly useful to check what was
+// written.
+struct CORE_EXPORT BinaryGraph {
+  using Attributes = std::vector<std::pair<std::string, std::string>>;
+
+  struct Key {
+    std::string id;
+    std::string for_type;
+    std::string name;
+    std::string type;
+  };
+
+  struct Node {
+    uint64_t id = 0;
+    Attributes attributes;
+  };
+
+  struct Edge {
+    uint64_t id = 0;
+    uint64_t source = 0;
+    uint64_t target = 0;
+    Attributes attributes;
+  };
+
+  BinaryGraph();
+  BinaryGraph(BinaryGraph&&);
+  BinaryGraph& operator=(BinaryGraph&&);
+  ~BinaryGraph();
+
+  Attributes desc;
+  std::vector<Key> keys;
+  std::vector<Node> nodes;
+  std::vector<Edge> edges;
+};
+
+// Returns absl::nullopt if |data| is not a well-formed binary graph.
+CORE_EXPORT absl::optional<BinaryGraph> ReadBinaryGraph(
+    base::span<const uint8_t> data);
+
+}  // namespace brave_page_graph
+
+#endif  // BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_BINARY_GRAPH_H_
@@ -0,0 +1,250 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/third_party/blink/renderer/core/brave_page_graph/binary_graph.h"
+
+#include <libxml/parser.h>
+#include <libxml/tree.h>
+
+#include <iterator>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "base/containers/span.h"
+#include "base/numerics/safe_conversions.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_piece.h"
+#include "base/test/task_environment.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graphml.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/test_graph.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave_page_graph {
+
+namespace {
+
+std::string WriteGraphML(const TestGraph& graph) {
+  StringSink sink;
+  GraphMLWriter writer(sink);
+  graph.Write(writer);
+  return std::move(sink.data);
+}
+
+std::string WriteBinaryGraph(const TestGraph& graph) {
+  StringSink sink;
+  BinaryGraphWriter writer(sink);
+  graph.Write(writer);
+  return std::move(sink.data);
+}
+
+std::string GetProperty(xmlNodePtr element, const char* name) {
+  xmlChar* value = xmlGetProp(element, BAD_CAST name);
+  std::string result(value ? reinterpret_cast<const char*>(value) : "");
+  xmlFree(value);
+  return result;
+}
+
+std::string GetContent(xmlNodePtr element) {
+  xmlChar* content = xmlNodeGetContent(element);
+  std::string result(content ? reinterpret_cast<const char*>(content) : "");
+  xmlFree(content);
+  return result;
+}
+
+uint64_t GetItemId(xmlNodePtr element, const char* name) {
+  const std::string id = GetProperty(element, name);
+  uint64_t item_id = 0;
+  EXPECT_TRUE(id.size() > 1 &&
+              base::StringToUint64(base::StringPiece(id).substr(1), &item_id))
+      << id;
+  return item_id;
+}
+
+bool IsElement(xmlNodePtr node, const char* name) {
+  return node->type == XML_ELEMENT_NODE &&
+         xmlStrEqual(node->name, BAD_CAST name);
+}
+
+void ReadDataElements(xmlNodePtr element,
+                      BinaryGraph::Attributes& attributes) {
+  for (xmlNodePtr child = element->children; child; child = child->next) {
+    if (IsElement(child, "data")) {
+      attributes.emplace_back(GetProperty(child, "key"), GetContent(child));
+    }
+  }
+}
+
+// Loads GraphML into the structure ReadBinaryGraph() returns, so that the two
+// formats can be compared.
+BinaryGraph ReadGraphML(const std::string& graphml) {
+  xmlDocPtr doc =
+      xmlReadMemory(graphml.data(), base::checked_cast<int>(graphml.size()),
+                    nullptr, nullptr, XML_PARSE_NONET);
+  CHECK(doc);
+
+  BinaryGraph graph;
+  for (xmlNodePtr child = xmlDocGetRootElement(doc)->children; child;
+       child = child->next) {
+    if (IsElement(child, "desc")) {
+      for (xmlNodePtr entry = child->children; entry; entry = entry->next) {
+        const std::string name = reinterpret_cast<const char*>(entry->name);
+        if (xmlFirstElementChild(entry)) {
+          for (xmlNodePtr nested = entry->children; nested;
+               nested = nested->next) {
+            graph.desc.emplace_back(
+                name + "/" + reinterpret_cast<const char*>(nested->name),
+                GetContent(nested));
+          }
+        } else {
+          graph.desc.emplace_back(name, GetContent(entry));
+        }
+      }
+    } else if (IsElement(child, "key")) {
+      graph.keys.push_back({GetProperty(child, "id"), GetProperty(child, "for"),
+                            GetProperty(child, "attr.name"),
+                            GetProperty(child, "attr.type")});
+    } else if (IsElement(child, "graph")) {
+      for (xmlNodePtr item = child->children; item; item = item->next) {
+        if (IsElement(item, "node")) {
+          BinaryGraph::Node& node = graph.nodes.emplace_back();
+          node.id = GetItemId(item, "id");
+          ReadDataElements(item, node.attributes);
+        } else if (IsElement(item, "edge")) {
+          BinaryGraph::Edge& edge = graph.edges.emplace_back();
+          edge.id = GetItemId(item, "id");
+          edge.source = GetItemId(item, "source");
+          edge.target = GetItemId(item, "target");
+          ReadDataElements(item, edge.attributes);
+        }
+      }
+    }
+  }
+
+  xmlFreeDoc(doc);
+  return graph;
+}
+
+}  // namespace
+
+class BinaryGraphTest : public testing::Test {
+ protected:
+  // Keeps the timestamps of the graph items the same across test graphs.
+  base::test::TaskEnvironment task_environment_{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
+};
+
+TEST_F(BinaryGraphTest, RoundTripMatchesGraphML) {
+  // Writing a graph adds items, e.g. the structure edges of HTML elements, so
+  // each format gets its own copy of the graph.
+  const TestGraph graph(3);
+  const std::string binary_graph = WriteBinaryGraph(graph);
+  const absl::optional<BinaryGraph> loaded =
+      ReadBinaryGraph(base::as_bytes(base::make_span(binary_graph)));
+  ASSERT_TRUE(loaded);
+  const BinaryGraph expected = ReadGraphML(WriteGraphML(TestGraph(3)));
+
+  EXPECT_EQ(expected.desc, loaded->desc);
+  ASSERT_EQ(expected.keys.size(), loaded->keys.size());
+  for (size_t i = 0; i < expected.keys.size(); ++i) {
+    EXPECT_EQ(expected.keys[i].id, loaded->keys[i].id);
+    EXPECT_EQ(expected.keys[i].for_type, loaded->keys[i].for_type);
+    EXPECT_EQ(expected.keys[i].name, loaded->keys[i].name);
+    EXPECT_EQ(expected.keys[i].type, loaded->keys[i].type);
+  }
+
+  // The html, text and resource nodes.
+  ASSERT_EQ(5u, loaded->nodes.size());
+  ASSERT_EQ(expected.nodes.size(), loaded->nodes.size());
+  for (size_t i = 0; i < expected.nodes.size(); ++i) {
+    EXPECT_EQ(expected.nodes[i].id, loaded->nodes[i].id);
+    EXPECT_EQ(expected.nodes[i].attributes, loaded->nodes[i].attributes);
+  }
+
+  // The structure edge which the html node adds after itself comes between
+  // the nodes, then the request edges.
+  ASSERT_EQ(4u, loaded->edges.size());
+  ASSERT_EQ(expected.edges.size(), loaded->edges.size());
+  for (size_t i = 0; i < expected.edges.size(); ++i) {
+    EXPECT_EQ(expected.edges[i].id, loaded->edges[i].id);
+    EXPECT_EQ(expected.edges[i].source, loaded->edges[i].source);
+    EXPECT_EQ(expected.edges[i].target, loaded->edges[i].target);
+    EXPECT_EQ(expected.edges[i].attributes, loaded->edges[i].attributes);
+  }
+  EXPECT_EQ(graph.html->GetId(), loaded->edges[1].source);
+  EXPECT_EQ(graph.resources[0]->GetId(), loaded->edges[1].target);
+}
+
+TEST_F(BinaryGraphTest, RejectsMalformedData) {
+  const std::string binary_graph = WriteBinaryGraph(TestGraph(3));
+  const auto data = base::as_bytes(base::make_span(binary_graph));
+
+  EXPECT_FALSE(ReadBinaryGraph(data.first(data.size() - 1)));
+  EXPECT_FALSE(ReadBinaryGraph(data.first(std::size(kBinaryGraphMagic) - 1)));
+  EXPECT_TRUE(ReadBinaryGraph(data.first(std::size(kBinaryGraphMagic))));
+
+  std::vector<uint8_t> bad_magic(data.begin(), data.end());
+  bad_magic[0] = 'X';
+  EXPECT_FALSE(ReadBinaryGraph(bad_magic));
+}
+
+TEST_F(BinaryGraphTest, IntegerValues) {
+  const TestGraph graph(0);
+  const GraphMLAttr& attr = *GraphMLAttrDefForType(kGraphMLAttrDefNodeId);
+  StringSink sink;
+  BinaryGraphWriter writer(sink);
+  writer.StartGraph();
+  writer.StartNode(*graph.html);
+  writer.AddIntData(attr, 300);
+  writer.AddIntData(attr, -1);
+  writer.AddIntData(attr, std::numeric_limits<int64_t>::min());
+  writer.AddUintData(attr, std::numeric_limits<uint64_t>::max());
+  writer.EndElement();
+  writer.Finish();
+
+  const absl::optional<BinaryGraph> loaded =
+      ReadBinaryGraph(base::as_bytes(base::make_span(sink.data)));
+  ASSERT_TRUE(loaded);
+  ASSERT_EQ(1u, loaded->nodes.size());
+  const std::string key = attr.GetGraphMLId();
+  const BinaryGraph::Attributes expected = {
+      {key, "300"},
+      {key, "-1"},
+      {key, "-9223372036854775808"},
+      {key, "18446744073709551615"}};
+  EXPECT_EQ(expected, loaded->nodes[0].attributes);
+}
+
+TEST_F(BinaryGraphTest, InternsRepeatingValuesOnly) {
+  const std::string binary_graph = WriteBinaryGraph(TestGraph(20));
+  auto count = [&binary_graph](base::StringPiece value) {
+    size_t count = 0;
+    for (size_t pos = binary_graph.find(value); pos != std::string::npos;
+         pos = binary_graph.find(value, pos + 1)) {
+      ++count;
+    }
+    return count;
+  };
+
+  // Each url is used by two resources but written once.
+  EXPECT_EQ(1u, count("https://example.com/image0.png"));
+  // Values of other attributes, like the resource type, are written inline
+  // every time: the header of a 5 byte inline value, then the value.
+  std::string inline_resource_type(1, static_cast<char>(5 << 2));
+  inline_resource_type.append("image");
+  EXPECT_EQ(20u, count(inline_resource_type));
+}
+
+TEST_F(BinaryGraphTest, SmallerThanGraphML) {
+  const TestGraph graph(5000);
+  const std::string graphml = WriteGraphML(graph);
+  const std::string binary_graph = WriteBinaryGraph(graph);
+
+  // Ids and repeated values take a few bytes instead of a full element each.
+  EXPECT_LT(binary_graph.size() * 4, graphml.size());
+  EXPECT_TRUE(ReadBinaryGraph(base::as_bytes(base::make_span(binary_graph))));
+}
+
+}  // namespace brave_page_graph
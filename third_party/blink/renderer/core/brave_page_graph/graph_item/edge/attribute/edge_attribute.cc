@@ -27,13 +27,10 @@ ItemDesc EdgeAttribute::GetItemDesc() const {
   return ts.Release();
 }
 
-void EdgeAttribute::AddGraphMLAttributes(xmlDocPtr doc,
-                                         xmlNodePtr parent_node) const {
-  GraphEdge::AddGraphMLAttributes(doc, parent_node);
-  GraphMLAttrDefForType(kGraphMLAttrDefKey)
-      ->AddValueNode(doc, parent_node, name_);
-  GraphMLAttrDefForType(kGraphMLAttrDefIsStyle)
-      ->AddValueNode(doc, parent_node, is_style_);
+void EdgeAttribute::AddGraphMLAttributes(GraphElementsWriter& writer) const {
+  GraphEdge::AddGraphMLAttributes(writer);
+  GraphMLAttrDefForType(kGraphMLAttrDefKey)->AddValue(writer, name_);
+  GraphMLAttrDefForType(kGraphMLAttrDefIsStyle)->AddValue(writer, is_style_);
 }
 
 bool EdgeAttribute::IsEdgeAttribute() const {
@@ -29,8 +29,7 @@ class EdgeAttribute : public GraphEdge {
 
   ItemDesc GetItemDesc() const override;
 
-  void AddGraphMLAttributes(xmlDocPtr doc,
-                            xmlNodePtr parent_node) const override;
+  void AddGraphMLAttributes(GraphElementsWriter& writer) const override;
 
   bool IsEdgeAttribute() const override;
 
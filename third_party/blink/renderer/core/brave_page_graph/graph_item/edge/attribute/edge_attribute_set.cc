@@ -32,11 +32,9 @@ ItemDesc EdgeAttributeSet::GetItemDesc() const {
   return ts.Release();
 }
 
-void EdgeAttributeSet::AddGraphMLAttributes(xmlDocPtr doc,
-                                            xmlNodePtr parent_node) const {
-  EdgeAttribute::AddGraphMLAttributes(doc, parent_node);
-  GraphMLAttrDefForType(kGraphMLAttrDefValue)
-      ->AddValueNode(doc, parent_node, value_);
+void EdgeAttributeSet::AddGraphMLAttributes(GraphElementsWriter& writer) const {
+  EdgeAttribute::AddGraphMLAttributes(writer);
+  GraphMLAttrDefForType(kGraphMLAttrDefValue)->AddValue(writer, value_);
 }
 
 bool EdgeAttributeSet::IsEdgeAttributeSet() const {
@@ -28,11 +28,9 @@ ItemName EdgeTextChange::GetItemDesc() const {
   return ts.Release();
 }
 
-void EdgeTextChange::AddGraphMLAttributes(xmlDocPtr doc,
-                                          xmlNodePtr parent_node) const {
-  GraphEdge::AddGraphMLAttributes(doc, parent_node);
-  GraphMLAttrDefForType(kGraphMLAttrDefValue)
-      ->AddValueNode(doc, parent_node, text_);
+void EdgeTextChange::AddGraphMLAttributes(GraphElementsWriter& writer) const {
+  GraphEdge::AddGraphMLAttributes(writer);
+  GraphMLAttrDefForType(kGraphMLAttrDefValue)->AddValue(writer, text_);
 }
 
 bool EdgeTextChange::IsEdgeTextChange() const {
@@ -27,8 +27,7 @@ class EdgeTextChange : public GraphEdge {
   ItemName GetItemName() const override;
   ItemName GetItemDesc() const override;
 
-  void AddGraphMLAttributes(xmlDocPtr doc,
-                            xmlNodePtr parent_node) const override;
+  void AddGraphMLAttributes(GraphElementsWriter& writer) const override;
 
   bool IsEdgeTextChange() const override;
 
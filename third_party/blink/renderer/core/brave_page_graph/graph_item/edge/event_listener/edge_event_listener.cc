@@ -34,13 +34,12 @@ ItemDesc EdgeEventListener::GetItemDesc() const {
   return ts.Release();
 }
 
-void EdgeEventListener::AddGraphMLAttributes(xmlDocPtr doc,
-                                             xmlNodePtr parent_node) const {
-  GraphEdge::AddGraphMLAttributes(doc, parent_node);
-  GraphMLAttrDefForType(kGraphMLAttrDefKey)
-      ->AddValueNode(doc, parent_node, event_type_);
+void EdgeEventListener::AddGraphMLAttributes(
+    GraphElementsWriter& writer) const {
+  GraphEdge::AddGraphMLAttributes(writer);
+  GraphMLAttrDefForType(kGraphMLAttrDefKey)->AddValue(writer, event_type_);
   GraphMLAttrDefForType(kGraphMLAttrDefEventListenerId)
-      ->AddValueNode(doc, parent_node, listener_id_);
+      ->AddValue(writer, listener_id_);
 }
 
 bool EdgeEventListener::IsEdgeEventListener() const {
@@ -30,8 +30,7 @@ class EdgeEventListener : public GraphEdge {
   ItemName GetItemName() const override;
   ItemDesc GetItemDesc() const override;
 
-  void AddGraphMLAttributes(xmlDocPtr doc,
-                            xmlNodePtr parent_node) const override;
+  void AddGraphMLAttributes(GraphElementsWriter& writer) const override;
 
   bool IsEdgeEventListener() const override;
 
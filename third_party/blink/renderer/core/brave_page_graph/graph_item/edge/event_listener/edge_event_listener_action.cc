@@ -43,15 +43,13 @@ ItemDesc EdgeEventListenerAction::GetItemDesc() const {
 }
 
 void EdgeEventListenerAction::AddGraphMLAttributes(
-    xmlDocPtr doc,
-    xmlNodePtr parent_node) const {
-  GraphEdge::AddGraphMLAttributes(doc, parent_node);
-  GraphMLAttrDefForType(kGraphMLAttrDefKey)
-      ->AddValueNode(doc, parent_node, event_type_);
+    GraphElementsWriter& writer) const {
+  GraphEdge::AddGraphMLAttributes(writer);
+  GraphMLAttrDefForType(kGraphMLAttrDefKey)->AddValue(writer, event_type_);
   GraphMLAttrDefForType(kGraphMLAttrDefEventListenerId)
-      ->AddValueNode(doc, parent_node, listener_id_);
+      ->AddValue(writer, listener_id_);
   GraphMLAttrDefForType(kGraphMLAttrDefScriptIdForEdge)
-      ->AddValueNode(doc, parent_node, GetListenerScriptId());
+      ->AddValue(writer, GetListenerScriptId());
 }
 
 bool EdgeEventListenerAction::IsEdgeEventListenerAction() const {
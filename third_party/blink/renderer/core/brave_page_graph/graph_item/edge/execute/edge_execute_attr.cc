@@ -29,11 +29,10 @@ ItemDesc EdgeExecuteAttr::GetItemDesc() const {
   return ts.Release();
 }
 
-void EdgeExecuteAttr::AddGraphMLAttributes(xmlDocPtr doc,
-                                           xmlNodePtr parent_node) const {
-  EdgeExecute::AddGraphMLAttributes(doc, parent_node);
+void EdgeExecuteAttr::AddGraphMLAttributes(GraphElementsWriter& writer) const {
+  EdgeExecute::AddGraphMLAttributes(writer);
   GraphMLAttrDefForType(kGraphMLAttrDefAttrName)
-      ->AddValueNode(doc, parent_node, attribute_name_);
+      ->AddValue(writer, attribute_name_);
 }
 
 bool EdgeExecuteAttr::IsEdgeExecuteAttr() const {
@@ -57,13 +57,12 @@ ItemDesc EdgeJSCall::GetItemDesc() const {
   return ts.Release();
 }
 
-void EdgeJSCall::AddGraphMLAttributes(xmlDocPtr doc,
-                                      xmlNodePtr parent_node) const {
-  EdgeJS::AddGraphMLAttributes(doc, parent_node);
+void EdgeJSCall::AddGraphMLAttributes(GraphElementsWriter& writer) const {
+  EdgeJS::AddGraphMLAttributes(writer);
   GraphMLAttrDefForType(kGraphMLAttrDefCallArgs)
-      ->AddValueNode(doc, parent_node, BuildArgumentsString(arguments_));
+      ->AddValue(writer, BuildArgumentsString(arguments_));
   GraphMLAttrDefForType(kGraphMLAttrDefScriptPosition)
-      ->AddValueNode(doc, parent_node, script_position_);
+      ->AddValue(writer, script_position_);
 }
 
 bool EdgeJSCall::IsEdgeJSCall() const {
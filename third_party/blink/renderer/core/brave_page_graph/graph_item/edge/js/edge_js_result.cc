@@ -33,11 +33,9 @@ ItemDesc EdgeJSResult::GetItemDesc() const {
   return ts.Release();
 }
 
-void EdgeJSResult::AddGraphMLAttributes(xmlDocPtr doc,
-                                        xmlNodePtr parent_node) const {
-  EdgeJS::AddGraphMLAttributes(doc, parent_node);
-  GraphMLAttrDefForType(kGraphMLAttrDefValue)
-      ->AddValueNode(doc, parent_node, result_);
+void EdgeJSResult::AddGraphMLAttributes(GraphElementsWriter& writer) const {
+  EdgeJS::AddGraphMLAttributes(writer);
+  GraphMLAttrDefForType(kGraphMLAttrDefValue)->AddValue(writer, result_);
 }
 
 const String& EdgeJSResult::GetResult() const {
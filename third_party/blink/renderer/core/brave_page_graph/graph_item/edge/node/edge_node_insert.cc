@@ -60,16 +60,15 @@ ItemDesc EdgeNodeInsert::GetItemDesc() const {
   return ts.Release();
 }
 
-void EdgeNodeInsert::AddGraphMLAttributes(xmlDocPtr doc,
-                                          xmlNodePtr parent_node) const {
-  EdgeNode::AddGraphMLAttributes(doc, parent_node);
+void EdgeNodeInsert::AddGraphMLAttributes(GraphElementsWriter& writer) const {
+  EdgeNode::AddGraphMLAttributes(writer);
   if (parent_node_) {
     GraphMLAttrDefForType(kGraphMLAttrDefParentNodeId)
-        ->AddValueNode(doc, parent_node, parent_node_->GetDOMNodeId());
+        ->AddValue(writer, parent_node_->GetDOMNodeId());
   }
   if (prior_sibling_node_) {
     GraphMLAttrDefForType(kGraphMLAttrDefBeforeNodeId)
-        ->AddValueNode(doc, parent_node, prior_sibling_node_->GetDOMNodeId());
+        ->AddValue(writer, prior_sibling_node_->GetDOMNodeId());
   }
 }
 
@@ -41,13 +41,12 @@ ItemDesc EdgeRequestComplete::GetItemDesc() const {
   return ts.Release();
 }
 
-void EdgeRequestComplete::AddGraphMLAttributes(xmlDocPtr doc,
-                                               xmlNodePtr parent_node) const {
-  EdgeRequestResponse::AddGraphMLAttributes(doc, parent_node);
+void EdgeRequestComplete::AddGraphMLAttributes(
+    GraphElementsWriter& writer) const {
+  EdgeRequestResponse::AddGraphMLAttributes(writer);
   GraphMLAttrDefForType(kGraphMLAttrDefResourceType)
-      ->AddValueNode(doc, parent_node, resource_type_);
-  GraphMLAttrDefForType(kGraphMLAttrDefResponseHash)
-      ->AddValueNode(doc, parent_node, hash_);
+      ->AddValue(writer, resource_type_);
+  GraphMLAttrDefForType(kGraphMLAttrDefResponseHash)->AddValue(writer, hash_);
 }
 
 bool EdgeRequestComplete::IsEdgeRequestComplete() const {
@@ -39,11 +39,10 @@ ItemDesc EdgeRequestStart::GetItemDesc() const {
   return ts.Release();
 }
 
-void EdgeRequestStart::AddGraphMLAttributes(xmlDocPtr doc,
-                                            xmlNodePtr parent_node) const {
-  EdgeRequest::AddGraphMLAttributes(doc, parent_node);
+void EdgeRequestStart::AddGraphMLAttributes(GraphElementsWriter& writer) const {
+  EdgeRequest::AddGraphMLAttributes(writer);
   GraphMLAttrDefForType(kGraphMLAttrDefResourceType)
-      ->AddValueNode(doc, parent_node, resource_type_);
+      ->AddValue(writer, resource_type_);
 }
 
 bool EdgeRequestStart::IsEdgeRequestStart() const {
@@ -7,6 +7,7 @@
 #define BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_GRAPH_ITEM_EDGE_REQUEST_EDGE_REQUEST_START_H_
 
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/edge/request/edge_request.h"
+#include "third_party/blink/renderer/core/core_export.h"
 #include "third_party/blink/renderer/platform/wtf/casting.h"
 #include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
 
@@ -15,7 +16,7 @@ namespace brave_page_graph {
 class GraphNode;
 class NodeResource;
 
-class EdgeRequestStart final : public EdgeRequest {
+class CORE_EXPORT EdgeRequestStart final : public EdgeRequest {
  public:
   EdgeRequestStart(GraphItemContext* context,
                    GraphNode* out_node,
@@ -33,8 +34,7 @@ class EdgeRequestStart final : public EdgeRequest {
   ItemName GetItemName() const override;
   ItemDesc GetItemDesc() const override;
 
-  void AddGraphMLAttributes(xmlDocPtr doc,
-                            xmlNodePtr parent_node) const override;
+  void AddGraphMLAttributes(GraphElementsWriter& writer) const override;
 
   bool IsEdgeRequestStart() const override;
 
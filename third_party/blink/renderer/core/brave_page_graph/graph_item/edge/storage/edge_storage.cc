@@ -31,11 +31,9 @@ ItemName EdgeStorage::GetItemDesc() const {
   return ts.Release();
 }
 
-void EdgeStorage::AddGraphMLAttributes(xmlDocPtr doc,
-                                       xmlNodePtr parent_node) const {
-  GraphEdge::AddGraphMLAttributes(doc, parent_node);
-  GraphMLAttrDefForType(kGraphMLAttrDefKey)
-      ->AddValueNode(doc, parent_node, key_);
+void EdgeStorage::AddGraphMLAttributes(GraphElementsWriter& writer) const {
+  GraphEdge::AddGraphMLAttributes(writer);
+  GraphMLAttrDefForType(kGraphMLAttrDefKey)->AddValue(writer, key_);
 }
 
 bool EdgeStorage::IsEdgeStorage() const {
@@ -31,11 +31,10 @@ ItemDesc EdgeStorageReadResult::GetItemDesc() const {
   return ts.Release();
 }
 
-void EdgeStorageReadResult::AddGraphMLAttributes(xmlDocPtr doc,
-                                                 xmlNodePtr parent_node) const {
-  EdgeStorage::AddGraphMLAttributes(doc, parent_node);
-  GraphMLAttrDefForType(kGraphMLAttrDefValue)
-      ->AddValueNode(doc, parent_node, value_);
+void EdgeStorageReadResult::AddGraphMLAttributes(
+    GraphElementsWriter& writer) const {
+  EdgeStorage::AddGraphMLAttributes(writer);
+  GraphMLAttrDefForType(kGraphMLAttrDefValue)->AddValue(writer, value_);
 }
 
 bool EdgeStorageReadResult::IsEdgeStorageReadResult() const {
@@ -31,11 +31,9 @@ ItemDesc EdgeStorageSet::GetItemDesc() const {
   return ts.Release();
 }
 
-void EdgeStorageSet::AddGraphMLAttributes(xmlDocPtr doc,
-                                          xmlNodePtr parent_node) const {
-  EdgeStorage::AddGraphMLAttributes(doc, parent_node);
-  GraphMLAttrDefForType(kGraphMLAttrDefValue)
-      ->AddValueNode(doc, parent_node, value_);
+void EdgeStorageSet::AddGraphMLAttributes(GraphElementsWriter& writer) const {
+  EdgeStorage::AddGraphMLAttributes(writer);
+  GraphMLAttrDefForType(kGraphMLAttrDefValue)->AddValue(writer, value_);
 }
 
 bool EdgeStorageSet::IsEdgeStorageSet() const {
@@ -24,8 +24,7 @@ ItemDesc GraphItem::GetItemDesc() const {
   return ts.Release();
 }
 
-void GraphItem::AddGraphMLAttributes(xmlDocPtr doc,
-                                     xmlNodePtr parent_node) const {}
+void GraphItem::AddGraphMLAttributes(GraphElementsWriter& writer) const {}
 
 bool GraphItem::IsEdge() const {
   return false;
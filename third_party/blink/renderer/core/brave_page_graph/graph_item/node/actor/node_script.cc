@@ -84,18 +84,15 @@ void NodeScript::AddInEdge(const GraphEdge* in_edge) {
   }
 }
 
-void NodeScript::AddGraphMLAttributes(xmlDocPtr doc,
-                                      xmlNodePtr parent_node) const {
-  NodeActor::AddGraphMLAttributes(doc, parent_node);
+void NodeScript::AddGraphMLAttributes(GraphElementsWriter& writer) const {
+  NodeActor::AddGraphMLAttributes(writer);
   GraphMLAttrDefForType(kGraphMLAttrDefScriptIdForNode)
-      ->AddValueNode(doc, parent_node, script_id_);
+      ->AddValue(writer, script_id_);
   GraphMLAttrDefForType(kGraphMLAttrDefScriptType)
-      ->AddValueNode(doc, parent_node,
-                     GetScriptTypeAsString(script_data_.source));
+      ->AddValue(writer, GetScriptTypeAsString(script_data_.source));
   GraphMLAttrDefForType(kGraphMLAttrDefSource)
-      ->AddValueNode(doc, parent_node, script_data_.code);
-  GraphMLAttrDefForType(kGraphMLAttrDefURL)
-      ->AddValueNode(doc, parent_node, url_);
+      ->AddValue(writer, script_data_.code);
+  GraphMLAttrDefForType(kGraphMLAttrDefURL)->AddValue(writer, url_);
 }
 
 bool NodeScript::IsNodeScript() const {
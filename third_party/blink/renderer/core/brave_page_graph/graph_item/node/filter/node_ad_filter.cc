@@ -28,11 +28,9 @@ ItemDesc NodeAdFilter::GetItemDesc() const {
   return ts.Release();
 }
 
-void NodeAdFilter::AddGraphMLAttributes(xmlDocPtr doc,
-                                        xmlNodePtr parent_node) const {
-  NodeFilter::AddGraphMLAttributes(doc, parent_node);
-  GraphMLAttrDefForType(kGraphMLAttrDefRule)
-      ->AddValueNode(doc, parent_node, rule_);
+void NodeAdFilter::AddGraphMLAttributes(GraphElementsWriter& writer) const {
+  NodeFilter::AddGraphMLAttributes(writer);
+  GraphMLAttrDefForType(kGraphMLAttrDefRule)->AddValue(writer, rule_);
 }
 
 bool NodeAdFilter::IsNodeAdFilter() const {
@@ -28,17 +28,15 @@ ItemDesc NodeFingerprintingFilter::GetItemDesc() const {
 }
 
 void NodeFingerprintingFilter::AddGraphMLAttributes(
-    xmlDocPtr doc,
-    xmlNodePtr parent_node) const {
-  NodeFilter::AddGraphMLAttributes(doc, parent_node);
+    GraphElementsWriter& writer) const {
+  NodeFilter::AddGraphMLAttributes(writer);
   GraphMLAttrDefForType(kGraphMLAttrDefPrimaryPattern)
-      ->AddValueNode(doc, parent_node, rule_.primary_pattern);
+      ->AddValue(writer, rule_.primary_pattern);
   GraphMLAttrDefForType(kGraphMLAttrDefSecondaryPattern)
-      ->AddValueNode(doc, parent_node, rule_.secondary_pattern);
-  GraphMLAttrDefForType(kGraphMLAttrDefSource)
-      ->AddValueNode(doc, parent_node, rule_.source);
+      ->AddValue(writer, rule_.secondary_pattern);
+  GraphMLAttrDefForType(kGraphMLAttrDefSource)->AddValue(writer, rule_.source);
   GraphMLAttrDefForType(kGraphMLAttrDefIncognito)
-      ->AddValueNode(doc, parent_node, rule_.incognito);
+      ->AddValue(writer, rule_.incognito);
 }
 
 bool NodeFingerprintingFilter::IsNodeFingerprintingFilter() const {
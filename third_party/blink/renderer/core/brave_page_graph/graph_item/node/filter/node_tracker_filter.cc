@@ -26,11 +26,10 @@ ItemDesc NodeTrackerFilter::GetItemDesc() const {
   return ts.Release();
 }
 
-void NodeTrackerFilter::AddGraphMLAttributes(xmlDocPtr doc,
-                                             xmlNodePtr parent_node) const {
-  NodeFilter::AddGraphMLAttributes(doc, parent_node);
-  GraphMLAttrDefForType(kGraphMLAttrDefHost)
-      ->AddValueNode(doc, parent_node, host_);
+void NodeTrackerFilter::AddGraphMLAttributes(
+    GraphElementsWriter& writer) const {
+  NodeFilter::AddGraphMLAttributes(writer);
+  GraphMLAttrDefForType(kGraphMLAttrDefHost)->AddValue(writer, host_);
 }
 
 bool NodeTrackerFilter::IsNodeTrackerFilter() const {
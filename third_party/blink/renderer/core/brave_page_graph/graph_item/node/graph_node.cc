@@ -27,23 +27,20 @@ GraphMLId GraphNode::GetGraphMLId() const {
   return "n" + base::NumberToString(GetId());
 }
 
-void GraphNode::AddGraphMLTag(xmlDocPtr doc, xmlNodePtr parent_node) const {
-  xmlNodePtr new_node =
-      xmlNewChild(parent_node, nullptr, BAD_CAST "node", nullptr);
-  xmlSetProp(new_node, BAD_CAST "id", BAD_CAST GetGraphMLId().c_str());
-  AddGraphMLAttributes(doc, new_node);
+void GraphNode::AddGraphMLTag(GraphElementsWriter& writer) const {
+  writer.StartNode(*this);
+  AddGraphMLAttributes(writer);
+  writer.EndElement();
 }
 
-void GraphNode::AddGraphMLAttributes(xmlDocPtr doc,
-                                     xmlNodePtr parent_node) const {
-  GraphItem::AddGraphMLAttributes(doc, parent_node);
+void GraphNode::AddGraphMLAttributes(GraphElementsWriter& writer) const {
+  GraphItem::AddGraphMLAttributes(writer);
   GraphMLAttrDefForType(kGraphMLAttrDefNodeType)
-      ->AddValueNode(doc, parent_node, GetItemName());
+      ->AddValue(writer, GetItemName());
   GraphMLAttrDefForType(kGraphMLAttrDefPageGraphNodeId)
-      ->AddValueNode(doc, parent_node, GetId());
+      ->AddValue(writer, GetId());
   GraphMLAttrDefForType(kGraphMLAttrDefPageGraphNodeTimestamp)
-      ->AddValueNode(doc, parent_node,
-                     GetTimeDeltaSincePageStart().InMilliseconds());
+      ->AddValue(writer, GetTimeDeltaSincePageStart().InMilliseconds());
 }
 
 bool GraphNode::IsNode() const {
@@ -33,11 +33,9 @@ ItemDesc NodeDOMRoot::GetItemDesc() const {
   return ts.Release();
 }
 
-void NodeDOMRoot::AddGraphMLAttributes(xmlDocPtr doc,
-                                       xmlNodePtr parent_node) const {
-  NodeHTMLElement::AddGraphMLAttributes(doc, parent_node);
-  GraphMLAttrDefForType(kGraphMLAttrDefURL)
-      ->AddValueNode(doc, parent_node, url_);
+void NodeDOMRoot::AddGraphMLAttributes(GraphElementsWriter& writer) const {
+  NodeHTMLElement::AddGraphMLAttributes(writer);
+  GraphMLAttrDefForType(kGraphMLAttrDefURL)->AddValue(writer, url_);
 }
 
 bool NodeDOMRoot::IsNodeDOMRoot() const {
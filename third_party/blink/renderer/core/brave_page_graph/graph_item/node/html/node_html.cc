@@ -37,13 +37,11 @@ ItemDesc NodeHTML::GetItemDesc() const {
   return ts.Release();
 }
 
-void NodeHTML::AddGraphMLAttributes(xmlDocPtr doc,
-                                    xmlNodePtr parent_node) const {
-  GraphNode::AddGraphMLAttributes(doc, parent_node);
-  GraphMLAttrDefForType(kGraphMLAttrDefNodeId)
-      ->AddValueNode(doc, parent_node, dom_node_id_);
+void NodeHTML::AddGraphMLAttributes(GraphElementsWriter& writer) const {
+  GraphNode::AddGraphMLAttributes(writer);
+  GraphMLAttrDefForType(kGraphMLAttrDefNodeId)->AddValue(writer, dom_node_id_);
   GraphMLAttrDefForType(kGraphMLAttrDefIsDeleted)
-      ->AddValueNode(doc, parent_node, is_deleted_);
+      ->AddValue(writer, is_deleted_);
 }
 
 void NodeHTML::AddInEdge(const GraphEdge* in_edge) {
@@ -59,14 +59,13 @@ ItemDesc NodeHTMLElement::GetItemDesc() const {
   return ts.Release();
 }
 
-void NodeHTMLElement::AddGraphMLTag(xmlDocPtr doc,
-                                    xmlNodePtr parent_node) const {
-  NodeHTML::AddGraphMLTag(doc, parent_node);
+void NodeHTMLElement::AddGraphMLTag(GraphElementsWriter& writer) const {
+  NodeHTML::AddGraphMLTag(writer);
 
   for (NodeHTML* child_node : child_nodes_) {
     EdgeStructure html_edge(GetContext(), const_cast<NodeHTMLElement*>(this),
                             child_node);
-    html_edge.AddGraphMLTag(doc, parent_node);
+    html_edge.AddGraphMLTag(writer);
   }
 
   // For each event listener, draw an edge from the listener script to the DOM
@@ -79,15 +78,13 @@ void NodeHTMLElement::AddGraphMLTag(xmlDocPtr doc,
     EdgeEventListener event_listener_edge(
         GetContext(), const_cast<NodeHTMLElement*>(this), listener_node,
         event_type, listener_id);
-    event_listener_edge.AddGraphMLTag(doc, parent_node);
+    event_listener_edge.AddGraphMLTag(writer);
   }
 }
 
-void NodeHTMLElement::AddGraphMLAttributes(xmlDocPtr doc,
-                                           xmlNodePtr parent_node) const {
-  NodeHTML::AddGraphMLAttributes(doc, parent_node);
-  GraphMLAttrDefForType(kGraphMLAttrDefNodeTag)
-      ->AddValueNode(doc, parent_node, TagName());
+void NodeHTMLElement::AddGraphMLAttributes(GraphElementsWriter& writer) const {
+  NodeHTML::AddGraphMLAttributes(writer);
+  GraphMLAttrDefForType(kGraphMLAttrDefNodeTag)->AddValue(writer, TagName());
 }
 
 void NodeHTMLElement::PlaceChildNodeAfterSiblingNode(NodeHTML* child,
@@ -38,11 +38,9 @@ ItemDesc NodeHTMLText::GetItemDesc() const {
   return ts.Release();
 }
 
-void NodeHTMLText::AddGraphMLAttributes(xmlDocPtr doc,
-                                        xmlNodePtr parent_node) const {
-  NodeHTML::AddGraphMLAttributes(doc, parent_node);
-  GraphMLAttrDefForType(kGraphMLAttrDefNodeText)
-      ->AddValueNode(doc, parent_node, text_);
+void NodeHTMLText::AddGraphMLAttributes(GraphElementsWriter& writer) const {
+  NodeHTML::AddGraphMLAttributes(writer);
+  GraphMLAttrDefForType(kGraphMLAttrDefNodeText)->AddValue(writer, text_);
 }
 
 void NodeHTMLText::AddInEdge(const GraphEdge* in_edge) {
@@ -30,11 +30,9 @@ ItemDesc NodeJSBuiltin::GetItemDesc() const {
   return ts.Release();
 }
 
-void NodeJSBuiltin::AddGraphMLAttributes(xmlDocPtr doc,
-                                         xmlNodePtr parent_node) const {
-  NodeJS::AddGraphMLAttributes(doc, parent_node);
-  GraphMLAttrDefForType(kGraphMLAttrDefMethodName)
-      ->AddValueNode(doc, parent_node, builtin_);
+void NodeJSBuiltin::AddGraphMLAttributes(GraphElementsWriter& writer) const {
+  NodeJS::AddGraphMLAttributes(writer);
+  GraphMLAttrDefForType(kGraphMLAttrDefMethodName)->AddValue(writer, builtin_);
 }
 
 bool NodeJSBuiltin::IsNodeJSBuiltin() const {
@@ -29,11 +29,10 @@ ItemDesc NodeJSWebAPI::GetItemDesc() const {
   return ts.Release();
 }
 
-void NodeJSWebAPI::AddGraphMLAttributes(xmlDocPtr doc,
-                                        xmlNodePtr parent_node) const {
-  NodeJS::AddGraphMLAttributes(doc, parent_node);
+void NodeJSWebAPI::AddGraphMLAttributes(GraphElementsWriter& writer) const {
+  NodeJS::AddGraphMLAttributes(writer);
   GraphMLAttrDefForType(kGraphMLAttrDefMethodName)
-      ->AddValueNode(doc, parent_node, method_name_);
+      ->AddValue(writer, method_name_);
 }
 
 bool NodeJSWebAPI::IsNodeJSWebAPI() const {
@@ -26,11 +26,9 @@ ItemDesc NodeRemoteFrame::GetItemDesc() const {
   return ts.Release();
 }
 
-void NodeRemoteFrame::AddGraphMLAttributes(xmlDocPtr doc,
-                                           xmlNodePtr parent_node) const {
-  GraphNode::AddGraphMLAttributes(doc, parent_node);
-  GraphMLAttrDefForType(kGraphMLAttrDefFrameId)
-      ->AddValueNode(doc, parent_node, frame_id_);
+void NodeRemoteFrame::AddGraphMLAttributes(GraphElementsWriter& writer) const {
+  GraphNode::AddGraphMLAttributes(writer);
+  GraphMLAttrDefForType(kGraphMLAttrDefFrameId)->AddValue(writer, frame_id_);
 }
 
 bool NodeRemoteFrame::IsNodeRemoteFrame() const {
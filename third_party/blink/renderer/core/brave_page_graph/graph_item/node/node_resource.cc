@@ -28,11 +28,9 @@ ItemDesc NodeResource::GetItemDesc() const {
   return ts.Release();
 }
 
-void NodeResource::AddGraphMLAttributes(xmlDocPtr doc,
-                                        xmlNodePtr parent_node) const {
-  GraphNode::AddGraphMLAttributes(doc, parent_node);
-  GraphMLAttrDefForType(kGraphMLAttrDefURL)
-      ->AddValueNode(doc, parent_node, url_.GetString());
+void NodeResource::AddGraphMLAttributes(GraphElementsWriter& writer) const {
+  GraphNode::AddGraphMLAttributes(writer);
+  GraphMLAttrDefForType(kGraphMLAttrDefURL)->AddValue(writer, url_.GetString());
 }
 
 bool NodeResource::IsNodeResource() const {
@@ -7,11 +7,12 @@
 #define BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_GRAPH_ITEM_NODE_NODE_RESOURCE_H_
 
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/node/graph_node.h"
+#include "third_party/blink/renderer/core/core_export.h"
 #include "third_party/blink/renderer/platform/wtf/casting.h"
 
 namespace brave_page_graph {
 
-class NodeResource : public GraphNode {
+class CORE_EXPORT NodeResource : public GraphNode {
  public:
   NodeResource(GraphItemContext* context, const RequestURL url);
   ~NodeResource() override;
@@ -21,8 +22,7 @@ class NodeResource : public GraphNode {
   ItemName GetItemName() const override;
   ItemDesc GetItemDesc() const override;
 
-  void AddGraphMLAttributes(xmlDocPtr doc,
-                            xmlNodePtr parent_node) const override;
+  void AddGraphMLAttributes(GraphElementsWriter& writer) const override;
 
   bool IsNodeResource() const override;
 
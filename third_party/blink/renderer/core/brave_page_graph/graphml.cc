@@ -10,10 +10,15 @@
 
 #include <string>
 
+#include "base/check.h"
 #include "base/no_destructor.h"
+#include "base/numerics/safe_conversions.h"
 #include "base/strings/string_number_conversions.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/edge/graph_edge.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/node/graph_node.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/libxml_utils.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/types.h"
+#include "third_party/blink/renderer/platform/wtf/text/string_utf8_adaptor.h"
 
 namespace brave_page_graph {
 
@@ -30,97 +35,55 @@ GraphMLId GraphMLAttr::GetGraphMLId() const {
   return "d" + base::NumberToString(id_);
 }
 
-void GraphMLAttr::AddDefinitionNode(xmlNodePtr parent_node) const {
-  xmlNodePtr new_node =
-      xmlNewChild(parent_node, nullptr, BAD_CAST "key", nullptr);
-  xmlSetProp(new_node, BAD_CAST "id", BAD_CAST GetGraphMLId().c_str());
-  xmlSetProp(new_node, BAD_CAST "for",
-             BAD_CAST GraphMLForTypeToString(for_).c_str());
-  xmlSetProp(new_node, BAD_CAST "attr.name", XmlUtf8String(name_).get());
-  xmlSetProp(new_node, BAD_CAST "attr.type",
-             BAD_CAST GraphMLAttrTypeToString(type_).c_str());
-}
-
-void GraphMLAttr::AddValueNode(xmlDocPtr doc,
-                               xmlNodePtr parent_node,
-                               base::StringPiece value) const {
-  AddValueNodeXmlChar(doc, parent_node, XmlUtf8String(value).get());
-}
-
-void GraphMLAttr::AddValueNode(xmlDocPtr doc,
-                               xmlNodePtr parent_node,
-                               const String& value) const {
-  AddValueNodeXmlChar(doc, parent_node, XmlUtf8String(value).get());
+void GraphMLAttr::AddValue(GraphElementsWriter& writer,
+                           base::StringPiece value) const {
+  CHECK(type_ == kGraphMLAttrTypeString);
+  writer.AddData(*this, value);
 }
 
-void GraphMLAttr::AddValueNodeXmlChar(xmlDocPtr doc,
-                                      xmlNodePtr parent_node,
-                                      const xmlChar* value) const {
+void GraphMLAttr::AddValue(GraphElementsWriter& writer,
+                           const String& value) const {
   CHECK(type_ == kGraphMLAttrTypeString);
-  xmlChar* encoded_content = xmlEncodeEntitiesReentrant(doc, value);
-  xmlNodePtr new_node =
-      xmlNewChild(parent_node, nullptr, BAD_CAST "data", encoded_content);
-  xmlSetProp(new_node, BAD_CAST "key", BAD_CAST GetGraphMLId().c_str());
-  xmlFree(encoded_content);
+  writer.AddData(
+      *this,
+      StringUTF8Adaptor(
+          value, WTF::kStrictUTF8ConversionReplacingUnpairedSurrogatesWithFFFD)
+          .AsStringPiece());
 }
 
-void GraphMLAttr::AddValueNode(xmlDocPtr doc,
-                               xmlNodePtr parent_node,
-                               const int value) const {
+void GraphMLAttr::AddValue(GraphElementsWriter& writer, const int value) const {
   CHECK(type_ == kGraphMLAttrTypeInt);
-  xmlNodePtr new_node =
-      xmlNewTextChild(parent_node, nullptr, BAD_CAST "data",
-                      BAD_CAST base::NumberToString(value).c_str());
-  xmlSetProp(new_node, BAD_CAST "key", BAD_CAST GetGraphMLId().c_str());
+  writer.AddIntData(*this, value);
 }
 
-void GraphMLAttr::AddValueNode(xmlDocPtr doc,
-                               xmlNodePtr parent_node,
-                               const bool value) const {
+void GraphMLAttr::AddValue(GraphElementsWriter& writer,
+                           const bool value) const {
   CHECK(type_ == kGraphMLAttrTypeBoolean);
-  xmlNodePtr new_node = xmlNewTextChild(parent_node, nullptr, BAD_CAST "data",
-                                        BAD_CAST(value ? "true" : "false"));
-  xmlSetProp(new_node, BAD_CAST "key", BAD_CAST GetGraphMLId().c_str());
+  writer.AddData(*this, value ? "true" : "false");
 }
 
-void GraphMLAttr::AddValueNode(xmlDocPtr doc,
-                               xmlNodePtr parent_node,
-                               const int64_t value) const {
+void GraphMLAttr::AddValue(GraphElementsWriter& writer,
+                           const int64_t value) const {
   CHECK(type_ == kGraphMLAttrTypeString);
-  xmlNodePtr new_node =
-      xmlNewTextChild(parent_node, nullptr, BAD_CAST "data",
-                      BAD_CAST base::NumberToString(value).c_str());
-  xmlSetProp(new_node, BAD_CAST "key", BAD_CAST GetGraphMLId().c_str());
+  writer.AddIntData(*this, value);
 }
 
-void GraphMLAttr::AddValueNode(xmlDocPtr doc,
-                               xmlNodePtr parent_node,
-                               const uint64_t value) const {
+void GraphMLAttr::AddValue(GraphElementsWriter& writer,
+                           const uint64_t value) const {
   CHECK(type_ == kGraphMLAttrTypeString);
-  xmlNodePtr new_node =
-      xmlNewTextChild(parent_node, nullptr, BAD_CAST "data",
-                      BAD_CAST base::NumberToString(value).c_str());
-  xmlSetProp(new_node, BAD_CAST "key", BAD_CAST GetGraphMLId().c_str());
+  writer.AddUintData(*this, value);
 }
 
-void GraphMLAttr::AddValueNode(xmlDocPtr doc,
-                               xmlNodePtr parent_node,
-                               const double value) const {
+void GraphMLAttr::AddValue(GraphElementsWriter& writer,
+                           const double value) const {
   CHECK(type_ == kGraphMLAttrTypeDouble);
-  xmlNodePtr new_node =
-      xmlNewTextChild(parent_node, nullptr, BAD_CAST "data",
-                      BAD_CAST base::NumberToString(value).c_str());
-  xmlSetProp(new_node, BAD_CAST "key", BAD_CAST GetGraphMLId().c_str());
+  writer.AddData(*this, base::NumberToString(value));
 }
 
-void GraphMLAttr::AddValueNode(xmlDocPtr doc,
-                               xmlNodePtr parent_node,
-                               const base::TimeDelta value) const {
+void GraphMLAttr::AddValue(GraphElementsWriter& writer,
+                           const base::TimeDelta value) const {
   CHECK(type_ == kGraphMLAttrTypeInt);
-  xmlNodePtr new_node = xmlNewTextChild(
-      parent_node, nullptr, BAD_CAST "data",
-      BAD_CAST base::NumberToString(value.InMilliseconds()).c_str());
-  xmlSetProp(new_node, BAD_CAST "key", BAD_CAST GetGraphMLId().c_str());
+  writer.AddIntData(*this, value.InMilliseconds());
 }
 
 const GraphMLAttrs& GetGraphMLAttrs() {
@@ -214,6 +177,126 @@ const GraphMLAttrs& GetGraphMLAttrs() {
   return *attrs;
 }
 
+GraphMLWriter::GraphMLWriter(GraphSink& sink)
+    : sink_(sink),
+      doc_(xmlNewDoc(BAD_CAST "1.0")),
+      output_(xmlOutputBufferCreateIO(&GraphMLWriter::OnWrite, nullptr, this,
+                                      nullptr)) {
+  CHECK(output_);
+  WriteMarkup(
+      "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+      "<graphml xmlns=\"http://graphml.graphdrawing.org/xmlns\" "
+      "xmlns:xsi=\"http://www.w3.org/2001/XMLSchema-instance\" "
+      "xsi:schemaLocation=\"http://graphml.graphdrawing.org/xmlns "
+      "http://graphml.graphdrawing.org/xmlns/1.0/graphml.xsd\">");
+}
+
+GraphMLWriter::~GraphMLWriter() {
+  DCHECK(!current_element_);
+  DCHECK(!output_) << "Finish() was not called";
+  if (output_) {
+    xmlOutputBufferClose(output_);
+  }
+  xmlFreeDoc(doc_);
+}
+
+void GraphMLWriter::WriteDesc(const DescEntries& entries) {
+  xmlNodePtr desc_node = xmlNewDocNode(doc_, nullptr, BAD_CAST "desc", nullptr);
+  for (const auto& [name, value] : entries) {
+    xmlNodePtr parent_node = desc_node;
+    base::StringPiece child_name = name;
+    const size_t separator = child_name.find('/');
+    if (separator != base::StringPiece::npos) {
+      // Consecutive "parent/child" entries share a single parent element.
+      const std::string parent_name(child_name.substr(0, separator));
+      parent_node = xmlGetLastChild(desc_node);
+      if (!parent_node ||
+          !xmlStrEqual(parent_node->name, BAD_CAST parent_name.c_str())) {
+        parent_node = xmlNewChild(desc_node, nullptr,
+                                  BAD_CAST parent_name.c_str(), nullptr);
+      }
+      child_name = child_name.substr(separator + 1);
+    }
+    xmlNewTextChild(parent_node, nullptr,
+                    BAD_CAST std::string(child_name).c_str(),
+                    XmlUtf8String(value).get());
+  }
+  WriteElement(desc_node);
+}
+
+void GraphMLWriter::WriteKey(const GraphMLAttr& attr) {
+  xmlNodePtr key_node = xmlNewDocNode(doc_, nullptr, BAD_CAST "key", nullptr);
+  xmlSetProp(key_node, BAD_CAST "id", BAD_CAST attr.GetGraphMLId().c_str());
+  xmlSetProp(key_node, BAD_CAST "for",
+             BAD_CAST GraphMLForTypeToString(attr.GetFor()).c_str());
+  xmlSetProp(key_node, BAD_CAST "attr.name",
+             XmlUtf8String(attr.GetName()).get());
+  xmlSetProp(key_node, BAD_CAST "attr.type",
+             BAD_CAST GraphMLAttrTypeToString(attr.GetType()).c_str());
+  WriteElement(key_node);
+}
+
+void GraphMLWriter::StartGraph() {
+  WriteMarkup("<graph id=\"G\" edgedefault=\"directed\">");
+}
+
+void GraphMLWriter::StartNode(const GraphNode& node) {
+  DCHECK(!current_element_);
+  current_element_ = xmlNewDocNode(doc_, nullptr, BAD_CAST "node", nullptr);
+  xmlSetProp(current_element_, BAD_CAST "id",
+             BAD_CAST node.GetGraphMLId().c_str());
+}
+
+void GraphMLWriter::StartEdge(const GraphEdge& edge) {
+  DCHECK(!current_element_);
+  current_element_ = xmlNewDocNode(doc_, nullptr, BAD_CAST "edge", nullptr);
+  xmlSetProp(current_element_, BAD_CAST "id",
+             BAD_CAST edge.GetGraphMLId().c_str());
+  xmlSetProp(current_element_, BAD_CAST "source",
+             BAD_CAST edge.GetOutNode()->GetGraphMLId().c_str());
+  xmlSetProp(current_element_, BAD_CAST "target",
+             BAD_CAST edge.GetInNode()->GetGraphMLId().c_str());
+}
+
+void GraphMLWriter::AddData(const GraphMLAttr& attr, base::StringPiece value) {
+  DCHECK(current_element_);
+  xmlChar* encoded_content =
+      xmlEncodeEntitiesReentrant(doc_, XmlUtf8String(value).get());
+  xmlNodePtr data_node = xmlNewChild(current_element_, nullptr,
+                                     BAD_CAST "data", encoded_content);
+  xmlSetProp(data_node, BAD_CAST "key", BAD_CAST attr.GetGraphMLId().c_str());
+  xmlFree(encoded_content);
+}
+
+void GraphMLWriter::EndElement() {
+  DCHECK(current_element_);
+  WriteElement(current_element_);
+  current_element_ = nullptr;
+}
+
+void GraphMLWriter::Finish() {
+  WriteMarkup("</graph></graphml>\n");
+  xmlOutputBufferClose(output_);
+  output_ = nullptr;
+}
+
+void GraphMLWriter::WriteMarkup(base::StringPiece markup) {
+  xmlOutputBufferWrite(output_, base::checked_cast<int>(markup.size()),
+                       markup.data());
+}
+
+void GraphMLWriter::WriteElement(xmlNodePtr element) {
+  xmlNodeDumpOutput(output_, doc_, element, 0, 0, "UTF-8");
+  xmlFreeNode(element);
+}
+
+// static
+int GraphMLWriter::OnWrite(void* context, const char* buffer, int len) {
+  static_cast<GraphMLWriter*>(context)->sink_->Write(
+      base::StringPiece(buffer, base::checked_cast<size_t>(len)));
+  return len;
+}
+
 const GraphMLAttr* GraphMLAttrDefForType(const GraphMLAttrDef type) {
   const auto& attrs = GetGraphMLAttrs();
   auto it = attrs.find(type);
@@ -221,4 +304,13 @@ const GraphMLAttr* GraphMLAttrDefForType(const GraphMLAttrDef type) {
   return it->second;
 }
 
+void GraphElementsWriter::AddIntData(const GraphMLAttr& attr, int64_t value) {
+  AddData(attr, base::NumberToString(value));
+}
+
+void GraphElementsWriter::AddUintData(const GraphMLAttr& attr,
+                                      uint64_t value) {
+  AddData(attr, base::NumberToString(value));
+}
+
 }  // namespace brave_page_graph
@@ -7,15 +7,26 @@
 #define BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_GRAPHML_H_
 
 #include <libxml/tree.h>
+#include <libxml/xmlIO.h>
+
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "base/containers/flat_map.h"
+#include "base/memory/raw_ref.h"
 #include "base/strings/string_piece.h"
 #include "base/time/time.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/types.h"
+#include "third_party/blink/renderer/core/core_export.h"
 #include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
 
 namespace brave_page_graph {
 
+class GraphEdge;
+class GraphElementsWriter;
+class GraphNode;
+
 class GraphMLAttr {
  public:
   GraphMLAttr(const GraphMLAttrForType for_value,
@@ -23,37 +34,20 @@ class GraphMLAttr {
               const GraphMLAttrType type = kGraphMLAttrTypeString);
 
   GraphMLId GetGraphMLId() const;
-  void AddDefinitionNode(xmlNodePtr parent_node) const;
-  void AddValueNode(xmlDocPtr doc,
-                    xmlNodePtr parent_node,
-                    base::StringPiece value) const;
-  void AddValueNode(xmlDocPtr doc,
-                    xmlNodePtr parent_node,
-                    const String& value) const;
-  void AddValueNode(xmlDocPtr doc,
-                    xmlNodePtr parent_node,
-                    const int value) const;
-  void AddValueNode(xmlDocPtr doc,
-                    xmlNodePtr parent_node,
-                    const bool value) const;
-  void AddValueNode(xmlDocPtr doc,
-                    xmlNodePtr parent_node,
-                    const int64_t value) const;
-  void AddValueNode(xmlDocPtr doc,
-                    xmlNodePtr parent_node,
-                    const uint64_t value) const;
-  void AddValueNode(xmlDocPtr doc,
-                    xmlNodePtr parent_node,
-                    const double value) const;
-  void AddValueNode(xmlDocPtr doc,
-                    xmlNodePtr parent_node,
-                    const base::TimeDelta value) const;
+  GraphMLAttrForType GetFor() const { return for_; }
+  const String& GetName() const { return name_; }
+  GraphMLAttrType GetType() const { return type_; }
 
- private:
-  void AddValueNodeXmlChar(xmlDocPtr doc,
-                           xmlNodePtr parent_node,
-                           const xmlChar* value) const;
+  void AddValue(GraphElementsWriter& writer, base::StringPiece value) const;
+  void AddValue(GraphElementsWriter& writer, const String& value) const;
+  void AddValue(GraphElementsWriter& writer, const int value) const;
+  void AddValue(GraphElementsWriter& writer, const bool value) const;
+  void AddValue(GraphElementsWriter& writer, const int64_t value) const;
+  void AddValue(GraphElementsWriter& writer, const uint64_t value) const;
+  void AddValue(GraphElementsWriter& writer, const double value) const;
+  void AddValue(GraphElementsWriter& writer, const base::TimeDelta value) const;
 
+ private:
   const uint64_t id_;
   const GraphMLAttrForType for_;
   const String name_;
@@ -64,6 +58,74 @@ using GraphMLAttrs = base::flat_map<GraphMLAttrDef, const GraphMLAttr*>;
 const GraphMLAttrs& GetGraphMLAttrs();
 const GraphMLAttr* GraphMLAttrDefForType(const GraphMLAttrDef type);
 
+// Receives a serialized graph in chunks as it is written.
+class GraphSink {
+ public:
+  virtual ~GraphSink() = default;
+  virtual void Write(base::StringPiece chunk) = 0;
+};
+
+// Serializes a graph item by item, so the graph is never held in memory as a
+// whole. The desc entries and the key definitions come first, then
+// StartGraph(), then the elements of the graph items. Graph items write an
+// element with StartNode() or StartEdge(), one AddData() per attribute and
+// EndElement().
+class GraphElementsWriter {
+ public:
+  // (name, value) pairs. Nested entries are named "parent/child".
+  using DescEntries = std::vector<std::pair<std::string, std::string>>;
+
+  virtual ~GraphElementsWriter() = default;
+
+  virtual void WriteDesc(const DescEntries& entries) = 0;
+  virtual void WriteKey(const GraphMLAttr& attr) = 0;
+  virtual void StartGraph() = 0;
+  virtual void StartNode(const GraphNode& node) = 0;
+  virtual void StartEdge(const GraphEdge& edge) = 0;
+  virtual void AddData(const GraphMLAttr& attr, base::StringPiece value) = 0;
+  // Integer values, written as decimal text by default. Writers of compact
+  // formats can encode them as numbers instead.
+  virtual void AddIntData(const GraphMLAttr& attr, int64_t value);
+  virtual void AddUintData(const GraphMLAttr& attr, uint64_t value);
+  virtual void EndElement() = 0;
+  // Called after the elements of the last graph item are written.
+  virtual void Finish() = 0;
+};
+
+// Writes the graph as a GraphML document.
+class CORE_EXPORT GraphMLWriter : public GraphElementsWriter {
+ public:
+  explicit GraphMLWriter(GraphSink& sink);
+  ~GraphMLWriter() override;
+
+  GraphMLWriter(const GraphMLWriter&) = delete;
+  GraphMLWriter& operator=(const GraphMLWriter&) = delete;
+
+  // GraphElementsWriter:
+  void WriteDesc(const DescEntries& entries) override;
+  void WriteKey(const GraphMLAttr& attr) override;
+  void StartGraph() override;
+  void StartNode(const GraphNode& node) override;
+  void StartEdge(const GraphEdge& edge) override;
+  void AddData(const GraphMLAttr& attr, base::StringPiece value) override;
+  void EndElement() override;
+  void Finish() override;
+
+ private:
+  static int OnWrite(void* context, const char* buffer, int len);
+
+  // Writes |markup| as is, it must already be valid XML.
+  void WriteMarkup(base::StringPiece markup);
+  // Writes and frees |element|, which is not linked to any parent.
+  void WriteElement(xmlNodePtr element);
+
+  const raw_ref<GraphSink> sink_;
+  xmlDocPtr doc_;
+  xmlOutputBufferPtr output_;
+  // The element of the graph item being written, if any.
+  xmlNodePtr current_element_ = nullptr;
+};
+
 }  // namespace brave_page_graph
 
 #endif  // BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_GRAPHML_H_
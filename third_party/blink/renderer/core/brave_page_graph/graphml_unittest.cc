@@ -0,0 +1,179 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graphml.h"
+
+#include <libxml/entities.h>
+#include <libxml/tree.h>
+
+#include <string>
+#include <vector>
+
+#include "base/strings/string_piece.h"
+#include "base/test/task_environment.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/edge/graph_edge.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/node/graph_node.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/test_graph.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/types.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave_page_graph {
+
+namespace {
+
+// Builds the whole document before dumping it, which is how
+// PageGraph::ToGraphML() worked before GraphML was streamed.
+class DocumentGraphMLWriter : public GraphElementsWriter {
+ public:
+  DocumentGraphMLWriter()
+      : doc_(xmlNewDoc(BAD_CAST "1.0")),
+        root_(xmlNewNode(nullptr, BAD_CAST "graphml")) {
+    xmlDocSetRootElement(doc_, root_);
+    xmlNewNs(root_, BAD_CAST "http://graphml.graphdrawing.org/xmlns", nullptr);
+    xmlNsPtr xsi_ns =
+        xmlNewNs(root_, BAD_CAST "http://www.w3.org/2001/XMLSchema-instance",
+                 BAD_CAST "xsi");
+    xmlNewNsProp(root_, xsi_ns, BAD_CAST "schemaLocation",
+                 BAD_CAST
+                 "http://graphml.graphdrawing.org/xmlns "
+                 "http://graphml.graphdrawing.org/xmlns/1.0/graphml.xsd");
+  }
+
+  ~DocumentGraphMLWriter() override { xmlFreeDoc(doc_); }
+
+  void WriteDesc(const DescEntries& entries) override {
+    xmlNodePtr desc_node =
+        xmlNewChild(root_, nullptr, BAD_CAST "desc", nullptr);
+    for (const auto& [name, value] : entries) {
+      xmlNodePtr parent_node = desc_node;
+      std::string child_name = name;
+      const size_t separator = name.find('/');
+      if (separator != std::string::npos) {
+        const std::string parent_name = name.substr(0, separator);
+        parent_node = xmlGetLastChild(desc_node);
+        if (!parent_node ||
+            !xmlStrEqual(parent_node->name, BAD_CAST parent_name.c_str())) {
+          parent_node = xmlNewChild(desc_node, nullptr,
+                                    BAD_CAST parent_name.c_str(), nullptr);
+        }
+        child_name = name.substr(separator + 1);
+      }
+      xmlNewTextChild(parent_node, nullptr, BAD_CAST child_name.c_str(),
+                      BAD_CAST value.c_str());
+    }
+  }
+
+  void WriteKey(const GraphMLAttr& attr) override {
+    xmlNodePtr key_node = xmlNewChild(root_, nullptr, BAD_CAST "key", nullptr);
+    xmlSetProp(key_node, BAD_CAST "id", BAD_CAST attr.GetGraphMLId().c_str());
+    xmlSetProp(key_node, BAD_CAST "for",
+               BAD_CAST GraphMLForTypeToString(attr.GetFor()).c_str());
+    xmlSetProp(key_node, BAD_CAST "attr.name",
+               BAD_CAST attr.GetName().Utf8().c_str());
+    xmlSetProp(key_node, BAD_CAST "attr.type",
+               BAD_CAST GraphMLAttrTypeToString(attr.GetType()).c_str());
+  }
+
+  void StartGraph() override {
+    graph_ = xmlNewChild(root_, nullptr, BAD_CAST "graph", nullptr);
+    xmlSetProp(graph_, BAD_CAST "id", BAD_CAST "G");
+    xmlSetProp(graph_, BAD_CAST "edgedefault", BAD_CAST "directed");
+  }
+
+  void StartNode(const GraphNode& node) override {
+    current_element_ = xmlNewChild(graph_, nullptr, BAD_CAST "node", nullptr);
+    xmlSetProp(current_element_, BAD_CAST "id",
+               BAD_CAST node.GetGraphMLId().c_str());
+  }
+
+  void StartEdge(const GraphEdge& edge) override {
+    current_element_ = xmlNewChild(graph_, nullptr, BAD_CAST "edge", nullptr);
+    xmlSetProp(current_element_, BAD_CAST "id",
+               BAD_CAST edge.GetGraphMLId().c_str());
+    xmlSetProp(current_element_, BAD_CAST "source",
+               BAD_CAST edge.GetOutNode()->GetGraphMLId().c_str());
+    xmlSetProp(current_element_, BAD_CAST "target",
+               BAD_CAST edge.GetInNode()->GetGraphMLId().c_str());
+  }
+
+  void AddData(const GraphMLAttr& attr, base::StringPiece value) override {
+    xmlChar* encoded_content = xmlEncodeEntitiesReentrant(
+        doc_, BAD_CAST std::string(value).c_str());
+    xmlNodePtr data_node = xmlNewChild(current_element_, nullptr,
+                                       BAD_CAST "data", encoded_content);
+    xmlSetProp(data_node, BAD_CAST "key", BAD_CAST attr.GetGraphMLId().c_str());
+    xmlFree(encoded_content);
+  }
+
+  void EndElement() override { current_element_ = nullptr; }
+
+  void Finish() override {
+    xmlChar* xml_string = nullptr;
+    int size = 0;
+    xmlDocDumpMemoryEnc(doc_, &xml_string, &size, "UTF-8");
+    document.assign(reinterpret_cast<const char*>(xml_string), size);
+    xmlFree(xml_string);
+  }
+
+  std::string document;
+
+ private:
+  xmlDocPtr doc_;
+  xmlNodePtr root_;
+  xmlNodePtr graph_ = nullptr;
+  xmlNodePtr current_element_ = nullptr;
+};
+
+class ChunkSink : public GraphSink {
+ public:
+  void Write(base::StringPiece chunk) override {
+    chunks.emplace_back(chunk);
+  }
+
+  std::vector<std::string> chunks;
+};
+
+}  // namespace
+
+class GraphMLTest : public testing::Test {
+ protected:
+  // Keeps the timestamps of the graph items the same across test graphs.
+  base::test::TaskEnvironment task_environment_{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
+};
+
+TEST_F(GraphMLTest, StreamedMatchesDocumentDump) {
+  // Writing a graph adds items, e.g. the structure edges of HTML elements, so
+  // each writer gets its own copy of the graph.
+  DocumentGraphMLWriter document_writer;
+  TestGraph(3).Write(document_writer);
+
+  StringSink sink;
+  GraphMLWriter writer(sink);
+  TestGraph(3).Write(writer);
+
+  ASSERT_FALSE(document_writer.document.empty());
+  EXPECT_EQ(document_writer.document, sink.data);
+}
+
+TEST_F(GraphMLTest, WritesInChunks) {
+  DocumentGraphMLWriter document_writer;
+  TestGraph(1000).Write(document_writer);
+
+  ChunkSink sink;
+  GraphMLWriter writer(sink);
+  TestGraph(1000).Write(writer);
+
+  // The document reaches the sink piece by piece rather than all at once.
+  ASSERT_GT(sink.chunks.size(), 1u);
+  std::string streamed;
+  for (const auto& chunk : sink.chunks) {
+    EXPECT_LT(chunk.size(), document_writer.document.size());
+    streamed.append(chunk);
+  }
+  EXPECT_EQ(document_writer.document, streamed);
+}
+
+}  // namespace brave_page_graph
@@ -5,8 +5,6 @@
 
 #include "brave/third_party/blink/renderer/core/brave_page_graph/page_graph.h"
 
-#include <libxml/tree.h>
-
 #include <signal.h>
 #include <climits>
 #include <iostream>
@@ -24,6 +22,7 @@
 #include "base/ranges/algorithm.h"
 #include "brave/components/brave_page_graph/common/features.h"
 #include "brave/components/brave_shields/common/brave_shield_constants.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/binary_graph.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/edge/attribute/edge_attribute_delete.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/edge/attribute/edge_attribute_set.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/edge/binding/edge_binding.h"
@@ -80,7 +79,6 @@
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/node/storage/node_storage_root.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/node/storage/node_storage_sessionstorage.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graphml.h"
-#include "brave/third_party/blink/renderer/core/brave_page_graph/libxml_utils.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/requests/request_tracker.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/requests/tracked_request.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/scripts/script_tracker.h"
@@ -181,7 +179,6 @@ using brave_page_graph::NodeTrackerFilter;
 using brave_page_graph::NormalizeUrl;
 using brave_page_graph::ScriptId;
 using brave_page_graph::TrackedRequest;
-using brave_page_graph::XmlUtf8String;
 
 namespace blink {
 
@@ -191,6 +188,15 @@ constexpr char kPageGraphVersion[] = "0.3.0";
 constexpr char kPageGraphUrl[] =
     "https://github.com/brave/brave-browser/wiki/PageGraph";
 
+class StringGraphSink : public brave_page_graph::GraphSink {
+ public:
+  void Write(base::StringPiece chunk) override {
+    data.append(chunk.data(), chunk.size());
+  }
+
+  std::string data;
+};
+
 PageGraph* GetPageGraphFromIsolate(v8::Isolate* isolate) {
   blink::LocalDOMWindow* window = blink::CurrentDOMWindow(isolate);
   if (!window) {
@@ -1007,72 +1013,63 @@ void PageGraph::GenerateReportForNode(const blink::DOMNodeId node_id,
 }
 
 String PageGraph::ToGraphML() const {
-  xmlDocPtr graphml_doc = xmlNewDoc(BAD_CAST "1.0");
-  xmlNodePtr graphml_root_node = xmlNewNode(nullptr, BAD_CAST "graphml");
-  xmlDocSetRootElement(graphml_doc, graphml_root_node);
-
-  xmlNewNs(graphml_root_node, BAD_CAST "http://graphml.graphdrawing.org/xmlns",
-           nullptr);
-  xmlNsPtr xsi_ns = xmlNewNs(
-      graphml_root_node, BAD_CAST "http://www.w3.org/2001/XMLSchema-instance",
-      BAD_CAST "xsi");
-  xmlNewNsProp(graphml_root_node, xsi_ns, BAD_CAST "schemaLocation",
-               BAD_CAST
-               "http://graphml.graphdrawing.org/xmlns "
-               "http://graphml.graphdrawing.org/xmlns/1.0/graphml.xsd");
-
-  xmlNodePtr desc_container_node =
-      xmlNewChild(graphml_root_node, nullptr, BAD_CAST "desc", nullptr);
-  xmlNewTextChild(desc_container_node, nullptr, BAD_CAST "version",
-                  BAD_CAST kPageGraphVersion);
-  xmlNewTextChild(desc_container_node, nullptr, BAD_CAST "about",
-                  BAD_CAST kPageGraphUrl);
-  xmlNewTextChild(desc_container_node, nullptr, BAD_CAST "is_root",
-                  BAD_CAST(IsRootFrame() ? "true" : "false"));
-  xmlNewTextChild(desc_container_node, nullptr, BAD_CAST "frame_id",
-                  XmlUtf8String(frame_id_).get());
-  if (IsRootFrame()) {
-    xmlNewTextChild(desc_container_node, NULL, BAD_CAST "url",
-                    XmlUtf8String(source_url_).get());
-  }
+  StringGraphSink sink;
+  WriteGraphML(sink);
+  auto graphml_string = String::FromUTF8(sink.data.data(), sink.data.size());
+  DCHECK(!graphml_string.empty());
 
-  xmlNodePtr time_container_node =
-      xmlNewChild(desc_container_node, nullptr, BAD_CAST "time", nullptr);
+  return graphml_string;
+}
 
-  xmlNewTextChild(time_container_node, nullptr, BAD_CAST "start",
-                  BAD_CAST base::NumberToString(0).c_str());
+std::string PageGraph::ToBinaryGraph() const {
+  StringGraphSink sink;
+  WriteBinaryGraph(sink);
+  return std::move(sink.data);
+}
 
+void PageGraph::WriteGraphML(brave_page_graph::GraphSink& sink) const {
+  brave_page_graph::GraphMLWriter writer(sink);
+  WriteGraph(writer);
+}
+
+void PageGraph::WriteBinaryGraph(brave_page_graph::GraphSink& sink) const {
+  brave_page_graph::BinaryGraphWriter writer(sink);
+  WriteGraph(writer);
+}
+
+void PageGraph::WriteGraph(
+    brave_page_graph::GraphElementsWriter& writer) const {
+  brave_page_graph::GraphElementsWriter::DescEntries desc_entries = {
+      {"version", kPageGraphVersion},
+      {"about", kPageGraphUrl},
+      {"is_root", IsRootFrame() ? "true" : "false"},
+      {"frame_id", frame_id_.Utf8()},
+  };
+  if (IsRootFrame()) {
+    desc_entries.emplace_back("url", source_url_.Utf8());
+  }
   const base::TimeDelta end_time = base::TimeTicks::Now() - start_;
-  xmlNewTextChild(
-      time_container_node, nullptr, BAD_CAST "end",
-      BAD_CAST base::NumberToString(end_time.InMilliseconds()).c_str());
+  desc_entries.emplace_back("time/start", base::NumberToString(0));
+  desc_entries.emplace_back("time/end",
+                            base::NumberToString(end_time.InMilliseconds()));
+  writer.WriteDesc(desc_entries);
 
   for (const auto& graphml_attr : brave_page_graph::GetGraphMLAttrs()) {
-    graphml_attr.second->AddDefinitionNode(graphml_root_node);
+    writer.WriteKey(*graphml_attr.second);
   }
 
-  xmlNodePtr graph_node =
-      xmlNewChild(graphml_root_node, nullptr, BAD_CAST "graph", nullptr);
-  xmlSetProp(graph_node, BAD_CAST "id", BAD_CAST "G");
-  xmlSetProp(graph_node, BAD_CAST "edgedefault", BAD_CAST "directed");
+  writer.StartGraph();
 
+  // Each item is written as soon as it is visited, so the graph is never
+  // serialized into memory as a whole.
   for (const auto* node : nodes_) {
-    node->AddGraphMLTag(graphml_doc, graph_node);
+    node->AddGraphMLTag(writer);
   }
   for (const auto* edge : edges_) {
-    edge->AddGraphMLTag(graphml_doc, graph_node);
+    edge->AddGraphMLTag(writer);
   }
 
-  xmlChar* xml_string;
-  int size;
-  xmlDocDumpMemoryEnc(graphml_doc, &xml_string, &size, "UTF-8");
-  auto graphml_string = String::FromUTF8(xml_string, size);
-  DCHECK(!graphml_string.empty());
-
-  xmlFree(xml_string);
-  xmlFree(graphml_doc);
-
-  return graphml_string;
+  writer.Finish();
 }
 
 NodeHTML* PageGraph::GetHTMLNode(const DOMNodeId node_id) const {
@@ -39,6 +39,8 @@ class UnguessableToken;
 namespace brave_page_graph {
 
 class GraphEdge;
+class GraphElementsWriter;
+class GraphSink;
 class GraphNode;
 class NodeActor;
 class NodeAdFilter;
@@ -233,7 +235,18 @@ class CORE_EXPORT PageGraph : public GarbageCollected<PageGraph>,
 
   void GenerateReportForNode(const blink::DOMNodeId node_id,
                              blink::protocol::Array<String>& report);
+  // Returns the whole GraphML document. Page.generatePageGraph sends it to
+  // DevTools as a single protocol string, so that path still holds the whole
+  // document in memory; only the libxml2 DOM of the graph is no longer built.
   String ToGraphML() const;
+  // Returns the graph in the compact format of binary_graph.h. Like
+  // ToGraphML(), the whole encoded graph is held in memory.
+  std::string ToBinaryGraph() const;
+  // Streams the same document as ToGraphML() to |sink| without holding the
+  // whole of it in memory.
+  void WriteGraphML(brave_page_graph::GraphSink& sink) const;
+  // Streams the graph to |sink| in the compact format of binary_graph.h.
+  void WriteBinaryGraph(brave_page_graph::GraphSink& sink) const;
 
  private:
 #define PAGE_GRAPH_USING_DECL(type) using type = brave_page_graph::type
@@ -289,6 +302,8 @@ class CORE_EXPORT PageGraph : public GarbageCollected<PageGraph>,
     ScriptId parent_script_id = 0;
   };
 
+  void WriteGraph(brave_page_graph::GraphElementsWriter& writer) const;
+
   NodeHTML* GetHTMLNode(const blink::DOMNodeId node_id) const;
   NodeHTMLElement* GetHTMLElementNode(const blink::DOMNodeId node_id) const;
   NodeHTMLText* GetHTMLTextNode(const blink::DOMNodeId node_id) const;
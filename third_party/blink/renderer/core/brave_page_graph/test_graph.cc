@@ -0,0 +1,49 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/third_party/blink/renderer/core/brave_page_graph/test_graph.h"
+
+#include "third_party/blink/renderer/platform/weborigin/kurl.h"
+
+namespace brave_page_graph {
+
+TestGraph::TestGraph(int request_count) {
+  html = std::make_unique<NodeHTMLElement>(&context, 1, "html");
+  text = std::make_unique<NodeHTMLText>(
+      &context, 2, String::FromUTF8("<b>\"caf\xC3\xA9\" & more</b>"));
+  html->PlaceChildNodeAfterSiblingNode(text.get(), nullptr);
+  nodes = {html.get(), text.get()};
+
+  for (int i = 0; i < request_count; ++i) {
+    auto& resource = resources.emplace_back(std::make_unique<NodeResource>(
+        &context, blink::KURL("https://example.com/image" +
+                              String::Number(i % 10) + ".png")));
+    nodes.push_back(resource.get());
+    edges.push_back(std::make_unique<EdgeRequestStart>(
+        &context, html.get(), resource.get(), i, "image"));
+  }
+}
+
+TestGraph::~TestGraph() = default;
+
+void TestGraph::Write(GraphElementsWriter& writer) const {
+  writer.WriteDesc({{"version", "0.3.0"},
+                    {"is_root", "true"},
+                    {"time/start", "0"},
+                    {"time/end", "10"}});
+  for (const auto& graphml_attr : GetGraphMLAttrs()) {
+    writer.WriteKey(*graphml_attr.second);
+  }
+  writer.StartGraph();
+  for (const auto* node : nodes) {
+    node->AddGraphMLTag(writer);
+  }
+  for (const auto& edge : edges) {
+    edge->AddGraphMLTag(writer);
+  }
+  writer.Finish();
+}
+
+}  // namespace brave_page_graph
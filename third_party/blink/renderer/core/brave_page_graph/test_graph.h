@@ -0,0 +1,63 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_TEST_GRAPH_H_
+#define BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_TEST_GRAPH_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/strings/string_piece.h"
+#include "base/time/time.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/edge/request/edge_request_start.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/graph_item_context.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/node/html/node_html_element.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/node/html/node_html_text.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/node/node_resource.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graphml.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/types.h"
+
+namespace brave_page_graph {
+
+class TestGraphItemContext : public GraphItemContext {
+ public:
+  base::TimeTicks GetGraphStartTime() const override { return start_time_; }
+  GraphItemId GetNextGraphItemId() override { return ++last_graph_item_id_; }
+
+ private:
+  const base::TimeTicks start_time_ = base::TimeTicks::Now();
+  GraphItemId last_graph_item_id_ = 0;
+};
+
+class StringSink : public GraphSink {
+ public:
+  void Write(base::StringPiece chunk) override {
+    data.append(chunk.data(), chunk.size());
+  }
+
+  std::string data;
+};
+
+// A small DOM and |request_count| requests, with values which need escaping
+// in GraphML and values which repeat.
+struct TestGraph {
+  explicit TestGraph(int request_count);
+  ~TestGraph();
+
+  // Writes the graph the same way as PageGraph::WriteGraph().
+  void Write(GraphElementsWriter& writer) const;
+
+  TestGraphItemContext context;
+  std::unique_ptr<NodeHTMLElement> html;
+  std::unique_ptr<NodeHTMLText> text;
+  std::vector<std::unique_ptr<NodeResource>> resources;
+  std::vector<const GraphNode*> nodes;
+  std::vector<std::unique_ptr<EdgeRequestStart>> edges;
+};
+
+}  // namespace brave_page_graph
+
+#endif  // BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_TEST_GRAPH_H_